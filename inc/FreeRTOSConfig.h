@@ -27,6 +27,7 @@
 #define FREERTOS_CONFIG_H
 
 #include <board.h>
+#include "trace.h"
 
 /*-----------------------------------------------------------
  * Application specific definitions.
@@ -45,7 +46,8 @@
 #define configSUPPORT_STATIC_ALLOCATION  0
 
 #define configUSE_PREEMPTION             1
-#define configUSE_IDLE_HOOK              0
+#define configUSE_TIME_SLICING           0 // Las tareas de igual prioridad sólo se alternan al bloquearse
+#define configUSE_IDLE_HOOK              1 // Trabajos diferidos y WFI, ver idle.h
 #define configUSE_TICKLESS_IDLE          0
 #define configUSE_TICK_HOOK              0
 #define configCPU_CLOCK_HZ               (SystemCoreClock)
@@ -168,6 +170,19 @@ void vMainPostStopProcessing(void);
 #define xPortSysTickHandler SysTick_Handler
 #define vHardFault_Handler  HardFault_Handler
 
+/* Trace hooks: task switches and queue sends are written to the binary trace buffer (see trace.h). Task and queue
+ * numbers are assigned with vTaskSetTaskNumber() and vQueueSetQueueNumber(), both available because
+ * configUSE_TRACE_FACILITY is 1. */
+#if TRACE_ENABLED
+#define traceTASK_SWITCHED_IN()  TraceWrite(TRACE_TASK_SWITCHED_IN, (uint16_t)pxCurrentTCB->uxTaskNumber)
+#define traceTASK_SWITCHED_OUT() TraceWrite(TRACE_TASK_SWITCHED_OUT, (uint16_t)pxCurrentTCB->uxTaskNumber)
+#define traceQUEUE_SEND(pxQueue) TraceWrite(TRACE_QUEUE_SEND, (uint16_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND_FAILED(pxQueue) TraceWrite(TRACE_QUEUE_SEND_FAILED, (uint16_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) TraceWrite(TRACE_QUEUE_SEND, (uint16_t)(pxQueue)->uxQueueNumber)
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue)                                                   \
+    TraceWrite(TRACE_QUEUE_SEND_FAILED, (uint16_t)(pxQueue)->uxQueueNumber)
+#endif /* TRACE_ENABLED */
+
 /* IMPORTANT: This define MUST be commented when used with STM32Cube firmware,
  *            to prevent overwriting SysTick_Handler defined within STM32Cube HAL. */
 /* #define xPortSysTickHandler SysTick_Handler */
@@ -0,0 +1,312 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+/** @file app.h
+ ** @brief Declaraciones de la máquina de estados de la aplicación del reloj
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "bsp.h"
+#include "chrono.h"
+#include "clock.h"
+#include "persist.h"
+#include "record.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+/* === Public data type declarations ============================================================================== */
+
+//! Modos de funcionamiento del reloj
+typedef enum {
+    CLOCK_MODE_UNSET_TIME,        //!< Modo para establecer la hora inicial
+    CLOCK_MODE_DISPLAY,           //!< Modo de visualización normal
+    CLOCK_MODE_SET_HOURS,         //!< Modo para establecer horas
+    CLOCK_MODE_SET_MINUTES,       //!< Modo para establecer minutos
+    CLOCK_MODE_SET_ALARM_HOURS,   //!< Modo para establecer horas de la alarma
+    CLOCK_MODE_SET_ALARM_MINUTES, //!< Modo para establecer minutos de la alarma
+    CLOCK_MODE_TIMER,             //!< Modo del temporizador de cuenta regresiva
+    CLOCK_MODE_SET_TIMER_HOURS,   //!< Modo para establecer horas del temporizador
+    CLOCK_MODE_SET_TIMER_MINUTES, //!< Modo para establecer minutos del temporizador
+    CLOCK_MODE_STOPWATCH,         //!< Modo del cronómetro
+    CLOCK_MODE_COUNT,             //!< Cantidad de modos, no es un modo válido
+} clock_mode_t;
+
+//! Eventos que recibe la máquina de estados
+typedef enum {
+    MSG_BUTTON_SET_TIME_LONG,
+    MSG_BUTTON_SET_ALARM_LONG,
+    MSG_BUTTON_ACCEPT,
+    MSG_BUTTON_CANCEL,
+    MSG_BUTTON_INCREASE,
+    MSG_BUTTON_DECREASE,
+    MSG_CLOCK_TICK,
+    MSG_CONFIG_TIMEOUT,
+    MSG_BUTTON_INCREASE_REPEAT, //!< Repeticiones de la tecla de incremento mantenida, sólo en los modos de ajuste
+    MSG_BUTTON_DECREASE_REPEAT, //!< Repeticiones de la tecla de decremento mantenida, sólo en los modos de ajuste
+    MSG_COUNT, //!< Cantidad de eventos, no es un evento válido
+} message_type_t;
+
+//! Estructura que representa la aplicación del reloj
+typedef struct app_s * app_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief       Crea la aplicación, en modo CLOCK_MODE_DISPLAY si el reloj ya tiene una hora válida (por ejemplo la del
+ *              RTC) o en modo CLOCK_MODE_UNSET_TIME si no la tiene.
+ *
+ * @param clock Reloj que gestiona la aplicación.
+ * @param board Placa con la pantalla y las salidas de alarma.
+ * @return      La aplicación creada.
+ */
+app_t AppCreate(clock_t clock, board_t board);
+
+/**
+ * @brief           Asocia un registrador donde se guardan los mensajes, cambios de modo y salidas de la aplicación.
+ *
+ * @param self      La aplicación a registrar.
+ * @param recorder  El registrador, NULL para dejar de registrar.
+ */
+void AppAttachRecorder(app_t self, recorder_t recorder);
+
+/**
+ * @brief           Asocia el almacenamiento persistente y recupera en el reloj la alarma y la corrección guardadas.
+ *
+ * @param self      La aplicación.
+ * @param persist   El almacenamiento, NULL para no guardar el estado.
+ */
+void AppAttachPersist(app_t self, persist_t persist);
+
+/**
+ * @brief           Asocia el temporizador y el cronómetro que se muestran en CLOCK_MODE_TIMER y CLOCK_MODE_STOPWATCH.
+ *
+ * Si el temporizador no tiene duración se le asigna TIMER_DEFAULT_MINUTES.
+ *
+ * @param self      La aplicación.
+ * @param timer     El temporizador, NULL para mostrar siempre cero.
+ * @param stopwatch El cronómetro, NULL para mostrar siempre cero.
+ */
+void AppAttachChronos(app_t self, chrono_t timer, chrono_t stopwatch);
+
+/**
+ * @brief       Guarda en el almacenamiento persistente la alarma y la corrección del oscilador, sin la transitoria.
+ *
+ * Se llama automáticamente al cambiar la alarma desde los botones; se debe llamar después de calibrar el reloj. Si
+ * las escrituras están diferidas (ver AppDeferSave) el estado queda pendiente hasta AppFlushState.
+ *
+ * @param self  La aplicación.
+ */
+void AppSaveState(app_t self);
+
+/**
+ * @brief           Difiere las escrituras del estado persistente, para hacerlas desde la tarea inactiva.
+ *
+ * Con las escrituras diferidas AppSaveState sólo toma el estado y lo deja pendiente, sin esperar a la memoria no
+ * volátil; lo guarda AppFlushState.
+ *
+ * @param self      La aplicación.
+ * @param deferred  true para diferir las escrituras, false para volver a escribir en AppSaveState.
+ */
+void AppDeferSave(app_t self, bool deferred);
+
+/**
+ * @brief       Guarda el estado pendiente de AppSaveState, si lo hay.
+ *
+ * Se puede llamar desde una tarea de menor prioridad que las que llaman a AppSaveState: si una de ellas deja un estado
+ * nuevo mientras se copia el pendiente, se guarda recién en la próxima llamada.
+ *
+ * @param self  La aplicación.
+ */
+void AppFlushState(app_t self);
+
+/**
+ * @brief       Ajusta la fecha y la hora sin pasar por los botones, por ejemplo desde el enlace serie.
+ *
+ * Si el reloj no tenía hora válida la aplicación pasa a CLOCK_MODE_DISPLAY; en los demás modos se conserva el modo.
+ *
+ * @param self  La aplicación.
+ * @param date  La nueva fecha.
+ * @param time  La nueva hora.
+ * @return      true si se ajustaron la fecha y la hora, false si alguna es inválida y el reloj no cambió.
+ */
+bool AppSetTime(app_t self, const clock_date_t * date, const clock_time_t * time);
+
+/**
+ * @brief           Ajusta la alarma sin pasar por los botones y la guarda en el almacenamiento persistente.
+ *
+ * @param self      La aplicación.
+ * @param alarm     Hora de la alarma.
+ * @param weekdays  Días de la semana en los que suena, el bit 0 es el domingo.
+ * @param enabled   true para habilitar la alarma, false para deshabilitarla.
+ * @return          true si se ajustó la alarma, false si la hora es inválida y la alarma no cambió.
+ */
+bool AppSetAlarm(app_t self, const clock_time_t * alarm, uint8_t weekdays, bool enabled);
+
+/**
+ * @brief       Procesa un evento buscando la transición en la tabla de modos.
+ *
+ * @param self  La aplicación que recibe el evento.
+ * @param event Evento a procesar.
+ */
+void AppDispatch(app_t self, message_type_t event);
+
+/**
+ * @brief       Procesa un evento que acumula varios pasos, como las repeticiones de una tecla mantenida.
+ *
+ * Los pasos se aplican al campo en edición con una sola suma y una sola escritura de la pantalla. Se registran como
+ * valor del mensaje para poder reproducirlos.
+ *
+ * @param self  La aplicación que recibe el evento.
+ * @param event Evento a procesar.
+ * @param steps Cantidad de pasos, 0 para un evento simple, que vale un paso.
+ */
+void AppDispatchSteps(app_t self, message_type_t event, uint16_t steps);
+
+/**
+ * @brief       Ejecuta la tarea periódica del modo actual (por ejemplo, verificar la alarma) y, en cualquier modo,
+ *              verifica si venció el temporizador.
+ *
+ * @param self  La aplicación a actualizar.
+ */
+void AppPoll(app_t self);
+
+/**
+ * @brief       Calcula cuánto puede esperar la tarea que procesa los eventos antes de volver a llamar a AppPoll.
+ *
+ * Cuenta hasta el vencimiento del temporizador y hasta el próximo cambio de la alarma en los modos que la verifican;
+ * mientras la alarma suena se usa APP_POLL_TICKS para volver a tocar la melodía. Cualquier evento puede cambiar el
+ * resultado, así que se vuelve a calcular después de cada uno.
+ *
+ * @param self  La aplicación a consultar.
+ * @return      Ticks hasta la próxima llamada, CLOCK_NO_DEADLINE si sólo hace falta con un evento.
+ */
+uint32_t AppPollDelay(app_t self);
+
+/**
+ * @brief       Cambia el modo de la aplicación y configura la pantalla según el nuevo modo.
+ *
+ * @param self  La aplicación a modificar.
+ * @param mode  Nuevo modo de la aplicación.
+ */
+void AppModeChange(app_t self, clock_mode_t mode);
+
+/**
+ * @brief           Escribe en la pantalla el último cuadro publicado por la aplicación o el tiempo que avanza.
+ *
+ * Es la única función que escribe los dígitos de la pantalla: los eventos sólo publican el cuadro del modo actual.
+ * Se llama en cada barrido desde la tarea de la pantalla, que debe tener mayor prioridad que la que procesa los
+ * eventos.
+ *
+ * @param self      La aplicación a mostrar.
+ * @param elapsed   true si pasó el período de AppRefreshTicks, para volver a calcular el tiempo que se muestra.
+ */
+void AppUpdateDisplay(app_t self, bool elapsed);
+
+/**
+ * @brief       Obtiene cada cuántos ticks hay que volver a calcular el tiempo que muestra la pantalla.
+ *
+ * @param self  La aplicación a consultar.
+ * @return      Período de actualización en ticks, 0 si la pantalla sólo cambia con los eventos.
+ */
+uint16_t AppRefreshTicks(app_t self);
+
+/**
+ * @brief       Obtiene el modo actual de la aplicación.
+ *
+ * @param self  La aplicación a consultar.
+ * @return      El modo actual.
+ */
+clock_mode_t AppGetMode(app_t self);
+
+/**
+ * @brief       Verifica si la aplicación está en un modo de configuración.
+ *
+ * @param self  La aplicación a consultar.
+ * @return      true si el modo actual es de configuración, false en caso contrario.
+ */
+bool AppIsInConfigMode(app_t self);
+
+/**
+ * @brief       Cuenta los ticks transcurridos del tiempo de configuración sin actividad.
+ *
+ * @param self  La aplicación a actualizar.
+ * @param ticks Ticks transcurridos desde la llamada anterior.
+ * @return      true si se agotó el tiempo de configuración, false en caso contrario.
+ */
+bool AppConfigTimeoutTick(app_t self, uint32_t ticks);
+
+/**
+ * @brief       Indica si la alarma de la aplicación está sonando.
+ *
+ * @param self  La aplicación a consultar.
+ * @return      true si la alarma está sonando, false en caso contrario.
+ */
+bool AppAlarmIsRinging(app_t self);
+
+/**
+ * @brief Función para incrementar un número BCD (Binary-Coded Decimal) con límite.
+ *
+ * @param numero Puntero al número BCD a incrementar.
+ * @param limite Valor límite para el número BCD, representado como un arreglo de dos elementos:
+ *              - limite[0]: decena (0-2 para horas, 0-5 para minutos/segundos)
+ *              - limite[1]: unidad (0-3 para horas, 0-9 para minutos/segundos)
+ */
+void IncreaseBCD(uint8_t * numero, const uint8_t limite[2]);
+
+/**
+ * @brief Función para decrementar un número BCD (Binary-Coded Decimal) con límite.
+ *
+ * @param numero Puntero al número BCD a decrementar.
+ * @param limite Valor límite para el número BCD, representado como un arreglo de dos elementos:
+ *              - limite[0]: decena (0-2 para horas, 0-5 para minutos/segundos)
+ *              - limite[1]: unidad (0-3 para horas, 0-9 para minutos/segundos)
+ */
+void DecreaseBCD(uint8_t * numero, const uint8_t limite[2]);
+
+/**
+ * @brief Función para sumar o restar varios pasos a un número BCD con límite, en una sola cuenta.
+ *
+ * @param numero Puntero al número BCD a modificar, con las unidades en numero[0] y las decenas en numero[1].
+ * @param limite Valor límite para el número BCD, con las decenas en limite[0] y las unidades en limite[1]; al pasar
+ *               el límite el número vuelve a cero y al bajar de cero vuelve al límite.
+ * @param pasos  Cantidad de pasos a sumar, negativa para restar.
+ */
+void AddBCD(uint8_t * numero, const uint8_t limite[2], int16_t pasos);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_H_ */
@@ -27,7 +27,9 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =================================================================================== */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "digital.h"
+#include "buzzer.h"
 #include "screen.h"
 
 /* === Header for C++ compatibility =============================================================================== */
@@ -42,7 +44,7 @@ extern "C" {
 
 //! Estructura que representa una placa
 typedef struct board_s {
-    digital_output_t buzzer;
+    buzzer_t buzzer;
     digital_output_t led_red;
     digital_output_t led_green;
     digital_output_t led_blue;
@@ -55,17 +57,29 @@ typedef struct board_s {
     screen_t screen;
 } * board_t;
 
+//! Función que recibe los bytes que llegan por la UART, se llama desde la interrupción de recepción
+typedef void (*uart_receive_t)(const uint8_t * data, uint16_t size);
+
 /* === Public variable declarations =============================================================================== */
 
 /* === Public function declarations =============================================================================== */
 
 /**
- * @brief   Función para crear una placa
+ * @brief   Función para crear una placa con lo necesario para mostrar la hora: la pantalla y las salidas de alarma
+ *
+ * Las teclas y los LEDs de la EDU-CIAA no se configuran, se deben completar después con BoardCompleteInit.
  *
  * @return      Estructura que representa la placa
 */
 board_t BoardCreate();
 
+/**
+ * @brief   Función para completar la inicialización de la placa: teclas y LEDs de la EDU-CIAA
+ *
+ * @param   board  Placa creada con BoardCreate
+ */
+void BoardCompleteInit(board_t board);
+
 /**
  * @brief   Función para inicializar el SysTick
  *
@@ -73,6 +87,102 @@ board_t BoardCreate();
  */
 void SysTickInit(uint32_t ticks);
 
+/**
+ * @brief   Función para habilitar el contador de ciclos del núcleo (DWT), usado como fuente de tiempo de las trazas
+ *
+ * @return  Cantidad de ciclos por microsegundo
+ */
+uint16_t CycleCounterInit(void);
+
+/**
+ * @brief   Función para leer el contador de ciclos del núcleo
+ *
+ * @return  Cantidad de ciclos desde la habilitación del contador, desborda cada 2^32 ciclos
+ */
+uint32_t CycleCounterRead(void);
+
+/**
+ * @brief   Función para dormir el procesador hasta la próxima interrupción, desde el gancho de la tarea inactiva
+ *
+ * @return  Ciclos que durmió, medidos con las interrupciones enmascaradas hasta el momento de despertar
+ */
+uint32_t CpuSleep(void);
+
+/**
+ * @brief   Función para habilitar el RTC del microcontrolador, sin modificar la hora que mantiene
+ */
+void RtcInit(void);
+
+/**
+ * @brief   Función para leer la fecha y la hora del RTC
+ *
+ * @param   seconds  Segundos transcurridos desde la época (1970-01-01 00:00:00)
+ * @return           true si el RTC fue ajustado desde la última pérdida de alimentación, false en caso contrario
+ */
+bool RtcReadSeconds(uint32_t * seconds);
+
+/**
+ * @brief   Función para ajustar la fecha y la hora del RTC
+ *
+ * Reinicia el divisor del RTC, por lo que el segundo escrito comienza en el momento de la escritura.
+ *
+ * @param   seconds  Segundos transcurridos desde la época (1970-01-01 00:00:00)
+ */
+void RtcWriteSeconds(uint32_t seconds);
+
+/**
+ * @brief   Función para habilitar la EEPROM del microcontrolador, donde se guarda el log de estado persistente
+ */
+void EepromInit(void);
+
+/**
+ * @brief   Función para leer de la zona de la EEPROM reservada para el log de estado persistente
+ *
+ * @param   address  Dirección desde el comienzo de la zona reservada
+ * @param   data     Buffer donde se copian los datos leídos
+ * @param   size     Cantidad de bytes a leer
+ * @return           true si la lectura está dentro de la zona reservada, false en caso contrario
+ */
+bool EepromRead(uint32_t address, void * data, uint16_t size);
+
+/**
+ * @brief   Función para escribir en la zona de la EEPROM reservada para el log de estado persistente
+ *
+ * Se reprograma cada página afectada completa, conservando los bytes que no se escriben.
+ *
+ * @param   address  Dirección desde el comienzo de la zona reservada
+ * @param   data     Datos a escribir
+ * @param   size     Cantidad de bytes a escribir
+ * @return           true si los datos quedaron escritos, false en caso contrario
+ */
+bool EepromWrite(uint32_t address, const void * data, uint16_t size);
+
+/**
+ * @brief   Función para borrar un sector de la zona de la EEPROM reservada para el log, dejando sus bytes en 0xFF
+ *
+ * @param   sector   Número de sector, de PERSIST_SECTOR_SIZE bytes
+ * @return           true si el sector está dentro de la zona reservada, false en caso contrario
+ */
+bool EepromErase(uint8_t sector);
+
+/**
+ * @brief   Función para configurar la UART del puerto USB de depuración, con 8 bits de datos, sin paridad y 1 bit de
+ *          parada
+ *
+ * @param   baud     Velocidad en bits por segundo
+ * @param   receive  Función que recibe los bytes desde la interrupción, debe poder llamar a las funciones FromISR
+ */
+void UartInit(uint32_t baud, uart_receive_t receive);
+
+/**
+ * @brief   Función para transmitir por la UART del puerto USB de depuración, espera a que todos los bytes entren en la
+ *          cola de transmisión
+ *
+ * @param   data     Bytes a transmitir
+ * @param   size     Cantidad de bytes
+ */
+void UartWrite(const uint8_t * data, uint16_t size);
+
 /* === End of conditional blocks ================================================================================== */
 
 #ifdef __cplusplus
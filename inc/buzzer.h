@@ -0,0 +1,153 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef BUZZER_H_
+#define BUZZER_H_
+
+/** @file buzzer.h
+ ** @brief Declaraciones del generador de tonos del zumbador
+ **
+ ** Una melodía es una tabla constante de notas (frecuencia, volumen y duración). El controlador genera el tono con
+ ** un temporizador, sin intervención del procesador, y programa otro temporizador que avisa con BuzzerStepElapsed
+ ** desde su interrupción cuando termina la nota. Así, una vez iniciada, la melodía se reproduce completa desde las
+ ** interrupciones y la tarea que la inició no vuelve a intervenir hasta detenerla.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Valor de repeat_from de una melodía que se reproduce una sola vez
+#define BUZZER_NO_REPEAT 0xFF
+
+//! Volumen máximo de una nota, corresponde a una onda cuadrada con ciclo de trabajo del 50%
+#define BUZZER_VOLUME_MAX 100
+
+/* === Public data type declarations ============================================================================== */
+
+//! Nota de una melodía, una frecuencia o un volumen en cero es un silencio
+typedef struct {
+    uint16_t frequency; //!< Frecuencia del tono en Hz
+    uint8_t volume;     //!< Volumen de 0 a BUZZER_VOLUME_MAX
+    uint16_t duration;  //!< Duración de la nota en milisegundos
+} buzzer_note_t;
+
+//! Melodía, se guarda en memoria de programa
+typedef struct buzzer_melody_s {
+    const buzzer_note_t * notes; //!< Notas de la melodía
+    uint8_t count;               //!< Cantidad de notas
+    uint8_t repeat_from;         //!< Nota desde la que se repite al terminar, BUZZER_NO_REPEAT si no se repite
+} const * buzzer_melody_t;
+
+/**
+ * @brief   Puntero a una función que genera un tono en el zumbador, o lo silencia
+ *
+ * @param   frequency  Frecuencia del tono en Hz, cero para silenciar
+ * @param   volume     Volumen de 0 a BUZZER_VOLUME_MAX, cero para silenciar
+ */
+typedef void (*buzzer_tone_t)(uint16_t frequency, uint8_t volume);
+
+/**
+ * @brief   Puntero a una función que programa el temporizador de notas, al vencer se debe llamar a BuzzerStepElapsed
+ *
+ * @param   duration   Milisegundos hasta el final de la nota
+ */
+typedef void (*buzzer_schedule_t)(uint16_t duration);
+
+/**
+ * @brief   Puntero a una función que detiene el temporizador de notas y descarta un vencimiento pendiente
+ */
+typedef void (*buzzer_cancel_t)(void);
+
+/**
+ * @brief   Estructura que representa el controlador del zumbador
+ */
+typedef struct buzzer_driver_s {
+    buzzer_tone_t Tone;
+    buzzer_schedule_t Schedule;
+    buzzer_cancel_t Cancel;
+} const * buzzer_driver_t;
+
+//! Estructura que representa el generador de tonos del zumbador
+typedef struct buzzer_s * buzzer_t;
+
+/* === Public variable declarations =============================================================================== */
+
+//! Pitidos cortos al volumen máximo, en grupos de cuatro, se repite
+extern const struct buzzer_melody_s BUZZER_MELODY_BEEPS;
+
+//! Pitidos que comienzan suaves y suben de volumen, se repite con el volumen máximo
+extern const struct buzzer_melody_s BUZZER_MELODY_ESCALATING;
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Crea el generador de tonos, en silencio.
+ *
+ * @param driver    Controlador del zumbador.
+ * @return          El generador creado, NULL si el controlador no es válido.
+ */
+buzzer_t BuzzerCreate(buzzer_driver_t driver);
+
+/**
+ * @brief           Comienza a reproducir una melodía desde su primera nota, reemplazando la que estuviera sonando.
+ *
+ * @param self      El generador de tonos.
+ * @param melody    Melodía a reproducir.
+ */
+void BuzzerPlay(buzzer_t self, buzzer_melody_t melody);
+
+/**
+ * @brief           Detiene la melodía y silencia el zumbador.
+ *
+ * @param self      El generador de tonos.
+ */
+void BuzzerStop(buzzer_t self);
+
+/**
+ * @brief           Indica si se está reproduciendo una melodía.
+ *
+ * @param self      El generador de tonos.
+ * @return          true si hay una melodía sonando, false si el zumbador está en silencio.
+ */
+bool BuzzerIsPlaying(buzzer_t self);
+
+/**
+ * @brief           Pasa a la siguiente nota de la melodía, se llama desde la interrupción del temporizador de notas.
+ *
+ * @param self      El generador de tonos.
+ */
+void BuzzerStepElapsed(buzzer_t self);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUZZER_H_ */
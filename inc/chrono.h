@@ -0,0 +1,154 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CHRONO_H_
+#define CHRONO_H_
+
+/** @file chrono.h
+ ** @brief Declaraciones del temporizador de cuenta regresiva y del cronómetro
+ **
+ ** Los dos usan el mismo contador libre de ticks que el reloj y no hacen nada en cada tick: al arrancar guardan el
+ ** valor del contador y el tiempo transcurrido se calcula recién cuando se consulta, por ejemplo al refrescar la
+ ** pantalla. Mientras no se muestran no consumen tiempo de procesador aunque estén en marcha.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "clock.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Centésimas de segundo por segundo, unidad de los tiempos del módulo
+#define CHRONO_CENTISECONDS 100
+
+/* === Public data type declarations ============================================================================== */
+
+//! Instancias disponibles, cada una se reserva en memoria estática
+typedef enum {
+    CHRONO_TIMER,     //!< Temporizador de cuenta regresiva
+    CHRONO_STOPWATCH, //!< Cronómetro
+    CHRONO_COUNT,     //!< Cantidad de instancias, no es una instancia válida
+} chrono_kind_t;
+
+//! Estructura que representa un temporizador o un cronómetro
+typedef struct chrono_s * chrono_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief                   Crea un temporizador o un cronómetro detenido y en cero.
+ *
+ * @param kind              Instancia a crear, si ya existía se vuelve a inicializar.
+ * @param get_ticks         Contador libre de ticks, el mismo de la fuente de tiempo del reloj.
+ * @param ticks_per_second  Ticks por segundo del contador.
+ * @return                  El temporizador o cronómetro, NULL si los parámetros no son válidos.
+ */
+chrono_t ChronoCreate(chrono_kind_t kind, source_get_ticks_t get_ticks, uint16_t ticks_per_second);
+
+/**
+ * @brief           Fija la duración de la cuenta regresiva del temporizador, lo detiene y lo vuelve al comienzo.
+ *
+ * @param self      El temporizador.
+ * @param seconds   Duración en segundos.
+ */
+void ChronoSetCountdown(chrono_t self, uint32_t seconds);
+
+/**
+ * @brief       Obtiene la duración de la cuenta regresiva del temporizador.
+ *
+ * @param self  El temporizador.
+ * @return      Duración en segundos, cero para el cronómetro.
+ */
+uint32_t ChronoGetCountdown(chrono_t self);
+
+/**
+ * @brief       Pone en marcha la cuenta, continuando desde el tiempo acumulado. No hace nada si ya está en marcha o si
+ *              el temporizador ya venció.
+ *
+ * @param self  El temporizador o cronómetro.
+ */
+void ChronoStart(chrono_t self);
+
+/**
+ * @brief       Detiene la cuenta, conservando el tiempo acumulado.
+ *
+ * @param self  El temporizador o cronómetro.
+ */
+void ChronoStop(chrono_t self);
+
+/**
+ * @brief       Detiene la cuenta y la vuelve al comienzo: cero en el cronómetro y la duración en el temporizador.
+ *
+ * @param self  El temporizador o cronómetro.
+ */
+void ChronoReset(chrono_t self);
+
+/**
+ * @brief       Indica si la cuenta está en marcha.
+ *
+ * @param self  El temporizador o cronómetro.
+ * @return      true si está en marcha, false si está detenida.
+ */
+bool ChronoIsRunning(chrono_t self);
+
+/**
+ * @brief       Indica si el temporizador llegó a cero.
+ *
+ * @param self  El temporizador.
+ * @return      true si la cuenta regresiva terminó, false en caso contrario y siempre para el cronómetro.
+ */
+bool ChronoExpired(chrono_t self);
+
+/**
+ * @brief       Lee el tiempo de la cuenta: el transcurrido en el cronómetro y el restante en el temporizador.
+ *
+ * @param self  El temporizador o cronómetro.
+ * @return      Tiempo en centésimas de segundo.
+ */
+uint32_t ChronoRead(chrono_t self);
+
+/**
+ * @brief       Convierte el tiempo de la cuenta a los cuatro dígitos de la pantalla.
+ *
+ * El cronómetro muestra segundos y centésimas durante el primer minuto, después minutos y segundos y a partir de la
+ * primera hora horas y minutos. El temporizador muestra minutos y segundos, u horas y minutos si falta más de una
+ * hora, redondeando hacia arriba para que el cero aparezca al vencer.
+ *
+ * @param self  El temporizador o cronómetro.
+ * @param value Dígitos a mostrar, de izquierda a derecha.
+ */
+void ChronoToBCD(chrono_t self, uint8_t value[4]);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHRONO_H_ */
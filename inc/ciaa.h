@@ -96,6 +96,15 @@ extern "C" {
 #define TEC_4_GPIO 1
 #define TEC_4_BIT 9
 
+// UART del puerto USB de depuración (USART2, conectada al FT2232 de la placa)
+#define UART_TXD_PORT 7
+#define UART_TXD_PIN 1
+#define UART_TXD_FUNC SCU_MODE_FUNC6
+
+#define UART_RXD_PORT 7
+#define UART_RXD_PIN 2
+#define UART_RXD_FUNC SCU_MODE_FUNC6
+
 /* === Public data type declarations ============================================================================== */
 
 /* === Public variable declarations =============================================================================== */
@@ -38,6 +38,30 @@ extern "C" {
 
 /* === Public macros definitions ================================================================================== */
 
+//! Año del día 0 de la fecha del reloj
+#define CLOCK_EPOCH_YEAR 1970
+
+//! Último año aceptado, los segundos desde la época del calendario de la fuente deben entrar en 32 bits
+#define CLOCK_MAX_YEAR 2105
+
+//! Máscara de días de la alarma que la hace sonar todos los días, el bit 0 es el domingo
+#define CLOCK_ALARM_EVERY_DAY 0x7F
+
+//! Demora de ClockAlarmDelay cuando la alarma no cambia sin intervención
+#define CLOCK_NO_DEADLINE UINT32_MAX
+
+//! Máxima corrección del oscilador aceptada, en partes por millón
+#define CLOCK_TRIM_LIMIT_PPM 10000
+
+//! Máxima diferencia aceptada entre la hora estándar de una zona y UTC, en minutos
+#define CLOCK_ZONE_LIMIT_MINUTES (14 * 60)
+
+//! Máximo adelanto aceptado del horario de verano, en minutos
+#define CLOCK_DST_LIMIT_MINUTES 120
+
+//! Semana de una regla de cambio de horario que indica la última del mes
+#define CLOCK_DST_LAST_WEEK 5
+
 /* === Public data type declarations ============================================================================== */
 
 /**
@@ -53,11 +77,106 @@ typedef union {
     uint8_t bcd[6];
 } clock_time_t;
 
+/**
+ * @brief Tiempo en BCD empaquetado, dos dígitos por byte: 0x00HHMMSS.
+ * Ocupa una palabra y se incrementa con unas pocas operaciones aritméticas, sin recorrer los dígitos.
+ */
+typedef uint32_t clock_packed_t;
+
+/**
+ * @brief Estructura que representa una fecha del calendario gregoriano.
+ */
+typedef struct {
+    uint16_t year; //!< Año, entre CLOCK_EPOCH_YEAR y CLOCK_MAX_YEAR
+    uint8_t month; //!< Mes, de 1 a 12
+    uint8_t day;   //!< Día del mes, desde 1
+} clock_date_t;
+
+/**
+ * @brief Configuración del aplazamiento de la alarma.
+ *
+ * El aplazamiento n (desde cero) dura minutes - n * step minutos, sin bajar de min_minutes.
+ */
+typedef struct {
+    uint16_t minutes;     //!< Duración del primer aplazamiento en minutos, mayor a cero
+    uint16_t step;        //!< Minutos que se acorta cada aplazamiento siguiente
+    uint16_t min_minutes; //!< Duración mínima de un aplazamiento en minutos, mayor a cero
+    uint8_t limit;        //!< Cantidad máxima de aplazamientos seguidos, cero para no limitarlos
+} clock_snooze_t;
+
+/**
+ * @brief Regla de un cambio de horario, por ejemplo "último domingo de marzo a las 02:00".
+ */
+typedef struct {
+    uint8_t month;    //!< Mes del cambio, de 1 a 12
+    uint8_t week;     //!< Semana del mes, de 1 a 4, o CLOCK_DST_LAST_WEEK para la última
+    uint8_t weekday;  //!< Día de la semana, de 0 para el domingo a 6 para el sábado
+    uint16_t minutes; //!< Minutos desde la medianoche en que ocurre el cambio, en la hora estándar de la zona
+} clock_dst_change_t;
+
+/**
+ * @brief Zona horaria: diferencia de la hora estándar con UTC y reglas del horario de verano.
+ *
+ * Las dos reglas se aplican todos los años, por lo que sirven también para el hemisferio sur, donde el horario de
+ * verano comienza en un año y termina en el siguiente. Una zona con dst_minutes en cero no usa las reglas.
+ */
+typedef struct {
+    int16_t offset_minutes;   //!< Diferencia de la hora estándar con UTC, positiva al este de Greenwich
+    uint8_t dst_minutes;      //!< Adelanto del horario de verano, cero si la zona no lo usa
+    clock_dst_change_t start; //!< Comienzo del horario de verano
+    clock_dst_change_t end;   //!< Fin del horario de verano
+} clock_zone_t;
+
 /**
  * @brief Estructura que representa un reloj.
  */
 typedef struct clock_s * clock_t;
 
+/**
+ * @brief   Puntero a una función que devuelve un contador libre de ticks, en los ticks por segundo del reloj
+ */
+typedef uint32_t (*source_get_ticks_t)(void);
+
+/**
+ * @brief   Puntero a una función que lee los segundos de un calendario mantenido por hardware
+ *
+ * @param   seconds  Segundos transcurridos desde la época (1970-01-01 00:00:00)
+ * @return           true si el hardware tiene una hora válida, false en caso contrario
+ */
+typedef bool (*source_read_seconds_t)(uint32_t * seconds);
+
+/**
+ * @brief   Puntero a una función que escribe los segundos de un calendario mantenido por hardware
+ *
+ * El segundo escrito comienza en el momento de la escritura.
+ *
+ * @param   seconds  Segundos transcurridos desde la época (1970-01-01 00:00:00)
+ */
+typedef void (*source_write_seconds_t)(uint32_t seconds);
+
+/**
+ * @brief   Puntero a una función que entra o sale de la sección crítica que protege los campos del reloj
+ */
+typedef void (*source_critical_t)(void);
+
+/**
+ * @brief   Estructura que representa una fuente de tiempo del reloj
+ *
+ * GetTicks es obligatoria. Si la fuente no tiene calendario (ReadSeconds en NULL) el reloj avanza con los ticks del
+ * contador, aplicando la corrección del oscilador. Si lo tiene, la hora se lee del hardware y los ticks sólo se usan
+ * para interpolar la fracción del segundo en curso; en ese caso la corrección del oscilador no se aplica.
+ *
+ * EnterCritical y ExitCritical son opcionales. Si el reloj se actualiza en una tarea y se ajusta desde otra, delimitan
+ * los cambios de la fecha y la hora para que ninguna tarea los interrumpa a mitad de camino.
+ */
+typedef struct clock_source_s {
+    source_get_ticks_t GetTicks;
+    source_read_seconds_t ReadSeconds;
+    source_write_seconds_t WriteSeconds;
+    source_critical_t EnterCritical;
+    source_critical_t ExitCritical;
+} const * clock_source_t;
+
 /* === Public variable declarations =============================================================================== */
 
 /* === Public function declarations =============================================================================== */
@@ -70,11 +189,41 @@ typedef struct clock_s * clock_t;
 clock_t ClockCreate(uint16_t ticks_per_seconds);
 
 /**
- * @brief           Verifica si el tiempo del reloj es válido.
+ * @brief           Verifica si el tiempo del reloj es válido, sin saltos: compara los seis dígitos a la vez.
  * @param new_time  Estructura que contiene el nuevo tiempo a verificar.
  * @return          true si el tiempo es válido, false en caso contrario.
  */
-bool ClockTimeIsValid(clock_time_t * new_time);
+bool ClockTimeIsValid(const clock_time_t * new_time);
+
+/**
+ * @brief           Verifica un arreglo de tiempos, por ejemplo al importar una lista de alarmas.
+ * @param times     Arreglo de tiempos a verificar.
+ * @param count     Cantidad de tiempos del arreglo.
+ * @return          Índice del primer tiempo inválido, o count si todos son válidos.
+ */
+uint16_t ClockTimesAreValid(const clock_time_t * times, uint16_t count);
+
+/**
+ * @brief           Convierte un tiempo a BCD empaquetado.
+ * @param time      Tiempo con un dígito por byte.
+ * @return          El tiempo empaquetado.
+ */
+clock_packed_t ClockTimePack(const clock_time_t * time);
+
+/**
+ * @brief           Convierte un tiempo en BCD empaquetado al formato de un dígito por byte.
+ * @param packed    Tiempo empaquetado.
+ * @param time      Puntero donde se almacenará el tiempo.
+ */
+void ClockTimeUnpack(clock_packed_t packed, clock_time_t * time);
+
+/**
+ * @brief           Avanza un segundo un tiempo válido en BCD empaquetado, propagando el acarreo por todos los campos.
+ * @param packed    Tiempo empaquetado a incrementar.
+ * @param next_day  Puntero donde se indica si el tiempo pasó de 23:59:59 a 00:00:00, puede ser NULL.
+ * @return          El tiempo incrementado.
+ */
+clock_packed_t ClockPackedIncrement(clock_packed_t packed, bool * next_day);
 
 /**
  * @brief        Obtiene el tiempo actual del reloj.
@@ -88,7 +237,7 @@ bool ClockGetTime(clock_t clock, clock_time_t * result);
  * @brief           Establece el tiempo del reloj.
  * @param clock     El reloj donde se establecerá el nuevo tiempo.
  * @param new_time  Puntero al nuevo tiempo a establecer.
- * @return          true si se estableció el tiempo correctamente, false en caso contrario.
+ * @return          true si se estableció el tiempo, false si el tiempo es inválido y el reloj no cambió.
  */
 bool ClockSetTime(clock_t clock, const clock_time_t * new_time);
 
@@ -98,6 +247,211 @@ bool ClockSetTime(clock_t clock, const clock_time_t * new_time);
  */
 void ClockNewTick(clock_t clock);
 
+/**
+ * @brief       Avanza el reloj varios ticks de una vez, con el mismo resultado que llamar a ClockNewTick por cada uno.
+ * @param clock El reloj a avanzar.
+ * @param ticks Cantidad de ticks a avanzar.
+ */
+void ClockAdvance(clock_t clock, uint32_t ticks);
+
+/**
+ * @brief         Avanza el reloj hasta el valor actual de un contador libre de ticks (por ejemplo xTaskGetTickCount).
+ *
+ * El reloj avanza los ticks transcurridos desde la sincronización anterior, por lo que no se pierden ticks aunque
+ * las llamadas se demoren o se hagan con poca frecuencia. El contador se supone en cero al crear el reloj y puede
+ * desbordar, siempre que entre dos llamadas transcurran menos de 2^32 ticks.
+ *
+ * @param clock   El reloj a avanzar.
+ * @param counter Valor actual del contador libre de ticks.
+ * @return        Cantidad de ticks avanzados.
+ */
+uint32_t ClockSync(clock_t clock, uint32_t counter);
+
+/**
+ * @brief        Asocia una fuente de tiempo al reloj y toma la hora de su calendario, si lo tiene.
+ * @param clock  El reloj.
+ * @param source La fuente de tiempo, NULL para avanzar el reloj con ClockNewTick o ClockSync.
+ */
+void ClockAttachSource(clock_t clock, clock_source_t source);
+
+/**
+ * @brief        Actualiza el reloj desde su fuente de tiempo.
+ * @param clock  El reloj a actualizar.
+ * @return       Ticks del contador de la fuente transcurridos desde la actualización anterior, 0 si no hay fuente.
+ */
+uint32_t ClockRefresh(clock_t clock);
+
+/**
+ * @brief        Indica si la hora la mantiene el calendario de la fuente de tiempo.
+ * @param clock  El reloj a consultar.
+ * @return       true si la fuente tiene calendario y la corrección del oscilador no se aplica, false si no.
+ */
+bool ClockHasCalendar(clock_t clock);
+
+/**
+ * @brief        Obtiene la fracción transcurrida del segundo en curso.
+ * @param clock  El reloj a consultar.
+ * @return       Ticks transcurridos desde el comienzo del segundo actual.
+ */
+uint16_t ClockGetSubsecond(clock_t clock);
+
+/**
+ * @brief        Obtiene el instante actual en UTC con resolución de milisegundos, para sincronizar el reloj.
+ *
+ * Incluye los ticks de la fuente de tiempo que todavía no se contaron, por lo que no depende de la frecuencia con la
+ * que se llama a ClockRefresh; esos ticks se toman sin la corrección del oscilador.
+ *
+ * @param clock  El reloj a consultar.
+ * @return       Milisegundos UTC desde la época.
+ */
+uint64_t ClockGetUtcMillis(clock_t clock);
+
+/**
+ * @brief        Ajusta el instante actual en UTC con resolución de milisegundos y lo escribe en la fuente de tiempo.
+ *
+ * El calendario de la fuente sólo guarda segundos enteros: se escribe enseguida y se vuelve a escribir cuando comienza
+ * el segundo siguiente, así conserva la fracción con el error de la demora entre llamadas a ClockRefresh.
+ *
+ * @param clock  El reloj a ajustar.
+ * @param millis Milisegundos UTC desde la época.
+ * @return       true si se ajustó el reloj, false si el instante está fuera del rango de fechas del reloj.
+ */
+bool ClockSetUtcMillis(clock_t clock, uint64_t millis);
+
+/**
+ * @brief       Establece la corrección de la frecuencia del oscilador que genera los ticks.
+ *
+ * La corrección se aplica agregando (ppm positivo, el oscilador atrasa) o descartando (ppm negativo, el oscilador
+ * adelanta) un tick cada 10^6 / |ppm| ticks, por lo que el error residual es la parte fraccionaria de la corrección.
+ *
+ * @param clock El reloj a corregir.
+ * @param ppm   Corrección en partes por millón, entre -CLOCK_TRIM_LIMIT_PPM y CLOCK_TRIM_LIMIT_PPM.
+ * @return      true si se estableció la corrección, false si está fuera de rango.
+ */
+bool ClockSetTrim(clock_t clock, int32_t ppm);
+
+/**
+ * @brief       Obtiene la corrección de la frecuencia del oscilador, sin la corrección transitoria.
+ * @param clock El reloj a consultar.
+ * @return      Corrección en partes por millón.
+ */
+int32_t ClockGetTrim(clock_t clock);
+
+/**
+ * @brief       Establece una corrección transitoria que se suma a la del oscilador, para recuperar una diferencia.
+ *
+ * La suma de las dos se limita a CLOCK_TRIM_LIMIT_PPM. ClockGetTrim no la incluye, así no se guarda como corrección
+ * permanente del oscilador.
+ *
+ * @param clock El reloj a corregir.
+ * @param ppm   Corrección en partes por millón, entre -CLOCK_TRIM_LIMIT_PPM y CLOCK_TRIM_LIMIT_PPM, 0 para quitarla.
+ * @return      true si se estableció la corrección, false si está fuera de rango.
+ */
+bool ClockSetSlew(clock_t clock, int32_t ppm);
+
+/**
+ * @brief       Obtiene la corrección transitoria.
+ * @param clock El reloj a consultar.
+ * @return      Corrección en partes por millón.
+ */
+int32_t ClockGetSlew(clock_t clock);
+
+/**
+ * @brief                 Calcula y establece la corrección a partir de una medición contra una referencia externa.
+ * @param clock           El reloj a calibrar.
+ * @param measured_ticks  Ticks del oscilador, sin corrección, contados durante el intervalo de medición.
+ * @param reference_ticks Duración real del mismo intervalo, en ticks nominales, según la referencia.
+ * @return                true si se estableció la corrección, false si la medición no es válida o está fuera de rango.
+ */
+bool ClockCalibrate(clock_t clock, uint32_t measured_ticks, uint32_t reference_ticks);
+
+/**
+ * @brief       Indica si un año es bisiesto.
+ * @param year  El año.
+ * @return      true si el año es bisiesto, false en caso contrario.
+ */
+bool ClockIsLeapYear(uint16_t year);
+
+/**
+ * @brief       Obtiene la cantidad de días de un mes, sin tablas ni saltos salvo para febrero.
+ * @param year  El año.
+ * @param month El mes, de 1 a 12.
+ * @return      Cantidad de días del mes.
+ */
+uint8_t ClockDaysInMonth(uint16_t year, uint8_t month);
+
+/**
+ * @brief       Verifica si una fecha existe y está en el rango aceptado.
+ * @param date  La fecha a verificar.
+ * @return      true si la fecha es válida, false en caso contrario.
+ */
+bool ClockDateIsValid(const clock_date_t * date);
+
+/**
+ * @brief       Convierte una fecha válida a días desde la época, en tiempo constante.
+ * @param date  La fecha a convertir.
+ * @return      Días transcurridos desde el 1970-01-01.
+ */
+uint32_t ClockDateToDays(const clock_date_t * date);
+
+/**
+ * @brief       Convierte días desde la época a una fecha, en tiempo constante.
+ * @param days  Días transcurridos desde el 1970-01-01.
+ * @param date  La fecha convertida.
+ */
+void ClockDaysToDate(uint32_t days, clock_date_t * date);
+
+/**
+ * @brief       Obtiene el día de la semana de una fecha expresada en días desde la época.
+ * @param days  Días transcurridos desde el 1970-01-01.
+ * @return      Día de la semana, de 0 para el domingo a 6 para el sábado.
+ */
+uint8_t ClockDaysToWeekday(uint32_t days);
+
+/**
+ * @brief       Establece la fecha del reloj sin modificar la hora.
+ * @param clock El reloj.
+ * @param date  La nueva fecha.
+ * @return      true si la fecha es válida y se estableció, false en caso contrario.
+ */
+bool ClockSetDate(clock_t clock, const clock_date_t * date);
+
+/**
+ * @brief       Obtiene la fecha actual del reloj, que avanza al pasar la medianoche.
+ * @param clock El reloj.
+ * @param date  Puntero donde se almacenará la fecha actual.
+ * @return      true si el reloj tiene una hora válida, false en caso contrario.
+ */
+bool ClockGetDate(clock_t clock, clock_date_t * date);
+
+/**
+ * @brief       Obtiene el día de la semana actual del reloj.
+ * @param clock El reloj.
+ * @return      Día de la semana, de 0 para el domingo a 6 para el sábado.
+ */
+uint8_t ClockGetWeekday(clock_t clock);
+
+/**
+ * @brief       Establece la zona horaria del reloj, por defecto UTC sin horario de verano.
+ *
+ * El reloj cuenta en UTC, que es lo que guarda el calendario de la fuente, y la zona se aplica al leer: la hora, la
+ * fecha, el día de la semana y la alarma son locales. El próximo cambio de horario se calcula por adelantado, por lo
+ * que cada lectura sólo compara con ese instante y suma la diferencia vigente. Al cambiar la zona la hora UTC se
+ * conserva y la hora local cambia.
+ *
+ * @param clock El reloj.
+ * @param zone  La zona horaria, NULL para volver a UTC.
+ * @return      true si se estableció la zona, false si la diferencia o alguna regla está fuera de rango.
+ */
+bool ClockSetZone(clock_t clock, const clock_zone_t * zone);
+
+/**
+ * @brief       Obtiene la diferencia vigente entre la hora local y UTC, incluido el horario de verano.
+ * @param clock El reloj.
+ * @return      Diferencia en minutos, positiva al este de Greenwich.
+ */
+int16_t ClockGetUtcOffset(clock_t clock);
+
 /**
  * @brief           Habilita o deshabilita la alarma del reloj.
  * @param clock     El reloj al que se le habilitará o deshabilitará la alarma.
@@ -114,6 +468,20 @@ bool ClockEnableAlarm(clock_t clock, bool enable);
  */
 bool ClockSetAlarm(clock_t clock, const clock_time_t * alarm_time);
 
+/**
+ * @brief           Establece los días de la semana en los que suena la alarma, por defecto todos.
+ * @param clock     El reloj al que se le establecerán los días de la alarma.
+ * @param weekdays  Máscara de días, el bit 0 es el domingo y el bit 6 el sábado.
+ */
+void ClockSetAlarmWeekdays(clock_t clock, uint8_t weekdays);
+
+/**
+ * @brief           Obtiene los días de la semana en los que suena la alarma.
+ * @param clock     El reloj a consultar.
+ * @return          Máscara de días, el bit 0 es el domingo y el bit 6 el sábado.
+ */
+uint8_t ClockGetAlarmWeekdays(clock_t clock);
+
 /**
  * @brief           Comprueba si la alarma del reloj ha sonado.
  * @param clock     El reloj a verificar.
@@ -122,15 +490,64 @@ bool ClockSetAlarm(clock_t clock, const clock_time_t * alarm_time);
 bool ClockCheckAlarm(clock_t clock);
 
 /**
- * @brief           Pospone la alarma del reloj por una cantidad de minutos.
+ * @brief           Calcula cuánto falta para que ClockCheckAlarm pueda cambiar de resultado.
+ *
+ * Cuenta hasta el minuto de la alarma, el vencimiento del aplazamiento o el aplazamiento automático de la alarma que
+ * suena, y hasta el próximo cambio de horario, que mueve el minuto de la alarma. Vale sólo mientras no se ajuste el
+ * reloj ni la alarma.
+ *
+ * @param clock     El reloj a consultar.
+ * @return          Ticks hasta el próximo vencimiento, CLOCK_NO_DEADLINE si no hay ninguno.
+ */
+uint32_t ClockAlarmDelay(clock_t clock);
+
+/**
+ * @brief           Pospone la alarma del reloj por una cantidad de minutos, contados desde la hora actual.
+ *
+ * La alarma deja de sonar y vuelve a sonar al vencer el plazo, aunque cruce la medianoche. La hora de la alarma no
+ * cambia, por lo que al día siguiente suena a la hora ajustada.
+ *
  * @param clock     El reloj al que se le pospondrá la alarma.
  * @param minutes   Cantidad de minutos para posponer la alarma.
- * @return          true si se pospuso la alarma correctamente, false en caso contrario.
+ * @return          true si se pospuso la alarma, false si minutes es cero o se alcanzó el límite de aplazamientos.
  */
 bool ClockPostponeAlarm(clock_t clock, uint16_t minutes);
 
 /**
- * @brief           Detiene manualmente la alarma que está sonando.
+ * @brief           Establece la configuración del aplazamiento de la alarma, por defecto 5 minutos sin límite.
+ * @param clock     El reloj a configurar.
+ * @param snooze    Configuración del aplazamiento.
+ * @return          true si se aceptó la configuración, false si alguna duración es cero.
+ */
+bool ClockSetSnooze(clock_t clock, const clock_snooze_t * snooze);
+
+/**
+ * @brief           Pospone la alarma con la duración configurada para el próximo aplazamiento.
+ * @param clock     El reloj al que se le pospondrá la alarma.
+ * @return          true si se pospuso la alarma, false si se alcanzó el límite de aplazamientos.
+ */
+bool ClockSnoozeAlarm(clock_t clock);
+
+/**
+ * @brief           Establece cuánto suena la alarma sin que nadie la atienda, por defecto suena hasta que se atiende.
+ *
+ * Al vencer el tiempo la alarma se aplaza sola, como con ClockSnoozeAlarm. Si ya se alcanzó el límite de
+ * aplazamientos se detiene hasta la próxima vez, por lo que una alarma desatendida termina apagándose.
+ *
+ * @param clock     El reloj a configurar.
+ * @param seconds   Segundos que suena la alarma cada vez, cero para que suene hasta que se atienda.
+ */
+void ClockSetRingTimeout(clock_t clock, uint16_t seconds);
+
+/**
+ * @brief           Obtiene la cantidad de aplazamientos desde que la alarma sonó a la hora ajustada.
+ * @param clock     El reloj a consultar.
+ * @return          Cantidad de aplazamientos, vuelve a cero cuando la alarma se detiene o suena otro día.
+ */
+uint8_t ClockGetSnoozeCount(clock_t clock);
+
+/**
+ * @brief           Detiene manualmente la alarma que está sonando y descarta el aplazamiento pendiente.
  * @param clock     El reloj cuya alarma se quiere detener.
  */
 void ClockStopAlarm(clock_t clock);
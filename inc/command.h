@@ -0,0 +1,167 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+/** @file command.h
+ ** @brief Declaraciones de los comandos del reloj por el enlace serie
+ **
+ ** Permite ajustar el reloj en la fabricación sin recorrer los modos con los botones. Cada comando se responde con
+ ** una trama con el mismo comando más COMMAND_REPLY o, si no se pudo ejecutar, con una trama COMMAND_ERROR cuyos datos
+ ** son el comando recibido y el motivo. Los números de más de un byte se transmiten con el byte bajo primero.
+ **
+ ** - COMMAND_PING: sin datos, responde la versión del protocolo.
+ ** - COMMAND_GET_TIME: sin datos, responde el año (2 bytes), mes, día, hora, minutos, segundos, día de la semana y 1
+ **   si la hora es válida.
+ ** - COMMAND_SET_TIME: año (2 bytes), mes, día, hora, minutos y segundos; responde sin datos.
+ ** - COMMAND_GET_ALARM: sin datos, responde la hora, los minutos, los días de la semana y 1 si está habilitada.
+ ** - COMMAND_SET_ALARM: hora, minutos, días de la semana y 1 para habilitarla; responde sin datos.
+ ** - COMMAND_GET_STATS: sin datos, responde los contadores del enlace (bytes recibidos y descartados, tramas y tramas
+ **   con error), las trazas sobrescritas sin leerse, todos de 4 bytes, la corrección del oscilador en ppm (4 bytes con
+ **   signo) y las milésimas de tiempo inactivo del procesador en el último segundo y en el peor segundo, de 4 bytes y
+ **   IDLE_UNKNOWN si no se midieron.
+ ** - COMMAND_SYNC: es el único pedido que envía el reloj, con su instante UTC en milisegundos (8 bytes); la PC
+ **   responde ese instante, el instante en que recibió el pedido y el instante en que responde, según su hora y con
+ **   8 bytes cada uno (ver timesync.h).
+ **
+ ** La fecha y la hora son locales, en la zona horaria del reloj.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "app.h"
+#include "clock.h"
+#include "idle.h"
+#include "serial.h"
+#include "timesync.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Versión del protocolo, cambia cuando cambia el formato de algún comando
+#define COMMAND_VERSION 1
+
+//! Se suma al comando en la trama de respuesta
+#define COMMAND_REPLY 0x80
+
+//! Comando de la trama que responde a un pedido que no se pudo ejecutar
+#define COMMAND_ERROR 0xFF
+
+/* === Public data type declarations ============================================================================== */
+
+//! Comandos que acepta el reloj
+typedef enum {
+    COMMAND_PING = 0x01,      //!< Verifica el enlace
+    COMMAND_GET_TIME = 0x02,  //!< Lee la fecha y la hora
+    COMMAND_SET_TIME = 0x03,  //!< Ajusta la fecha y la hora
+    COMMAND_GET_ALARM = 0x04, //!< Lee la alarma
+    COMMAND_SET_ALARM = 0x05, //!< Ajusta la alarma
+    COMMAND_GET_STATS = 0x06, //!< Lee los contadores del enlace y de las trazas
+    COMMAND_SYNC = 0x07,      //!< Pedido de sincronización de la hora, del reloj hacia la PC
+    COMMAND_COUNT,            //!< Cantidad de comandos, no es un comando válido
+} command_id_t;
+
+//! Motivos de una respuesta COMMAND_ERROR
+typedef enum {
+    COMMAND_ERROR_UNKNOWN = 1, //!< El comando no existe
+    COMMAND_ERROR_LENGTH,      //!< Los datos no tienen la longitud del comando
+    COMMAND_ERROR_VALUE,       //!< Algún valor está fuera de rango
+} command_error_t;
+
+//! Estructura que representa el intérprete de comandos
+typedef struct command_s * command_t;
+
+//! Pide a la tarea que atiende la aplicación que llame a CommandApply y espera a que termine
+typedef void (*command_defer_t)(void);
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Crea el intérprete de comandos.
+ *
+ * @param serial    Enlace serie por el que llegan los pedidos y se envían las respuestas.
+ * @param app       Aplicación que se ajusta con los comandos.
+ * @param clock     Reloj de la aplicación.
+ * @return          El intérprete creado.
+ */
+command_t CommandCreate(serial_t serial, app_t app, clock_t clock);
+
+/**
+ * @brief           Asocia el cliente de sincronización que recibe las respuestas a los pedidos COMMAND_SYNC.
+ *
+ * @param self      El intérprete.
+ * @param sync      El cliente, NULL para descartar esas respuestas.
+ */
+void CommandAttachSync(command_t self, timesync_t sync);
+
+/**
+ * @brief           Asocia la tarea inactiva cuyo tiempo inactivo se informa en COMMAND_GET_STATS.
+ *
+ * @param self      El intérprete.
+ * @param idle      La tarea inactiva, NULL si no se mide.
+ */
+void CommandAttachIdle(command_t self, idle_t idle);
+
+/**
+ * @brief           Asocia la función que traslada los ajustes de la aplicación (COMMAND_SET_TIME y COMMAND_SET_ALARM)
+ *                  a la tarea que la atiende.
+ *
+ * @param self      El intérprete.
+ * @param defer     La función, NULL para ejecutar los ajustes en la tarea de los comandos.
+ */
+void CommandAttachDefer(command_t self, command_defer_t defer);
+
+/**
+ * @brief       Ejecuta y responde todos los pedidos completos recibidos por el enlace.
+ *
+ * Se llama desde la tarea de los comandos cuando llegan bytes. Los pedidos que sólo leen se ejecutan en esa tarea;
+ * los que ajustan la aplicación se trasladan con la función asociada y se responden cuando terminan. Las respuestas
+ * a los pedidos de sincronización se entregan al cliente asociado y no se responden.
+ *
+ * @param self  El intérprete.
+ * @return      Cantidad de pedidos y respuestas atendidos.
+ */
+uint16_t CommandProcess(command_t self);
+
+/**
+ * @brief       Ejecuta el ajuste de la aplicación que espera CommandProcess, si hay uno.
+ *
+ * Se llama desde la tarea que atiende la aplicación, entre dos eventos, a pedido de la función asociada con
+ * CommandAttachDefer.
+ *
+ * @param self  El intérprete.
+ */
+void CommandApply(command_t self);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMAND_H_ */
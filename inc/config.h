@@ -38,6 +38,79 @@ extern "C" {
 
 #define CONFIG_TIMEOUT_TICKS       (30 * TICKS_PER_SECOND)
 
+//! Período de ClockTask, el reloj se sincroniza con el contador de ticks por lo que no pierde tiempo si se demora
+#define CLOCK_TASK_PERIOD_TICKS    (TICKS_PER_SECOND / 10)
+
+//! Período de actualización de la pantalla en modo de visualización
+#define DISPLAY_UPDATE_TICKS       (TICKS_PER_SECOND / 10)
+
+//! Período de actualización de la pantalla del cronómetro, muestra centésimas de segundo
+#define STOPWATCH_UPDATE_TICKS     (TICKS_PER_SECOND / 100)
+
+//! Duración inicial del temporizador de cuenta regresiva
+#define TIMER_DEFAULT_MINUTES      5
+
+//! Usa el RTC del microcontrolador como calendario del reloj, en lugar de contar los ticks del sistema
+#ifndef CLOCK_USE_RTC
+#define CLOCK_USE_RTC              1
+#endif
+
+//! Corrección del cristal de la placa en partes por millón, obtenida con ClockCalibrate
+#ifndef CLOCK_TRIM_PPM
+#define CLOCK_TRIM_PPM             0
+#endif
+
+//! Zona horaria del reloj (ver clock_zone_t), el calendario del RTC guarda UTC cuando difiere de cero
+#ifndef CLOCK_ZONE
+#define CLOCK_ZONE                 {.offset_minutes = 0, .dst_minutes = 0}
+#endif
+
+//! Duración del primer aplazamiento de la alarma
+#define ALARM_SNOOZE_MINUTES       5
+
+//! Minutos que se acorta cada aplazamiento siguiente de la alarma
+#define ALARM_SNOOZE_STEP_MINUTES  1
+
+//! Duración mínima de un aplazamiento de la alarma
+#define ALARM_SNOOZE_MIN_MINUTES   2
+
+//! Aplazamientos seguidos permitidos, al aceptar otra vez la alarma se detiene hasta la próxima vez
+#define ALARM_SNOOZE_LIMIT         3
+
+//! Segundos que suena la alarma sin atender antes de aplazarse sola, agotados los aplazamientos se detiene
+#define ALARM_RING_SECONDS         60
+
+//! Tamaño de cada sector del log de estado persistente en la EEPROM, cuatro páginas
+#define PERSIST_SECTOR_SIZE        512
+
+//! Cantidad de sectores del log de estado persistente, se usan desde el comienzo de la EEPROM
+#define PERSIST_SECTORS            4
+
+//! Velocidad del enlace serie de comandos, por el puerto USB de depuración
+#define SERIAL_BAUD_RATE           115200
+
+//! Segundos entre pedidos de sincronización de la hora a la PC por el enlace serie, 0 para no sincronizar
+#define TIMESYNC_INTERVAL_SECONDS  64
+
+//! Período de la tarea periódica de la aplicación mientras suena la alarma, sin ella sólo se llama al vencer un plazo
+#define APP_POLL_TICKS             (TICKS_PER_SECOND / 10)
+
+//! Cantidad de salidas digitales que se pueden crear, se reservan en memoria estática
+#define DIGITAL_OUTPUTS_MAX        3
+
+//! Cantidad de entradas digitales que se pueden crear, se reservan en memoria estática
+#define DIGITAL_INPUTS_MAX         6
+
+//! Cuenta las escrituras pedidas y realizadas en las salidas digitales, para medir las que se evitan
+#ifndef DIGITAL_OUTPUT_STATS
+#define DIGITAL_OUTPUT_STATS       0
+#endif
+
+//! Se llama una vez con los microsegundos desde el comienzo de main hasta el primer refresco de la pantalla
+#ifndef BOOT_TIME_HOOK
+#define BOOT_TIME_HOOK(us)         ((void)(us))
+#endif
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
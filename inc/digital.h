@@ -52,6 +52,12 @@ typedef enum digital_states_e {
     DIGITAL_INPUT_WAS_ACTIVATED = 1,
 } digital_states_t;
 
+//! Contadores de escrituras de las salidas digitales, se habilitan con DIGITAL_OUTPUT_STATS en config.h
+typedef struct {
+    uint32_t requested; //!< Cambios de estado pedidos, uno por salida
+    uint32_t written;   //!< Escrituras realizadas en los registros del GPIO
+} digital_output_stats_t;
+
 /* === Public variable declarations =============================================================================== */
 
 /* === Public function declarations =============================================================================== */
@@ -62,7 +68,7 @@ typedef enum digital_states_e {
  * @param port  Puerto de la salida digital
  * @param pin   Pin de la salida digital
  * @param active_high  Indica si la salida es activa en bajo (false) o en alto (true)
- * @return      Estructura que representa la salida digital
+ * @return      Estructura que representa la salida digital, NULL si ya se crearon DIGITAL_OUTPUTS_MAX salidas
 */
 digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin, bool active_high);
 
@@ -87,6 +93,36 @@ void DigitalOutputDeactivate(digital_output_t self);
 */
 void DigitalOutputToggle(digital_output_t self);
 
+/**
+ * @brief   Función para obtener el estado lógico de una salida digital
+ *
+ * @param self  Estructura que representa la salida digital
+ * @return      true si la salida está activa, false en caso contrario
+*/
+bool DigitalOutputGetState(digital_output_t self);
+
+/**
+ * @brief   Función para cambiar juntas varias salidas digitales, escribiendo sólo las que cambian de estado
+ *
+ * Las salidas que cambian se agrupan por puerto, con una escritura por puerto para cada nivel.
+ *
+ * @param group    Arreglo de salidas digitales, hasta 32
+ * @param count    Cantidad de salidas del arreglo
+ * @param mask     Salidas a actualizar, el bit n corresponde a group[n]
+ * @param states   Estados lógicos de las salidas, el bit n en uno activa group[n]
+*/
+void DigitalOutputGroupWrite(const digital_output_t * group, uint8_t count, uint32_t mask, uint32_t states);
+
+/**
+ * @brief   Función para obtener los contadores de escrituras de las salidas digitales
+ *
+ * La diferencia entre los cambios pedidos y las escrituras realizadas son las escrituras evitadas. Si los contadores
+ * no están habilitados se obtienen en cero.
+ *
+ * @param stats  Estructura donde se copian los contadores
+*/
+void DigitalOutputGetStats(digital_output_stats_t * stats);
+
 /**
     * @brief   Función para crear una entrada digital
     *
@@ -94,7 +130,7 @@ void DigitalOutputToggle(digital_output_t self);
     * @param pin   Pin de la entrada digital
     * @param inverted Indica si la entrada está invertida
     * @note   Si inverted es true, la entrada se considera activa cuando el pin está en estado bajo
-    * @return      Estructura que representa la entrada digital
+    * @return      Estructura que representa la entrada digital, NULL si ya se crearon DIGITAL_INPUTS_MAX entradas
     */
 digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted);
 
@@ -128,7 +164,7 @@ bool DigitalInputWasDeactivated(digital_input_t input);
  * @param input  Estructura que representa la entrada digital
  * @return       Estado de la entrada digital
 */
-enum digital_states_t DigitalWasChanged(digital_input_t input);
+digital_states_t DigitalInputWasChanged(digital_input_t input);
 
 /* === End of conditional blocks ================================================================================== */
 
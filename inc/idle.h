@@ -0,0 +1,139 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef IDLE_H_
+#define IDLE_H_
+
+/** @file idle.h
+ ** @brief Declaraciones de las tareas de mantenimiento y del ahorro de energía de la tarea inactiva
+ **
+ ** Cada vez que el planificador no tiene otra tarea lista ejecuta el gancho de la tarea inactiva, que corre uno de
+ ** los trabajos diferidos registrados (por turno, así ninguno demora a los demás) y después duerme el procesador
+ ** hasta la próxima interrupción. Los trabajos son de baja prioridad y no se pueden bloquear.
+ **
+ ** El controlador mide cuánto durmió el procesador con las interrupciones enmascaradas, de modo que la medición
+ ** termina al despertar y no incluye el tiempo de las interrupciones ni de las tareas que se ejecutan después. Con
+ ** esa medición se calcula en cada segundo la fracción del tiempo en que el procesador estuvo inactivo: es el margen
+ ** que le queda a la aplicación.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad máxima de trabajos diferidos
+#ifndef IDLE_JOBS_MAX
+#define IDLE_JOBS_MAX 4
+#endif
+
+//! Valor de idle_permille antes de completar el primer segundo de medición
+#define IDLE_UNKNOWN 0xFFFF
+
+/* === Public data type declarations ============================================================================== */
+
+//! Función que ejecuta un trabajo diferido, debe terminar rápido y sin bloquearse
+typedef void (*idle_job_t)(void);
+
+/**
+ * @brief   Puntero a una función que lee un contador libre de ciclos del procesador
+ *
+ * @return  Valor actual del contador, puede desbordar
+ */
+typedef uint32_t (*idle_now_t)(void);
+
+/**
+ * @brief   Puntero a una función que duerme el procesador hasta la próxima interrupción
+ *
+ * @return  Ciclos que durmió, medidos con las interrupciones enmascaradas hasta el momento de despertar
+ */
+typedef uint32_t (*idle_sleep_t)(void);
+
+/**
+ * @brief   Estructura que representa el controlador del procesador para la tarea inactiva
+ */
+typedef struct idle_driver_s {
+    idle_now_t Now;
+    idle_sleep_t Sleep;
+    uint32_t cycles_per_second; //!< Ciclos del contador por segundo, duración de cada ventana de medición
+} const * idle_driver_t;
+
+//! Estadísticas de la tarea inactiva
+typedef struct {
+    uint16_t idle_permille;     //!< Milésimas del último segundo en que el procesador durmió, o IDLE_UNKNOWN
+    uint16_t min_idle_permille; //!< Menor valor de idle_permille desde la creación, o IDLE_UNKNOWN
+    uint32_t seconds;           //!< Cantidad de segundos medidos
+    uint32_t sleeps;            //!< Cantidad de veces que durmió el procesador
+} idle_stats_t;
+
+//! Estructura que representa la tarea inactiva
+typedef struct idle_s * idle_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Crea la tarea inactiva sin trabajos diferidos y comienza el primer segundo de medición.
+ *
+ * @param driver    Controlador del procesador.
+ * @return          La tarea inactiva, NULL si el controlador no es válido.
+ */
+idle_t IdleCreate(idle_driver_t driver);
+
+/**
+ * @brief           Registra un trabajo diferido que se ejecuta por turno en la tarea inactiva.
+ *
+ * @param self      La tarea inactiva.
+ * @param job       El trabajo.
+ * @return          true si se registró, false si ya hay IDLE_JOBS_MAX trabajos o los parámetros no son válidos.
+ */
+bool IdleAttachJob(idle_t self, idle_job_t job);
+
+/**
+ * @brief           Ejecuta el siguiente trabajo diferido y duerme el procesador, se llama desde el gancho de la tarea
+ *                  inactiva.
+ *
+ * @param self      La tarea inactiva.
+ */
+void IdleHook(idle_t self);
+
+/**
+ * @brief           Obtiene las estadísticas de la tarea inactiva.
+ *
+ * @param self      La tarea inactiva, con NULL todas las estadísticas son desconocidas.
+ * @param stats     Estadísticas.
+ */
+void IdleGetStats(idle_t self, idle_stats_t * stats);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IDLE_H_ */
@@ -0,0 +1,139 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PERSIST_H_
+#define PERSIST_H_
+
+/** @file persist.h
+ ** @brief Declaraciones del almacenamiento persistente del estado del reloj
+ **
+ ** El estado se guarda como un registro de 16 bytes que se agrega al final de un log en una memoria no volátil
+ ** (flash o EEPROM) dividida en sectores. Los registros nunca se sobrescriben: cuando el sector en uso se llena se
+ ** borra el siguiente, en forma circular, con lo que el desgaste se reparte entre todos los sectores. Cada registro
+ ** lleva un número de secuencia y una suma de verificación, por lo que un corte de alimentación durante una escritura
+ ** sólo pierde el último registro. Al arrancar se lee el primer registro de cada sector para encontrar el sector en
+ ** uso y se busca en forma binaria el último registro escrito, por lo que la cantidad de lecturas está acotada y no
+ ** depende de cuántos registros se hayan guardado.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Bit de las opciones del estado que indica que la alarma está habilitada
+#define PERSIST_ALARM_ENABLED 0x01
+
+/* === Public data type declarations ============================================================================== */
+
+//! Estado persistente del reloj, ocupa 8 bytes
+typedef struct {
+    int32_t trim_ppm;       //!< Corrección del oscilador en partes por millón
+    uint16_t alarm_minutes; //!< Hora de la alarma en minutos desde las 00:00
+    uint8_t alarm_weekdays; //!< Días de la semana en los que suena la alarma, el bit 0 es el domingo
+    uint8_t flags;          //!< Opciones, ver PERSIST_ALARM_ENABLED
+} persist_state_t;
+
+/**
+ * @brief   Puntero a una función que lee de la memoria no volátil
+ *
+ * @param   address  Dirección desde el comienzo de la zona reservada para el log
+ * @param   data     Buffer donde se copian los datos leídos
+ * @param   size     Cantidad de bytes a leer
+ * @return           true si se pudo leer, false en caso contrario
+ */
+typedef bool (*storage_read_t)(uint32_t address, void * data, uint16_t size);
+
+/**
+ * @brief   Puntero a una función que escribe en una zona borrada de la memoria no volátil
+ *
+ * @param   address  Dirección desde el comienzo de la zona reservada para el log
+ * @param   data     Datos a escribir
+ * @param   size     Cantidad de bytes a escribir
+ * @return           true si se escribió correctamente, false en caso contrario
+ */
+typedef bool (*storage_write_t)(uint32_t address, const void * data, uint16_t size);
+
+/**
+ * @brief   Puntero a una función que borra un sector de la memoria no volátil, dejando todos sus bytes en 0xFF
+ *
+ * @param   sector   Número de sector, desde el comienzo de la zona reservada para el log
+ * @return           true si se pudo borrar, false en caso contrario
+ */
+typedef bool (*storage_erase_t)(uint8_t sector);
+
+/**
+ * @brief   Estructura que representa el controlador de la memoria no volátil donde se guarda el log
+ */
+typedef struct persist_storage_s {
+    storage_read_t Read;
+    storage_write_t Write;
+    storage_erase_t Erase;
+    uint16_t sector_size; //!< Tamaño de cada sector en bytes, múltiplo de 16
+    uint8_t sectors;      //!< Cantidad de sectores, al menos dos
+} const * persist_storage_t;
+
+//! Estructura que representa el almacenamiento persistente del estado
+typedef struct persist_s * persist_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Crea el almacenamiento persistente y busca el último estado guardado en la memoria.
+ *
+ * @param storage   Controlador de la memoria no volátil.
+ * @return          El almacenamiento creado, NULL si el controlador no es válido.
+ */
+persist_t PersistCreate(persist_storage_t storage);
+
+/**
+ * @brief       Obtiene el último estado guardado, encontrado al crear el almacenamiento o guardado después.
+ *
+ * @param self  El almacenamiento.
+ * @param state Puntero donde se copia el estado.
+ * @return      true si hay un estado guardado, false si la memoria no tiene ningún registro válido.
+ */
+bool PersistRestore(persist_t self, persist_state_t * state);
+
+/**
+ * @brief       Agrega el estado al log, si es distinto del último guardado.
+ *
+ * @param self  El almacenamiento.
+ * @param state Estado a guardar.
+ * @return      true si el estado quedó guardado, false si falló la escritura en la memoria.
+ */
+bool PersistSave(persist_t self, const persist_state_t * state);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERSIST_H_ */
@@ -0,0 +1,134 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef RECORD_H_
+#define RECORD_H_
+
+/** @file record.h
+ ** @brief Declaraciones del registrador de eventos de la aplicación
+ **
+ ** El registrador guarda en un buffer circular los eventos que entran y salen de la lógica de la aplicación para
+ ** poder reproducirlos luego en el host. Tiene un único productor (el contexto de MainTask), por lo que no usa
+ ** secciones críticas. Cuando el buffer se llena se descartan los eventos más antiguos.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad de eventos que guarda el registrador, debe ser potencia de dos
+#ifndef RECORD_BUFFER_SIZE
+#define RECORD_BUFFER_SIZE 256
+#endif
+
+//! Identificador de la salida de alarma (zumbador y LED rojo) en los eventos RECORD_OUTPUT
+#define RECORD_OUTPUT_ALARM 0
+
+/* === Public data type declarations ============================================================================== */
+
+//! Tipos de eventos registrados
+typedef enum {
+    RECORD_BUTTON,  //!< Flanco o repetición de un botón detectado por ButtonTask, id es el mensaje generado y value
+                    //!< los pasos acumulados de una repetición
+    RECORD_MESSAGE, //!< Mensaje procesado por la aplicación, id es el tipo de mensaje y value sus pasos acumulados
+    RECORD_MODE,    //!< Cambio de modo de la aplicación, id es el nuevo modo
+    RECORD_OUTPUT,  //!< Cambio de una salida, id identifica la salida y value es su nuevo estado
+} record_kind_t;
+
+//! Evento registrado, ocupa 8 bytes
+typedef struct {
+    uint32_t timestamp; //!< Instante del evento en ticks del sistema
+    uint8_t kind;       //!< Tipo de evento, ver record_kind_t
+    uint8_t id;         //!< Identificador del evento según su tipo
+    uint16_t value;     //!< Valor asociado al evento
+} record_event_t;
+
+//! Función que devuelve el instante actual en ticks del sistema
+typedef uint32_t (*record_clock_t)(void);
+
+//! Estructura que representa un registrador de eventos
+typedef struct recorder_s * recorder_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief       Crea un registrador de eventos vacío.
+ *
+ * @param now   Función que devuelve el instante actual para marcar los eventos.
+ * @return      El registrador creado.
+ */
+recorder_t RecorderCreate(record_clock_t now);
+
+/**
+ * @brief       Registra un evento en el instante actual.
+ *
+ * @param self  El registrador, si es NULL no se registra nada.
+ * @param kind  Tipo de evento.
+ * @param id    Identificador del evento.
+ * @param value Valor asociado al evento.
+ */
+void RecorderLog(recorder_t self, record_kind_t kind, uint8_t id, uint16_t value);
+
+/**
+ * @brief           Registra un evento en un instante dado.
+ *
+ * @param self      El registrador, si es NULL no se registra nada.
+ * @param timestamp Instante del evento.
+ * @param kind      Tipo de evento.
+ * @param id        Identificador del evento.
+ * @param value     Valor asociado al evento.
+ */
+void RecorderLogAt(recorder_t self, uint32_t timestamp, record_kind_t kind, uint8_t id, uint16_t value);
+
+/**
+ * @brief        Extrae los eventos registrados, del más antiguo al más reciente.
+ *
+ * @param self   El registrador.
+ * @param events Arreglo donde se copian los eventos.
+ * @param size   Cantidad máxima de eventos a copiar.
+ * @return       Cantidad de eventos copiados.
+ */
+uint16_t RecorderRead(recorder_t self, record_event_t * events, uint16_t size);
+
+/**
+ * @brief       Obtiene la cantidad de eventos descartados por falta de espacio.
+ *
+ * @param self  El registrador.
+ * @return      Cantidad de eventos descartados desde la creación.
+ */
+uint32_t RecorderDropped(recorder_t self);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RECORD_H_ */
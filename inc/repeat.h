@@ -0,0 +1,103 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef REPEAT_H_
+#define REPEAT_H_
+
+/** @file repeat.h
+ ** @brief Declaraciones de la repetición acelerada de las teclas de incremento y decremento
+ **
+ ** Mientras una tecla sigue presionada, después de REPEAT_DELAY_MS se generan repeticiones cada REPEAT_PERIOD_MS. Cada
+ ** repetición vale 1 paso y cada REPEAT_STAGE_MS el tamaño del paso pasa a 5 y después a 10. Los pasos vencidos se
+ ** devuelven sumados en una sola consulta, aunque quien consulta se haya demorado varios períodos, así la aplicación
+ ** los aplica con una sola suma y una sola escritura de la pantalla en lugar de un mensaje por paso.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Tiempo que hay que mantener la tecla presionada hasta la primera repetición
+#ifndef REPEAT_DELAY_MS
+#define REPEAT_DELAY_MS 500
+#endif
+
+//! Tiempo entre dos repeticiones
+#ifndef REPEAT_PERIOD_MS
+#define REPEAT_PERIOD_MS 200
+#endif
+
+//! Tiempo de repetición con cada tamaño de paso antes de pasar al siguiente
+#ifndef REPEAT_STAGE_MS
+#define REPEAT_STAGE_MS 2000
+#endif
+
+/* === Public data type declarations ============================================================================== */
+
+//! Instancias disponibles, cada una se reserva en memoria estática
+typedef enum {
+    REPEAT_INCREASE, //!< Tecla de incremento
+    REPEAT_DECREASE, //!< Tecla de decremento
+    REPEAT_COUNT,    //!< Cantidad de instancias, no es una instancia válida
+} repeat_key_t;
+
+//! Estructura que representa la repetición de una tecla
+typedef struct repeat_s * repeat_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief                   Crea la repetición de una tecla, con la tecla suelta.
+ *
+ * @param key               Instancia a crear, si ya existía se vuelve a inicializar.
+ * @param ticks_per_second  Ticks por segundo de los instantes que recibe RepeatUpdate.
+ * @return                  La repetición, NULL si los parámetros no son válidos.
+ */
+repeat_t RepeatCreate(repeat_key_t key, uint16_t ticks_per_second);
+
+/**
+ * @brief           Actualiza el estado de la tecla y obtiene los pasos de las repeticiones vencidas.
+ *
+ * La pulsación inicial no cuenta como repetición, la informa el flanco de la tecla.
+ *
+ * @param self      La repetición.
+ * @param pressed   true si la tecla está presionada.
+ * @param now       Instante actual en ticks, el contador puede desbordar.
+ * @return          Suma de los pasos de las repeticiones vencidas desde la consulta anterior, 0 si no venció ninguna.
+ */
+uint16_t RepeatUpdate(repeat_t self, bool pressed, uint32_t now);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REPEAT_H_ */
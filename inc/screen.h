@@ -22,6 +22,11 @@ SPDX-License-Identifier: MIT
 
 /** @file screen.h
  ** @brief Declaraciones del módulo para la gestión de una pantalla multiplexada de 7 segmentos
+ **
+ ** Los dígitos escritos quedan en un cuadro pendiente marcado como nuevo, y el refresco lo toma recién al comenzar un
+ ** barrido: aunque se escriba varias veces entre dos barridos se muestra un solo cuadro por barrido, el último, y
+ ** nunca se mezclan dígitos de dos cuadros. Se supone que el refresco no lo interrumpe quien escribe, por ejemplo
+ ** porque se llama desde la tarea de mayor prioridad.
  **/
 
 /* === Headers files inclusions =================================================================================== */
@@ -98,6 +103,8 @@ screen_t ScreenCreate(uint8_t digits, screen_driver_t driver);
 /**
  * @brief   Función para escribir una pantalla multiplexada de 7 segmentos
  *
+ * Los dígitos se muestran a partir del próximo barrido, todos juntos.
+ *
  * @param   screen Estructura que representa la pantalla
  * @param   value  Valor a escribir en la pantalla
  * @param   size   Tamaño del valor a escribir
@@ -107,6 +114,8 @@ void ScreenWriteBCD(screen_t screen, uint8_t value[], uint8_t size);
 /**
  * @brief   Función para refrescar la pantalla multiplexada de 7 segmentos
  *
+ * Enciende el dígito siguiente; al volver al primer dígito toma el último cuadro escrito, si hay uno nuevo.
+ *
  * @param   screen  Estructura que representa la pantalla
  */
 void ScreenRefresh(screen_t screen);
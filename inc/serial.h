@@ -0,0 +1,145 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SERIAL_H_
+#define SERIAL_H_
+
+/** @file serial.h
+ ** @brief Declaraciones del enlace serie con tramas binarias
+ **
+ ** Cada trama lleva una marca de comienzo, el comando, la longitud de los datos, los datos y la suma de verificación
+ ** Fletcher-16 del comando, la longitud y los datos, con el byte bajo primero:
+ **
+ **     SERIAL_SYNC | comando | longitud | datos (hasta SERIAL_PAYLOAD_MAX bytes) | suma baja | suma alta
+ **
+ ** Los bytes recibidos se guardan desde la interrupción de la UART (o al terminar una transferencia DMA) en un buffer
+ ** circular sin bloqueos, con un único productor y un único consumidor, y se separan en tramas desde una tarea. Cuando
+ ** el buffer está lleno se descartan los bytes nuevos y se cuentan. Una trama con la longitud o la suma incorrecta se
+ ** descarta y se busca la marca de comienzo siguiente.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad de bytes que guarda el buffer de recepción, debe ser potencia de dos
+#ifndef SERIAL_BUFFER_SIZE
+#define SERIAL_BUFFER_SIZE 128
+#endif
+
+//! Cantidad máxima de bytes de datos de una trama
+#define SERIAL_PAYLOAD_MAX 32
+
+//! Marca de comienzo de una trama
+#define SERIAL_SYNC 0xA5
+
+//! Bytes de una trama además de los datos: marca, comando, longitud y suma de verificación
+#define SERIAL_FRAME_OVERHEAD 5
+
+/* === Public data type declarations ============================================================================== */
+
+//! Trama recibida o a enviar
+typedef struct {
+    uint8_t command;                     //!< Comando de la trama
+    uint8_t length;                      //!< Cantidad de bytes de datos
+    uint8_t payload[SERIAL_PAYLOAD_MAX]; //!< Datos de la trama
+} serial_frame_t;
+
+//! Contadores del enlace serie
+typedef struct {
+    uint32_t received; //!< Bytes guardados en el buffer de recepción
+    uint32_t overruns; //!< Bytes descartados por buffer lleno
+    uint32_t frames;   //!< Tramas recibidas completas
+    uint32_t errors;   //!< Tramas descartadas por longitud o suma de verificación incorrecta
+} serial_stats_t;
+
+//! Función que transmite bytes por la UART, puede esperar a que se terminen de enviar
+typedef void (*serial_write_t)(const uint8_t * data, uint16_t size);
+
+//! Estructura que representa el enlace serie
+typedef struct serial_s * serial_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief       Crea el enlace serie con el buffer de recepción vacío y los contadores en cero.
+ *
+ * @param write Función que transmite los bytes de las tramas enviadas.
+ * @return      El enlace creado, NULL si no se indicó la función de transmisión.
+ */
+serial_t SerialCreate(serial_write_t write);
+
+/**
+ * @brief       Guarda bytes recibidos en el buffer, se llama desde la interrupción de la UART o del DMA.
+ *
+ * @param self  El enlace.
+ * @param data  Bytes recibidos.
+ * @param size  Cantidad de bytes recibidos.
+ * @return      Cantidad de bytes guardados, menor que size si el buffer se llenó.
+ */
+uint16_t SerialReceive(serial_t self, const uint8_t * data, uint16_t size);
+
+/**
+ * @brief       Procesa los bytes recibidos hasta completar una trama, se llama desde la tarea que atiende el enlace.
+ *
+ * Una trama puede llegar en varias partes: lo recibido se conserva hasta la llamada siguiente.
+ *
+ * @param self  El enlace.
+ * @param frame Trama recibida.
+ * @return      true si se completó una trama, false si no hay una trama completa en el buffer.
+ */
+bool SerialReadFrame(serial_t self, serial_frame_t * frame);
+
+/**
+ * @brief           Arma una trama y la transmite.
+ *
+ * @param self      El enlace.
+ * @param command   Comando de la trama.
+ * @param payload   Datos de la trama, puede ser NULL si length es cero.
+ * @param length    Cantidad de bytes de datos, hasta SERIAL_PAYLOAD_MAX.
+ * @return          true si se transmitió la trama, false si los datos son demasiado largos.
+ */
+bool SerialSendFrame(serial_t self, uint8_t command, const void * payload, uint8_t length);
+
+/**
+ * @brief       Obtiene los contadores del enlace.
+ *
+ * @param self  El enlace.
+ * @param stats Contadores desde la creación del enlace.
+ */
+void SerialGetStats(serial_t self, serial_stats_t * stats);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERIAL_H_ */
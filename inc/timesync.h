@@ -0,0 +1,174 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TIMESYNC_H_
+#define TIMESYNC_H_
+
+/** @file timesync.h
+ ** @brief Declaraciones del cliente de sincronización de la hora por el enlace serie
+ **
+ ** Funciona como un cliente NTP reducido: el reloj envía un pedido COMMAND_SYNC con su instante de transmisión t1 y
+ ** la PC responde con t1, el instante t2 en que lo recibió y el instante t3 en que responde, según su hora. Con el
+ ** instante t4 en que llega la respuesta se calculan la diferencia con la PC, ((t2 - t1) + (t3 - t4)) / 2, y la demora
+ ** de ida y vuelta, (t4 - t1) - (t3 - t2). Todos los instantes son milisegundos UTC desde la época.
+ **
+ ** Las diferencias chicas se corrigen de a poco, cambiando la corrección del oscilador durante el tiempo necesario
+ ** para recuperar la diferencia, así la hora nunca salta ni retrocede. La diferencia que queda en la muestra
+ ** siguiente se debe al error de frecuencia del oscilador, que se estima y se suma a la corrección base. Sólo se salta
+ ** a la hora de la PC si el reloj no tiene hora válida o la diferencia supera TIMESYNC_STEP_MS.
+ **
+ ** La corrección del oscilador sólo se aplica cuando el reloj cuenta los ticks; con el calendario del RTC la hora
+ ** avanza por hardware, por lo que no se corrige de a poco ni se estima la frecuencia: se salta a la hora de la PC
+ ** cuando la diferencia supera TIMESYNC_CALENDAR_STEP_MS.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "clock.h"
+#include "serial.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Diferencia a partir de la cual se salta a la hora de la PC en lugar de corregirla de a poco
+#ifndef TIMESYNC_STEP_MS
+#define TIMESYNC_STEP_MS 500
+#endif
+
+//! Diferencia a partir de la cual se salta con el calendario del RTC, mayor al error del salto (período de ClockTask)
+#ifndef TIMESYNC_CALENDAR_STEP_MS
+#define TIMESYNC_CALENDAR_STEP_MS 250
+#endif
+
+//! Demora de ida y vuelta máxima de una muestra válida, el error de la diferencia es a lo sumo la mitad
+#ifndef TIMESYNC_MAX_DELAY_MS
+#define TIMESYNC_MAX_DELAY_MS 100
+#endif
+
+//! Corrección que se suma o se resta al oscilador mientras se recupera una diferencia
+#ifndef TIMESYNC_SLEW_PPM
+#define TIMESYNC_SLEW_PPM 500
+#endif
+
+//! Límite de la corrección base estimada a partir del error de frecuencia
+#ifndef TIMESYNC_FREQUENCY_LIMIT_PPM
+#define TIMESYNC_FREQUENCY_LIMIT_PPM 1000
+#endif
+
+/* === Public data type declarations ============================================================================== */
+
+//! Estado de la sincronización
+typedef struct {
+    uint32_t requests;  //!< Pedidos enviados
+    uint32_t samples;   //!< Respuestas aceptadas
+    uint32_t rejected;  //!< Respuestas descartadas por demora excesiva o por no corresponder al último pedido
+    uint32_t steps;     //!< Veces que se saltó a la hora de la PC
+    int32_t offset_ms;  //!< Diferencia con la PC de la última muestra, positiva si el reloj atrasa
+    uint32_t delay_ms;  //!< Demora de ida y vuelta de la última muestra
+    int32_t base_ppm;   //!< Corrección del oscilador estimada, sin la corrección transitoria
+} timesync_status_t;
+
+//! Estructura que representa el cliente de sincronización
+typedef struct timesync_s * timesync_t;
+
+//! Pide a la tarea que ajusta el reloj que llame a TimeSyncApply y espera a que termine
+typedef void (*timesync_defer_t)(void);
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Crea el cliente de sincronización, tomando como corrección base la corrección actual del reloj.
+ *
+ * @param serial    Enlace serie con la PC.
+ * @param clock     Reloj a sincronizar.
+ * @param interval  Segundos entre pedidos, 0 para enviarlos sólo con TimeSyncRequest.
+ * @return          El cliente creado.
+ */
+timesync_t TimeSyncCreate(serial_t serial, clock_t clock, uint16_t interval);
+
+/**
+ * @brief           Asocia la función que traslada las correcciones del reloj a otra tarea.
+ *
+ * El salto y los cambios de la corrección del oscilador se calculan en la tarea que recibe las respuestas, pero se
+ * aplican en la que lee la hora para la aplicación, así nunca ve el reloj a medio ajustar.
+ *
+ * @param self      El cliente.
+ * @param defer     La función, NULL para aplicar las correcciones en la tarea que recibe las respuestas.
+ */
+void TimeSyncAttachDefer(timesync_t self, timesync_defer_t defer);
+
+/**
+ * @brief       Aplica al reloj las correcciones que esperan, si hay alguna.
+ *
+ * Se llama desde la tarea que ajusta el reloj, a pedido de la función asociada con TimeSyncAttachDefer.
+ *
+ * @param self  El cliente.
+ */
+void TimeSyncApply(timesync_t self);
+
+/**
+ * @brief       Envía un pedido de sincronización con el instante actual del reloj.
+ *
+ * @param self  El cliente.
+ * @return      true si se envió el pedido, false en caso contrario.
+ */
+bool TimeSyncRequest(timesync_t self);
+
+/**
+ * @brief       Procesa la respuesta de la PC, se llama apenas se recibe para que t4 sea lo más preciso posible.
+ *
+ * @param self  El cliente.
+ * @param reply Trama recibida, con el comando COMMAND_SYNC más COMMAND_REPLY.
+ * @return      true si se aceptó la muestra y se corrigió el reloj, false si se descartó.
+ */
+bool TimeSyncReceive(timesync_t self, const serial_frame_t * reply);
+
+/**
+ * @brief       Termina la corrección transitoria al recuperar la diferencia y envía los pedidos periódicos.
+ *
+ * Se debe llamar con frecuencia, el error de la corrección es TIMESYNC_SLEW_PPM por la demora entre llamadas.
+ *
+ * @param self  El cliente.
+ */
+void TimeSyncPoll(timesync_t self);
+
+/**
+ * @brief           Obtiene el estado de la sincronización.
+ *
+ * @param self      El cliente.
+ * @param status    Estado actual.
+ */
+void TimeSyncGetStatus(timesync_t self, timesync_status_t * status);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMESYNC_H_ */
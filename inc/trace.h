@@ -0,0 +1,169 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/** @file trace.h
+ ** @brief Declaraciones del buffer de trazas binarias para instrumentar los caminos críticos
+ **
+ ** Cada traza ocupa 8 bytes (instante, evento y argumento) y se escribe en un buffer circular sin bloqueos que se
+ ** puede usar desde tareas e interrupciones: el lugar se marca incompleto y se reserva con un incremento atómico del
+ ** índice de escritura, y el evento se escribe al final para marcar la traza como completa. El buffer funciona como
+ ** registrador de vuelo: nunca se llena, las trazas nuevas sobrescriben a las más antiguas, así un volcado desde el
+ ** depurador muestra siempre lo último que pasó. El lector es único y opcional (el depurador vuelca la variable del
+ ** buffer completa); las trazas que se sobrescriben antes de leerse se cuentan al leer. El buffer es único porque las
+ ** macros de traza de FreeRTOS no pueden recibir un objeto.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad de trazas que guarda el buffer, debe ser potencia de dos
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE 512
+#endif
+
+//! Habilita la instrumentación del firmware al compilar con TRACE_ENABLED=1, las funciones están disponibles siempre
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+//! Marca de comienzo del volcado del buffer ("TRC1" en little endian)
+#define TRACE_MAGIC 0x31435254u
+
+//! Registra una traza desde el código instrumentado, no genera código en las pruebas unitarias
+#if TRACE_ENABLED && !defined(TEST)
+#define TRACE_EVENT(event, arg) TraceWrite((event), (uint16_t)(arg))
+#else
+#define TRACE_EVENT(event, arg) ((void)0)
+#endif
+
+/* === Public data type declarations ============================================================================== */
+
+//! Eventos de traza
+typedef enum {
+    TRACE_NONE,                 //!< Lugar vacío o traza incompleta, no es un evento válido
+    TRACE_TASK_SWITCHED_IN,     //!< Una tarea comienza a ejecutarse, arg es su número de traza
+    TRACE_TASK_SWITCHED_OUT,    //!< Una tarea deja de ejecutarse, arg es su número de traza
+    TRACE_SCREEN_REFRESH_BEGIN, //!< Entrada a ScreenRefresh, arg es el dígito anterior
+    TRACE_SCREEN_REFRESH_END,   //!< Salida de ScreenRefresh, arg es el dígito encendido
+    TRACE_CLOCK_TICK_BEGIN,     //!< Entrada a ClockNewTick, arg no se usa
+    TRACE_CLOCK_TICK_END,       //!< Salida de ClockNewTick, arg no se usa
+    TRACE_QUEUE_SEND,           //!< Envío a una cola, arg es su número de traza
+    TRACE_QUEUE_SEND_FAILED,    //!< Envío fallido por cola llena, arg es su número de traza
+    TRACE_ALARM,                //!< Cambio del estado de la alarma, arg es 1 si comienza a sonar y 0 si se detiene
+    TRACE_BOOT_FIRST_FRAME,     //!< Primer refresco de la pantalla después del arranque, arg no se usa
+    TRACE_EVENT_COUNT,          //!< Cantidad de eventos, no es un evento válido
+} trace_event_t;
+
+//! Números de traza de las tareas, se asignan con vTaskSetTaskNumber (0 para las tareas del sistema)
+typedef enum {
+    TRACE_TASK_SYSTEM,
+    TRACE_TASK_MAIN,
+    TRACE_TASK_DISPLAY,
+    TRACE_TASK_CLOCK,
+    TRACE_TASK_BUTTON,
+    TRACE_TASK_SERIAL,
+    TRACE_TASK_COUNT,
+} trace_task_t;
+
+//! Números de traza de las colas, se asignan con vQueueSetQueueNumber
+typedef enum {
+    TRACE_QUEUE_OTHER,
+    TRACE_QUEUE_MAIN,
+    TRACE_QUEUE_COUNT,
+} trace_queue_t;
+
+//! Traza registrada, ocupa 8 bytes
+typedef struct {
+    uint32_t timestamp; //!< Instante de la traza en ciclos del contador de la fuente de tiempo
+    uint16_t event;     //!< Evento, ver trace_event_t
+    uint16_t arg;       //!< Argumento asociado al evento
+} trace_record_t;
+
+//! Encabezado del buffer de trazas, es lo primero que aparece en un volcado de memoria del buffer
+typedef struct {
+    uint32_t magic;             //!< Marca de comienzo, vale TRACE_MAGIC
+    uint16_t ticks_per_us;      //!< Ciclos de la fuente de tiempo por microsegundo
+    uint16_t size;              //!< Cantidad de lugares del buffer, a continuación del encabezado
+    volatile uint32_t head;     //!< Cantidad total de lugares reservados para escribir
+    volatile uint32_t tail;     //!< Cantidad total de trazas leídas o sobrescritas antes de leerse
+    volatile uint32_t dropped;  //!< Cantidad de trazas sobrescritas antes de leerse, se actualiza al leer
+} trace_header_t;
+
+//! Función que devuelve el instante actual, con la mayor resolución disponible
+typedef uint32_t (*trace_clock_t)(void);
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief              Vacía el buffer de trazas y define la fuente de tiempo.
+ *
+ * @param now          Función que devuelve el instante actual para marcar las trazas.
+ * @param ticks_per_us Cantidad de ciclos de la fuente de tiempo por microsegundo, se guarda en el volcado.
+ */
+void TraceInit(trace_clock_t now, uint16_t ticks_per_us);
+
+/**
+ * @brief       Registra una traza en el instante actual, se puede llamar desde interrupciones.
+ *
+ * Si el buffer dio la vuelta la traza ocupa el lugar de la más antigua.
+ *
+ * @param event Evento a registrar.
+ * @param arg   Argumento asociado al evento.
+ */
+void TraceWrite(trace_event_t event, uint16_t arg);
+
+/**
+ * @brief         Extrae las trazas completas, de la más antigua a la más reciente.
+ *
+ * Si los escritores dieron la vuelta desde la última lectura, las trazas sobrescritas se saltean y se cuentan.
+ *
+ * @param records Arreglo donde se copian las trazas.
+ * @param size    Cantidad máxima de trazas a copiar.
+ * @return        Cantidad de trazas copiadas.
+ */
+uint16_t TraceRead(trace_record_t * records, uint16_t size);
+
+/**
+ * @brief   Obtiene la cantidad de trazas sobrescritas antes de leerse.
+ *
+ * @return  Cantidad de trazas perdidas desde la inicialización, incluidas las que se perderán en la próxima lectura.
+ */
+uint32_t TraceDropped(void);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H_ */
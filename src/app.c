@@ -0,0 +1,988 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app.c
+ ** @brief Código fuente de la máquina de estados de la aplicación del reloj
+ **
+ ** Todo el comportamiento de la interfaz se describe en dos tablas constantes: una con la configuración de la
+ ** pantalla de cada modo y otra con la transición (acción y modo siguiente) para cada par modo × evento. El
+ ** despachador sólo indexa la tabla, de modo que agregar un modo no agrega ramas de código.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app.h"
+#include "config.h"
+#include "trace.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Modo siguiente que indica que la transición no cambia de modo
+#define APP_MODE_KEEP   0xFF
+
+//! Modo siguiente que vuelve a CLOCK_MODE_DISPLAY si la hora es válida o a CLOCK_MODE_UNSET_TIME si no lo es
+#define APP_MODE_RESUME 0xFE
+
+//! Índice en clock_time_t::bcd de las unidades de horas
+#define APP_FIELD_HOURS   4
+
+//! Índice en clock_time_t::bcd de las unidades de minutos
+#define APP_FIELD_MINUTES 2
+
+//! Valor de campo que indica que el modo no edita ningún campo
+#define APP_FIELD_NONE    0xFF
+
+//! Barrera del compilador: los accesos a los datos compartidos no se mueven antes ni después de los de su indicador
+#define APP_COMPILER_BARRIER() __asm volatile("" ::: "memory")
+
+/* === Private data type declarations ============================================================================== */
+
+//! Función que se ejecuta sobre la aplicación (acciones y ganchos de los modos)
+typedef void (*app_action_t)(app_t self);
+
+//! Función que obtiene los dígitos que muestra un modo
+typedef void (*app_show_t)(app_t self, uint8_t value[4]);
+
+//! Descripción de un modo: configuración de la pantalla y comportamiento asociado
+typedef struct app_mode_s {
+    uint8_t flash_from;            //!< Primer dígito que parpadea
+    uint8_t flash_to;              //!< Último dígito que parpadea
+    uint16_t flash_frecuency;      //!< Frecuencia de parpadeo de los dígitos, 0 para no parpadear
+    uint8_t dots_flash_from;       //!< Primer punto que parpadea
+    uint8_t dots_flash_to;         //!< Último punto que parpadea
+    uint16_t dots_flash_frecuency; //!< Frecuencia de parpadeo de los puntos, 0 para no parpadear
+    uint8_t dots_from;             //!< Primer punto encendido fijo
+    uint8_t dots_to;               //!< Último punto encendido fijo, menor que dots_from para no encender ninguno
+    uint8_t field;                 //!< Índice del campo que se edita en el modo o APP_FIELD_NONE
+    const uint8_t * limit;         //!< Límite del campo que se edita
+    bool config;                   //!< Indica si es un modo de configuración con tiempo límite
+    uint16_t refresh_ticks;        //!< Período de actualización de la pantalla, 0 si sólo cambia con los eventos
+    app_show_t show;               //!< Obtiene los dígitos a mostrar, NULL para mostrar la hora en edición
+    app_action_t enter;            //!< Acción a ejecutar al entrar en el modo
+    app_action_t poll;             //!< Acción a ejecutar periódicamente mientras se está en el modo
+} const * app_mode_t;
+
+//! Transición de la máquina de estados para un par modo × evento
+typedef struct app_transition_s {
+    app_action_t action; //!< Acción a ejecutar, NULL si el evento se ignora en el modo
+    uint8_t next;        //!< Modo siguiente, APP_MODE_KEEP o APP_MODE_RESUME
+} const * app_transition_t;
+
+//! Estructura interna de la aplicación
+struct app_s {
+    clock_t clock;                 //!< Reloj que gestiona la aplicación
+    board_t board;                 //!< Placa con la pantalla y las salidas de alarma
+    clock_mode_t mode;             //!< Modo actual
+    clock_time_t edit;             //!< Hora que se muestra o se está editando
+    bool alarm_ringing;            //!< Indica si la alarma está sonando
+    uint32_t timeout_count;        //!< Ticks transcurridos sin actividad en un modo de configuración
+    recorder_t recorder;           //!< Registrador de eventos, NULL si no se registra
+    persist_t persist;             //!< Almacenamiento del estado, NULL si no se guarda
+    chrono_t timer;                //!< Temporizador de cuenta regresiva, NULL si no hay
+    chrono_t stopwatch;            //!< Cronómetro, NULL si no hay
+    bool timer_ringing;            //!< Indica si el temporizador venció y todavía no se atendió
+    uint16_t steps;                //!< Pasos del evento que se está procesando
+    bool defer_save;               //!< Indica si AppSaveState deja el estado pendiente en lugar de guardarlo
+    volatile bool save_pending;    //!< Indica que pending_state tiene un estado nuevo para guardar
+    persist_state_t pending_state; //!< Último estado tomado por AppSaveState con las escrituras diferidas
+    volatile bool display_ready;   //!< Indica que display_mode y display_value tienen un cuadro nuevo para mostrar
+    clock_mode_t display_mode;     //!< Modo del último cuadro publicado por la tarea principal
+    uint8_t display_value[4];      //!< Dígitos del último cuadro publicado, en los modos sin función para mostrar
+    clock_mode_t shown_mode;       //!< Modo que muestra la pantalla, sólo lo usa la tarea de la pantalla
+    uint8_t shown_value[4];        //!< Dígitos que muestra la pantalla en los modos sin función para mostrar
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Actualiza el estado de la alarma y registra el cambio de la salida.
+ * @param self      La aplicación.
+ * @param ringing   Nuevo estado de la alarma.
+ */
+static void SetAlarmRinging(app_t self, bool ringing);
+
+/**
+ * @brief       Publica el cuadro del modo actual para que lo escriba en la pantalla AppUpdateDisplay.
+ * @param self  La aplicación.
+ */
+static void PublishDisplay(app_t self);
+
+/**
+ * @brief       Acción al entrar en CLOCK_MODE_UNSET_TIME: borra la hora en edición.
+ * @param self  La aplicación.
+ */
+static void EnterUnset(app_t self);
+
+/**
+ * @brief       Acción al entrar en CLOCK_MODE_DISPLAY: actualiza los indicadores de la alarma.
+ * @param self  La aplicación.
+ */
+static void EnterDisplay(app_t self);
+
+/**
+ * @brief       Tarea periódica de CLOCK_MODE_DISPLAY: verifica si la alarma debe sonar.
+ * @param self  La aplicación.
+ */
+static void PollAlarm(app_t self);
+
+/**
+ * @brief       Tarea periódica de los modos del temporizador y del cronómetro: si la alarma debe sonar vuelve a
+ *              CLOCK_MODE_DISPLAY para que se pueda atender.
+ * @param self  La aplicación.
+ */
+static void PollChronoAlarm(app_t self);
+
+/**
+ * @brief       Verifica en cualquier modo si venció el temporizador y, si la alarma no está sonando, pasa a
+ *              CLOCK_MODE_TIMER para avisarlo.
+ * @param self  La aplicación.
+ */
+static void PollTimer(app_t self);
+
+/**
+ * @brief       Acción al entrar en CLOCK_MODE_TIMER: si el temporizador venció hace parpadear la pantalla y suena.
+ * @param self  La aplicación.
+ */
+static void EnterTimer(app_t self);
+
+/**
+ * @brief       Obtiene los dígitos de la hora actual del reloj.
+ * @param self  La aplicación.
+ * @param value Dígitos a mostrar.
+ */
+static void ShowClock(app_t self, uint8_t value[4]);
+
+/**
+ * @brief       Obtiene los dígitos del tiempo restante del temporizador.
+ * @param self  La aplicación.
+ * @param value Dígitos a mostrar.
+ */
+static void ShowTimer(app_t self, uint8_t value[4]);
+
+/**
+ * @brief       Obtiene los dígitos del tiempo del cronómetro.
+ * @param self  La aplicación.
+ * @param value Dígitos a mostrar.
+ */
+static void ShowStopwatch(app_t self, uint8_t value[4]);
+
+/**
+ * @brief       Silencia el temporizador vencido y lo vuelve al comienzo.
+ * @param self  La aplicación.
+ */
+static void SilenceTimer(app_t self);
+
+/**
+ * @brief       Copia la hora actual del reloj para editarla.
+ * @param self  La aplicación.
+ */
+static void ActionEditTime(app_t self);
+
+/**
+ * @brief       Copia la hora de la alarma para editarla.
+ * @param self  La aplicación.
+ */
+static void ActionEditAlarm(app_t self);
+
+/**
+ * @brief       Confirma la hora en edición como hora actual del reloj.
+ * @param self  La aplicación.
+ */
+static void ActionCommitTime(app_t self);
+
+/**
+ * @brief       Confirma la hora en edición como hora de la alarma y la habilita.
+ * @param self  La aplicación.
+ */
+static void ActionCommitAlarm(app_t self);
+
+/**
+ * @brief       Abandona la edición sin guardar cambios.
+ * @param self  La aplicación.
+ */
+static void ActionCancelEdit(app_t self);
+
+/**
+ * @brief       Reduce los pasos del evento al rango del campo en edición, así entran en un entero con signo.
+ * @param self  La aplicación.
+ * @return      Pasos equivalentes, menores al rango del campo.
+ */
+static int16_t EditSteps(app_t self);
+
+/**
+ * @brief       Incrementa el campo en edición en los pasos del evento.
+ * @param self  La aplicación.
+ */
+static void ActionIncrease(app_t self);
+
+/**
+ * @brief       Decrementa el campo en edición en los pasos del evento.
+ * @param self  La aplicación.
+ */
+static void ActionDecrease(app_t self);
+
+/**
+ * @brief       Pasa a otro modo con las teclas de incremento y decremento, silenciando el temporizador vencido. El
+ *              modo siguiente lo indica la transición.
+ * @param self  La aplicación.
+ */
+static void ActionSelectMode(app_t self);
+
+/**
+ * @brief       Copia la duración del temporizador, en horas y minutos, para editarla.
+ * @param self  La aplicación.
+ */
+static void ActionEditTimer(app_t self);
+
+/**
+ * @brief       Confirma la duración en edición como duración del temporizador.
+ * @param self  La aplicación.
+ */
+static void ActionCommitTimer(app_t self);
+
+/**
+ * @brief       Pone en marcha o detiene el temporizador, o lo silencia si venció.
+ * @param self  La aplicación.
+ */
+static void ActionTimerToggle(app_t self);
+
+/**
+ * @brief       Vuelve el temporizador al comienzo, silenciándolo si venció.
+ * @param self  La aplicación.
+ */
+static void ActionTimerReset(app_t self);
+
+/**
+ * @brief       Pone en marcha o detiene el cronómetro.
+ * @param self  La aplicación.
+ */
+static void ActionStopwatchToggle(app_t self);
+
+/**
+ * @brief       Vuelve el cronómetro a cero y lo detiene.
+ * @param self  La aplicación.
+ */
+static void ActionStopwatchReset(app_t self);
+
+/**
+ * @brief       Pospone la alarma si está sonando o la habilita si no lo está.
+ * @param self  La aplicación.
+ */
+static void ActionAlarmAccept(app_t self);
+
+/**
+ * @brief       Detiene la alarma si está sonando y la deshabilita.
+ * @param self  La aplicación.
+ */
+static void ActionAlarmCancel(app_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+static const uint8_t MINUTES_LIMIT[] = {5, 9};
+
+static const uint8_t HOURS_LIMIT[] = {2, 3};
+
+//! Descripción de cada modo, indexada por clock_mode_t
+static const struct app_mode_s MODES[CLOCK_MODE_COUNT] = {
+    [CLOCK_MODE_UNSET_TIME] = {
+        .flash_from = 0, .flash_to = 3, .flash_frecuency = 100,
+        .dots_flash_from = 1, .dots_flash_to = 1, .dots_flash_frecuency = 100,
+        .dots_from = 1, .dots_to = 0,
+        .field = APP_FIELD_NONE,
+        .enter = EnterUnset,
+    },
+    [CLOCK_MODE_DISPLAY] = {
+        .flash_from = 0, .flash_to = 3, .flash_frecuency = 0,
+        .dots_flash_from = 1, .dots_flash_to = 1, .dots_flash_frecuency = 500,
+        .dots_from = 1, .dots_to = 0,
+        .field = APP_FIELD_NONE,
+        .refresh_ticks = DISPLAY_UPDATE_TICKS, .show = ShowClock,
+        .enter = EnterDisplay,
+        .poll = PollAlarm,
+    },
+    [CLOCK_MODE_SET_HOURS] = {
+        .flash_from = 0, .flash_to = 1, .flash_frecuency = 100,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 1, .dots_to = 1,
+        .field = APP_FIELD_HOURS, .limit = HOURS_LIMIT,
+        .config = true,
+    },
+    [CLOCK_MODE_SET_MINUTES] = {
+        .flash_from = 2, .flash_to = 3, .flash_frecuency = 100,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 1, .dots_to = 1,
+        .field = APP_FIELD_MINUTES, .limit = MINUTES_LIMIT,
+        .config = true,
+    },
+    [CLOCK_MODE_SET_ALARM_HOURS] = {
+        .flash_from = 0, .flash_to = 1, .flash_frecuency = 100,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 0, .dots_to = 3,
+        .field = APP_FIELD_HOURS, .limit = HOURS_LIMIT,
+        .config = true,
+    },
+    [CLOCK_MODE_SET_ALARM_MINUTES] = {
+        .flash_from = 2, .flash_to = 3, .flash_frecuency = 100,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 0, .dots_to = 3,
+        .field = APP_FIELD_MINUTES, .limit = MINUTES_LIMIT,
+        .config = true,
+    },
+    [CLOCK_MODE_TIMER] = {
+        .flash_from = 0, .flash_to = 3, .flash_frecuency = 0,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 1, .dots_to = 2,
+        .field = APP_FIELD_NONE,
+        .refresh_ticks = DISPLAY_UPDATE_TICKS, .show = ShowTimer,
+        .enter = EnterTimer,
+        .poll = PollChronoAlarm,
+    },
+    [CLOCK_MODE_SET_TIMER_HOURS] = {
+        .flash_from = 0, .flash_to = 1, .flash_frecuency = 100,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 1, .dots_to = 2,
+        .field = APP_FIELD_HOURS, .limit = HOURS_LIMIT,
+        .config = true,
+    },
+    [CLOCK_MODE_SET_TIMER_MINUTES] = {
+        .flash_from = 2, .flash_to = 3, .flash_frecuency = 100,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 1, .dots_to = 2,
+        .field = APP_FIELD_MINUTES, .limit = MINUTES_LIMIT,
+        .config = true,
+    },
+    [CLOCK_MODE_STOPWATCH] = {
+        .flash_from = 0, .flash_to = 3, .flash_frecuency = 0,
+        .dots_flash_from = 0, .dots_flash_to = 0, .dots_flash_frecuency = 0,
+        .dots_from = 1, .dots_to = 1,
+        .field = APP_FIELD_NONE,
+        .refresh_ticks = STOPWATCH_UPDATE_TICKS, .show = ShowStopwatch,
+        .poll = PollChronoAlarm,
+    },
+};
+
+//! Tabla de transiciones modo × evento, las entradas sin acción corresponden a eventos ignorados
+static const struct app_transition_s TRANSITIONS[CLOCK_MODE_COUNT][MSG_COUNT] = {
+    [CLOCK_MODE_UNSET_TIME] = {
+        [MSG_BUTTON_SET_TIME_LONG] = {ActionEditTime, CLOCK_MODE_SET_MINUTES},
+        [MSG_BUTTON_SET_ALARM_LONG] = {ActionEditAlarm, CLOCK_MODE_SET_ALARM_MINUTES},
+    },
+    [CLOCK_MODE_DISPLAY] = {
+        [MSG_BUTTON_SET_TIME_LONG] = {ActionEditTime, CLOCK_MODE_SET_MINUTES},
+        [MSG_BUTTON_SET_ALARM_LONG] = {ActionEditAlarm, CLOCK_MODE_SET_ALARM_MINUTES},
+        [MSG_BUTTON_ACCEPT] = {ActionAlarmAccept, APP_MODE_KEEP},
+        [MSG_BUTTON_CANCEL] = {ActionAlarmCancel, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE] = {ActionSelectMode, CLOCK_MODE_TIMER},
+        [MSG_BUTTON_DECREASE] = {ActionSelectMode, CLOCK_MODE_STOPWATCH},
+    },
+    [CLOCK_MODE_SET_HOURS] = {
+        [MSG_BUTTON_ACCEPT] = {ActionCommitTime, CLOCK_MODE_DISPLAY},
+        [MSG_BUTTON_CANCEL] = {ActionCancelEdit, APP_MODE_RESUME},
+        [MSG_BUTTON_INCREASE] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE_REPEAT] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE_REPEAT] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_CONFIG_TIMEOUT] = {ActionCancelEdit, APP_MODE_RESUME},
+    },
+    [CLOCK_MODE_SET_MINUTES] = {
+        [MSG_BUTTON_ACCEPT] = {ActionCommitTime, CLOCK_MODE_SET_HOURS},
+        [MSG_BUTTON_CANCEL] = {ActionCancelEdit, APP_MODE_RESUME},
+        [MSG_BUTTON_INCREASE] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE_REPEAT] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE_REPEAT] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_CONFIG_TIMEOUT] = {ActionCancelEdit, APP_MODE_RESUME},
+    },
+    [CLOCK_MODE_SET_ALARM_HOURS] = {
+        [MSG_BUTTON_ACCEPT] = {ActionCommitAlarm, CLOCK_MODE_DISPLAY},
+        [MSG_BUTTON_CANCEL] = {ActionCancelEdit, CLOCK_MODE_DISPLAY},
+        [MSG_BUTTON_INCREASE] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE_REPEAT] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE_REPEAT] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_CONFIG_TIMEOUT] = {ActionCancelEdit, APP_MODE_RESUME},
+    },
+    [CLOCK_MODE_SET_ALARM_MINUTES] = {
+        [MSG_BUTTON_ACCEPT] = {ActionCommitAlarm, CLOCK_MODE_SET_ALARM_HOURS},
+        [MSG_BUTTON_CANCEL] = {ActionCancelEdit, CLOCK_MODE_DISPLAY},
+        [MSG_BUTTON_INCREASE] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE_REPEAT] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE_REPEAT] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_CONFIG_TIMEOUT] = {ActionCancelEdit, APP_MODE_RESUME},
+    },
+    [CLOCK_MODE_TIMER] = {
+        [MSG_BUTTON_SET_TIME_LONG] = {ActionEditTimer, CLOCK_MODE_SET_TIMER_MINUTES},
+        [MSG_BUTTON_ACCEPT] = {ActionTimerToggle, APP_MODE_KEEP},
+        [MSG_BUTTON_CANCEL] = {ActionTimerReset, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE] = {ActionSelectMode, CLOCK_MODE_STOPWATCH},
+        [MSG_BUTTON_DECREASE] = {ActionSelectMode, APP_MODE_RESUME},
+    },
+    [CLOCK_MODE_SET_TIMER_HOURS] = {
+        [MSG_BUTTON_ACCEPT] = {ActionCommitTimer, CLOCK_MODE_TIMER},
+        [MSG_BUTTON_CANCEL] = {ActionCancelEdit, CLOCK_MODE_TIMER},
+        [MSG_BUTTON_INCREASE] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE_REPEAT] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE_REPEAT] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_CONFIG_TIMEOUT] = {ActionCancelEdit, CLOCK_MODE_TIMER},
+    },
+    [CLOCK_MODE_SET_TIMER_MINUTES] = {
+        [MSG_BUTTON_ACCEPT] = {ActionCommitTimer, CLOCK_MODE_SET_TIMER_HOURS},
+        [MSG_BUTTON_CANCEL] = {ActionCancelEdit, CLOCK_MODE_TIMER},
+        [MSG_BUTTON_INCREASE] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE_REPEAT] = {ActionIncrease, APP_MODE_KEEP},
+        [MSG_BUTTON_DECREASE_REPEAT] = {ActionDecrease, APP_MODE_KEEP},
+        [MSG_CONFIG_TIMEOUT] = {ActionCancelEdit, CLOCK_MODE_TIMER},
+    },
+    [CLOCK_MODE_STOPWATCH] = {
+        [MSG_BUTTON_ACCEPT] = {ActionStopwatchToggle, APP_MODE_KEEP},
+        [MSG_BUTTON_CANCEL] = {ActionStopwatchReset, APP_MODE_KEEP},
+        [MSG_BUTTON_INCREASE] = {ActionSelectMode, APP_MODE_RESUME},
+        [MSG_BUTTON_DECREASE] = {ActionSelectMode, CLOCK_MODE_TIMER},
+    },
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void SetAlarmRinging(app_t self, bool ringing) {
+    if (ringing != self->alarm_ringing) {
+        RecorderLog(self->recorder, RECORD_OUTPUT, RECORD_OUTPUT_ALARM, ringing);
+        TRACE_EVENT(TRACE_ALARM, ringing);
+    }
+    self->alarm_ringing = ringing;
+}
+
+static void EnterUnset(app_t self) {
+    memset(&self->edit, 0, sizeof(clock_time_t));
+}
+
+static void EnterDisplay(app_t self) {
+    ClockUpdateAlarmVisual(self->clock, self->board, self->alarm_ringing);
+}
+
+static void PollAlarm(app_t self) {
+    SetAlarmRinging(self, ClockCheckAlarm(self->clock));
+    ClockUpdateAlarmVisual(self->clock, self->board, self->alarm_ringing);
+}
+
+static void PollChronoAlarm(app_t self) {
+    if (ClockCheckAlarm(self->clock)) {
+        SilenceTimer(self); // La alarma tiene prioridad, el temporizador vencido se da por atendido
+        SetAlarmRinging(self, true);
+        AppModeChange(self, CLOCK_MODE_DISPLAY);
+    }
+}
+
+static void PublishDisplay(app_t self) {
+    // Si la tarea de la pantalla interrumpe la escritura, deja el cuadro para el barrido siguiente
+    self->display_ready = false;
+    APP_COMPILER_BARRIER();
+    self->display_mode = self->mode;
+    if (!MODES[self->mode].show) {
+        ClockTimeToBCD(&self->edit, self->display_value);
+    }
+    APP_COMPILER_BARRIER();
+    self->display_ready = true;
+}
+
+static void PollTimer(app_t self) {
+    if (self->timer_ringing || self->alarm_ringing || !ChronoIsRunning(self->timer) || !ChronoExpired(self->timer)) {
+        return;
+    }
+    ChronoStop(self->timer);
+    self->timer_ringing = true;
+    self->timeout_count = 0; // Se abandona la edición en curso, como al vencer el tiempo de configuración
+    AppModeChange(self, CLOCK_MODE_TIMER);
+}
+
+static void EnterTimer(app_t self) {
+    if (self->timer_ringing) {
+        ScreenFlashDigits(self->board->screen, 0, 3, 100);
+        BuzzerPlay(self->board->buzzer, &BUZZER_MELODY_BEEPS);
+    }
+}
+
+static void ShowClock(app_t self, uint8_t value[4]) {
+    clock_time_t current_time;
+    ClockGetTime(self->clock, &current_time);
+    ClockTimeToBCD(&current_time, value);
+}
+
+static void ShowTimer(app_t self, uint8_t value[4]) {
+    ChronoToBCD(self->timer, value);
+}
+
+static void ShowStopwatch(app_t self, uint8_t value[4]) {
+    ChronoToBCD(self->stopwatch, value);
+}
+
+static void SilenceTimer(app_t self) {
+    app_mode_t mode = &MODES[self->mode];
+
+    if (!self->timer_ringing) {
+        return;
+    }
+    self->timer_ringing = false;
+    BuzzerStop(self->board->buzzer);
+    ChronoReset(self->timer);
+    ScreenFlashDigits(self->board->screen, mode->flash_from, mode->flash_to, mode->flash_frecuency);
+}
+
+static void ActionEditTime(app_t self) {
+    ClockGetTime(self->clock, &self->edit);
+}
+
+static void ActionEditAlarm(app_t self) {
+    ClockGetAlarm(self->clock, &self->edit);
+}
+
+static void ActionCommitTime(app_t self) {
+    self->timeout_count = 0;
+    ClockSetTime(self->clock, &self->edit);
+}
+
+static void ActionCommitAlarm(app_t self) {
+    self->timeout_count = 0;
+    ClockSetAlarm(self->clock, &self->edit);
+    ClockEnableAlarm(self->clock, true);
+    AppSaveState(self);
+}
+
+static void ActionCancelEdit(app_t self) {
+    self->timeout_count = 0;
+}
+
+static int16_t EditSteps(app_t self) {
+    app_mode_t mode = &MODES[self->mode];
+    uint16_t range = (uint16_t)(mode->limit[0] * 10 + mode->limit[1] + 1);
+
+    // Con MainTask demorada los pasos acumulados llegan a UINT16_MAX, que no entra en int16_t
+    return (int16_t)(self->steps % range);
+}
+
+static void ActionIncrease(app_t self) {
+    app_mode_t mode = &MODES[self->mode];
+
+    self->timeout_count = 0;
+    AddBCD(&self->edit.bcd[mode->field], mode->limit, EditSteps(self));
+    PublishDisplay(self);
+}
+
+static void ActionDecrease(app_t self) {
+    app_mode_t mode = &MODES[self->mode];
+
+    self->timeout_count = 0;
+    AddBCD(&self->edit.bcd[mode->field], mode->limit, (int16_t)-EditSteps(self));
+    PublishDisplay(self);
+}
+
+static void ActionSelectMode(app_t self) {
+    SilenceTimer(self);
+}
+
+static void ActionEditTimer(app_t self) {
+    uint32_t minutes = ChronoGetCountdown(self->timer) / 60;
+    uint8_t hours = (uint8_t)((minutes / 60) % 24);
+
+    memset(&self->edit, 0, sizeof(clock_time_t));
+    self->edit.time.hours[1] = hours / 10;
+    self->edit.time.hours[0] = hours % 10;
+    self->edit.time.minutes[1] = (uint8_t)((minutes % 60) / 10);
+    self->edit.time.minutes[0] = (uint8_t)(minutes % 10);
+}
+
+static void ActionCommitTimer(app_t self) {
+    uint32_t hours = self->edit.time.hours[1] * 10U + self->edit.time.hours[0];
+    uint32_t minutes = self->edit.time.minutes[1] * 10U + self->edit.time.minutes[0];
+
+    self->timeout_count = 0;
+    ChronoSetCountdown(self->timer, (hours * 60 + minutes) * 60);
+}
+
+static void ActionTimerToggle(app_t self) {
+    if (self->timer_ringing) {
+        SilenceTimer(self);
+    } else if (ChronoIsRunning(self->timer)) {
+        ChronoStop(self->timer);
+    } else {
+        ChronoStart(self->timer);
+    }
+    PublishDisplay(self);
+}
+
+static void ActionTimerReset(app_t self) {
+    SilenceTimer(self);
+    ChronoReset(self->timer);
+    PublishDisplay(self);
+}
+
+static void ActionStopwatchToggle(app_t self) {
+    if (ChronoIsRunning(self->stopwatch)) {
+        ChronoStop(self->stopwatch);
+    } else {
+        ChronoStart(self->stopwatch);
+    }
+    PublishDisplay(self);
+}
+
+static void ActionStopwatchReset(app_t self) {
+    ChronoReset(self->stopwatch);
+    PublishDisplay(self);
+}
+
+static void ActionAlarmAccept(app_t self) {
+    if (self->alarm_ringing) {
+        if (!ClockSnoozeAlarm(self->clock)) {
+            ClockStopAlarm(self->clock); // Agotados los aplazamientos, la alarma se detiene hasta la próxima vez
+        }
+        SetAlarmRinging(self, ClockCheckAlarm(self->clock));
+    } else {
+        ClockEnableAlarm(self->clock, true);
+        AppSaveState(self);
+    }
+}
+
+static void ActionAlarmCancel(app_t self) {
+    if (self->alarm_ringing) {
+        ClockStopAlarm(self->clock);
+        SetAlarmRinging(self, false);
+    }
+    ClockEnableAlarm(self->clock, false);
+    AppSaveState(self);
+}
+
+/* === Public function definitions ============================================================================== */
+
+app_t AppCreate(clock_t clock, board_t board) {
+    static struct app_s self[1];
+    memset(self, 0, sizeof(struct app_s));
+    self->clock = clock;
+    self->board = board;
+    ClockSetSnooze(clock, &(clock_snooze_t){
+                              .minutes = ALARM_SNOOZE_MINUTES,
+                              .step = ALARM_SNOOZE_STEP_MINUTES,
+                              .min_minutes = ALARM_SNOOZE_MIN_MINUTES,
+                              .limit = ALARM_SNOOZE_LIMIT,
+                          });
+    ClockSetRingTimeout(clock, ALARM_RING_SECONDS);
+    AppModeChange(self, ClockGetTime(clock, &self->edit) ? CLOCK_MODE_DISPLAY : CLOCK_MODE_UNSET_TIME);
+    return self;
+}
+
+void AppAttachRecorder(app_t self, recorder_t recorder) {
+    self->recorder = recorder;
+}
+
+void AppAttachChronos(app_t self, chrono_t timer, chrono_t stopwatch) {
+    self->timer = timer;
+    self->stopwatch = stopwatch;
+    if (ChronoGetCountdown(timer) == 0) {
+        ChronoSetCountdown(timer, TIMER_DEFAULT_MINUTES * 60);
+    }
+}
+
+void AppAttachPersist(app_t self, persist_t persist) {
+    persist_state_t state;
+    clock_time_t alarm = {0};
+
+    self->persist = persist;
+    if (!PersistRestore(persist, &state)) {
+        return;
+    }
+    uint8_t hours = (uint8_t)((state.alarm_minutes / 60) % 24);
+    uint8_t minutes = (uint8_t)(state.alarm_minutes % 60);
+    alarm.time.hours[1] = hours / 10;
+    alarm.time.hours[0] = hours % 10;
+    alarm.time.minutes[1] = minutes / 10;
+    alarm.time.minutes[0] = minutes % 10;
+
+    ClockSetTrim(self->clock, state.trim_ppm);
+    ClockSetAlarm(self->clock, &alarm);
+    ClockSetAlarmWeekdays(self->clock, state.alarm_weekdays);
+    ClockEnableAlarm(self->clock, (state.flags & PERSIST_ALARM_ENABLED) != 0);
+}
+
+void AppSaveState(app_t self) {
+    persist_state_t state = {0};
+    clock_time_t alarm;
+
+    if (!self->persist) {
+        return;
+    }
+    ClockGetAlarm(self->clock, &alarm);
+    state.trim_ppm = ClockGetTrim(self->clock);
+    state.alarm_minutes = (uint16_t)((alarm.time.hours[1] * 10 + alarm.time.hours[0]) * 60 + alarm.time.minutes[1] * 10 +
+                                     alarm.time.minutes[0]);
+    state.alarm_weekdays = ClockGetAlarmWeekdays(self->clock);
+    state.flags = ClockAlarmIsEnabled(self->clock) ? PERSIST_ALARM_ENABLED : 0;
+    if (self->defer_save) {
+        self->pending_state = state;
+        APP_COMPILER_BARRIER();
+        self->save_pending = true; // Se marca al final, con el estado completo
+    } else {
+        PersistSave(self->persist, &state);
+    }
+}
+
+void AppDeferSave(app_t self, bool deferred) {
+    self->defer_save = deferred;
+    if (!deferred) {
+        AppFlushState(self);
+    }
+}
+
+void AppFlushState(app_t self) {
+    persist_state_t state;
+
+    if (!self->save_pending) {
+        return;
+    }
+    self->save_pending = false;
+    APP_COMPILER_BARRIER();
+    state = self->pending_state;
+    APP_COMPILER_BARRIER();
+    if (self->save_pending) {
+        return; // Llegó un estado nuevo durante la copia, que puede estar mezclada; se guarda en la próxima llamada
+    }
+    PersistSave(self->persist, &state);
+}
+
+bool AppSetTime(app_t self, const clock_date_t * date, const clock_time_t * time) {
+    if (!ClockDateIsValid(date) || !ClockTimeIsValid(time)) {
+        return false;
+    }
+    ClockSetTime(self->clock, time);
+    ClockSetDate(self->clock, date);
+    if (self->mode == CLOCK_MODE_UNSET_TIME) {
+        AppModeChange(self, CLOCK_MODE_DISPLAY);
+    }
+    return true;
+}
+
+bool AppSetAlarm(app_t self, const clock_time_t * alarm, uint8_t weekdays, bool enabled) {
+    if (!ClockTimeIsValid(alarm)) {
+        return false;
+    }
+    ClockSetAlarm(self->clock, alarm);
+    ClockSetAlarmWeekdays(self->clock, weekdays);
+    ClockEnableAlarm(self->clock, enabled);
+    if (!enabled) {
+        SetAlarmRinging(self, false);
+    }
+    if (self->mode == CLOCK_MODE_DISPLAY) {
+        EnterDisplay(self); // Los puntos indican si la alarma está habilitada
+    }
+    AppSaveState(self);
+    return true;
+}
+
+void AppDispatch(app_t self, message_type_t event) {
+    AppDispatchSteps(self, event, 0);
+}
+
+void AppDispatchSteps(app_t self, message_type_t event, uint16_t steps) {
+    if ((self->mode >= CLOCK_MODE_COUNT) || (event >= MSG_COUNT)) {
+        return;
+    }
+    RecorderLog(self->recorder, RECORD_MESSAGE, event, steps);
+    self->steps = steps ? steps : 1;
+
+    app_transition_t transition = &TRANSITIONS[self->mode][event];
+    if (transition->action == NULL) {
+        return; // Evento ignorado en este modo
+    }
+
+    transition->action(self);
+
+    if (transition->next == APP_MODE_RESUME) {
+        clock_time_t current_time;
+        AppModeChange(self, ClockGetTime(self->clock, &current_time) ? CLOCK_MODE_DISPLAY : CLOCK_MODE_UNSET_TIME);
+    } else if (transition->next != APP_MODE_KEEP) {
+        AppModeChange(self, (clock_mode_t)transition->next);
+    }
+}
+
+void AppPoll(app_t self) {
+    PollTimer(self);
+
+    app_mode_t mode = &MODES[self->mode];
+    if (mode->poll) {
+        mode->poll(self);
+    }
+}
+
+uint32_t AppPollDelay(app_t self) {
+    uint32_t delay = CLOCK_NO_DEADLINE;
+
+    if (!self->timer_ringing && !self->alarm_ringing && ChronoIsRunning(self->timer)) {
+        delay = (ChronoRead(self->timer) * TICKS_PER_SECOND + CHRONO_CENTISECONDS - 1) / CHRONO_CENTISECONDS;
+    }
+    if (MODES[self->mode].poll) {
+        // La alarma que suena repite la melodía cuando termina, sin un instante que se pueda calcular
+        uint32_t alarm = self->alarm_ringing ? APP_POLL_TICKS : ClockAlarmDelay(self->clock);
+        if (alarm < delay) {
+            delay = alarm;
+        }
+    }
+    return delay;
+}
+
+void AppModeChange(app_t self, clock_mode_t actual) {
+    if (actual >= CLOCK_MODE_COUNT) {
+        return;
+    }
+
+    app_mode_t mode = &MODES[actual];
+    screen_t screen = self->board->screen;
+    self->mode = actual;
+    RecorderLog(self->recorder, RECORD_MODE, actual, 0);
+
+    ScreenFlashDigits(screen, mode->flash_from, mode->flash_to, mode->flash_frecuency);
+    ScreenFlashDots(screen, mode->dots_flash_from, mode->dots_flash_to, mode->dots_flash_frecuency);
+    ScreenClearDots(screen);
+    if (mode->dots_from <= mode->dots_to) {
+        ScreenSetDots(screen, mode->dots_from, mode->dots_to);
+    }
+    if (mode->enter) {
+        mode->enter(self);
+    }
+
+    PublishDisplay(self);
+}
+
+void AppUpdateDisplay(app_t self, bool elapsed) {
+    uint8_t value[4];
+
+    // La tarea principal no interrumpe a la de la pantalla, así la copia no se mezcla con un cuadro nuevo
+    if (self->display_ready) {
+        self->display_ready = false;
+        APP_COMPILER_BARRIER();
+        self->shown_mode = self->display_mode;
+        memcpy(self->shown_value, self->display_value, sizeof(self->shown_value));
+        elapsed = true;
+    }
+    if (!elapsed) {
+        return;
+    }
+
+    // Los modos con una función propia muestran un tiempo que avanza, el resto el cuadro publicado
+    app_mode_t mode = &MODES[self->shown_mode];
+    if (mode->show) {
+        mode->show(self, value);
+    } else {
+        memcpy(value, self->shown_value, sizeof(value));
+    }
+    ScreenWriteBCD(self->board->screen, value, 4);
+}
+
+uint16_t AppRefreshTicks(app_t self) {
+    return MODES[self->shown_mode].refresh_ticks;
+}
+
+clock_mode_t AppGetMode(app_t self) {
+    return self->mode;
+}
+
+bool AppIsInConfigMode(app_t self) {
+    return MODES[self->mode].config;
+}
+
+bool AppConfigTimeoutTick(app_t self, uint32_t ticks) {
+    bool result = false;
+    if (MODES[self->mode].config) {
+        self->timeout_count += ticks;
+        if (self->timeout_count >= CONFIG_TIMEOUT_TICKS) {
+            self->timeout_count = 0;
+            result = true;
+        }
+    }
+    return result;
+}
+
+bool AppAlarmIsRinging(app_t self) {
+    return self->alarm_ringing;
+}
+
+void IncreaseBCD(uint8_t * numero, const uint8_t limite[2]) {
+    bool is_hours = (limite[0] == 2 && limite[1] == 3);
+
+    numero[0]++; // Incrementar unidades
+    if (numero[0] > 9) {
+        numero[0] = 0;
+        numero[1]++; // Incrementar decenas
+    }
+
+    if (is_hours) {
+        // Para horas: 23 -> 00 (pero 24 nunca debe aparecer)
+        if ((numero[1] == 2) && (numero[0] == 4)) {
+            numero[0] = 0;
+            numero[1] = 0;
+        }
+    } else {
+        // Para minutos/segundos: cuando llega a 60 -> 00
+        if ((numero[1] == 6) && (numero[0] == 0)) {
+            numero[0] = 0;
+            numero[1] = 0;
+        }
+    }
+}
+
+void DecreaseBCD(uint8_t * numero, const uint8_t limite[2]) {
+    // Detectar si son horas por el límite
+    bool is_hours = (limite[0] == 2 && limite[1] == 3);
+
+    if (numero[0] == 0) {     // Si unidades es 0 (ahora en posición [0])
+        if (numero[1] == 0) { // Si decenas es 0 (ahora en posición [1])
+            if (is_hours) {
+                // CASO ESPECIAL: 00:xx -> 23:xx
+                numero[1] = 2; // decenas = 2
+                numero[0] = 3; // unidades = 3
+            } else {
+                // Para minutos: 00 -> 59
+                numero[1] = 5; // decenas = 5
+                numero[0] = 9; // unidades = 9
+            }
+        } else {
+            // Decrementar decenas y poner unidades a 9
+            numero[1]--;
+            numero[0] = 9;
+        }
+    } else {
+        // Simplemente decrementar unidades
+        numero[0]--;
+    }
+}
+
+void AddBCD(uint8_t * numero, const uint8_t limite[2], int16_t pasos) {
+    int16_t range = (int16_t)(limite[0] * 10 + limite[1] + 1);
+    int16_t value = (int16_t)(numero[1] * 10 + numero[0]);
+
+    // Una sola suma en binario, sin recorrer los valores intermedios
+    value = (int16_t)((value + pasos % range + range) % range);
+    numero[1] = (uint8_t)(value / 10);
+    numero[0] = (uint8_t)(value % 10);
+}
+
+/* === End of documentation ======================================================================================== */
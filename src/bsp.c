@@ -27,24 +27,118 @@ SPDX-License-Identifier: MIT
 #include "ciaa.h"
 #include "chip.h"
 #include "bsp.h"
+#include "clock.h"
 #include "shield.h"
 #include "screen.h"
 #include "digital.h"
+#include "buzzer.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+//! Registro de respaldo donde se marca que el RTC tiene una hora ajustada
+#define RTC_VALID_REGISTER 0
+
+//! Marca de hora ajustada en el registro de respaldo ("RTC1")
+#define RTC_VALID_MARK     0x31435452u
+
+//! Tamaño de la zona de la EEPROM reservada para el log de estado persistente
+#define EEPROM_LOG_SIZE    ((uint32_t)PERSIST_SECTOR_SIZE * PERSIST_SECTORS)
+
+#if (PERSIST_SECTOR_SIZE % EEPROM_PAGE_SIZE) != 0
+#error "PERSIST_SECTOR_SIZE debe ser múltiplo del tamaño de página de la EEPROM"
+#endif
+
+//! El pin es una salida, si no está marcado es una entrada
+#define BOARD_PIN_OUTPUT      0x01
+
+//! La salida se activa con nivel alto, la entrada está activa con nivel alto
+#define BOARD_PIN_ACTIVE_HIGH 0x02
+
+//! Cantidad de puertos GPIO del microcontrolador
+#define BOARD_GPIO_PORTS      8
+
+//! Descriptor de una salida apagada, a partir de las definiciones de ciaa.h y shield.h
+#define BOARD_OUTPUT(NAME, FLAGS)                                                                                      \
+    {NAME##_PORT, NAME##_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | NAME##_FUNC, NAME##_GPIO, NAME##_BIT,              \
+     BOARD_PIN_OUTPUT | (FLAGS)}
+
+//! Descriptor de una entrada con resistencia de pull-up, a partir de las definiciones de shield.h
+#define BOARD_INPUT(NAME, FLAGS)                                                                                       \
+    {NAME##_PORT, NAME##_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | NAME##_FUNC, NAME##_GPIO, NAME##_BIT, (FLAGS)}
+
+//! Temporizador que genera el tono del zumbador
+#define BUZZER_TONE_TIMER       LPC_TIMER1
+#define BUZZER_TONE_CLOCK       CLK_MX_TIMER1
+#define BUZZER_TONE_IRQ         TIMER1_IRQn
+#define BUZZER_TONE_HANDLER     TIMER1_IRQHandler
+
+//! Temporizador que marca la duración de las notas del zumbador, cuenta milisegundos
+#define BUZZER_STEP_TIMER       LPC_TIMER2
+#define BUZZER_STEP_CLOCK       CLK_MX_TIMER2
+#define BUZZER_STEP_IRQ         TIMER2_IRQn
+#define BUZZER_STEP_HANDLER     TIMER2_IRQHandler
+
+//! UART del puerto USB de depuración, recibe los comandos del enlace serie
+#define SERIAL_UART             LPC_USART2
+#define SERIAL_UART_IRQ         USART2_IRQn
+#define SERIAL_UART_HANDLER     UART2_IRQHandler
+
+//! Cantidad de bytes que se entregan juntos desde la interrupción, la FIFO de recepción tiene 16
+#define SERIAL_UART_CHUNK       16
+
+//! Prioridad de la interrupción de la UART, la más alta que puede llamar a FreeRTOS (ver FreeRTOSConfig.h)
+#define SERIAL_UART_PRIORITY    5
+
 /* === Private data type declarations ============================================================================== */
 
-/* === Private function declarations =============================================================================== */
+//! Pines de la placa, el orden define las dos etapas de configuración del arranque
+typedef enum {
+    BOARD_DIGIT_1,
+    BOARD_DIGIT_2,
+    BOARD_DIGIT_3,
+    BOARD_DIGIT_4,
+    BOARD_SEGMENT_A,
+    BOARD_SEGMENT_B,
+    BOARD_SEGMENT_C,
+    BOARD_SEGMENT_D,
+    BOARD_SEGMENT_E,
+    BOARD_SEGMENT_F,
+    BOARD_SEGMENT_G,
+    BOARD_SEGMENT_P,
+    BOARD_BUZZER,
+    BOARD_RGB_RED,
+    BOARD_RGB_GREEN,
+    BOARD_RGB_BLUE,
+    BOARD_DEFERRED_PINS, //!< Primer pin de la segunda etapa, que se configura después de mostrar la hora
+    BOARD_CIAA_LED_R = BOARD_DEFERRED_PINS,
+    BOARD_CIAA_LED_G,
+    BOARD_CIAA_LED_1,
+    BOARD_CIAA_LED_2,
+    BOARD_CIAA_LED_3,
+    BOARD_KEY_F1,
+    BOARD_KEY_F2,
+    BOARD_KEY_F3,
+    BOARD_KEY_F4,
+    BOARD_KEY_ACCEPT,
+    BOARD_KEY_CANCEL,
+    BOARD_PINS_COUNT, //!< Cantidad de pines, no es un pin válido
+} board_pin_id_t;
+
+//! Descripción de un pin de la placa
+typedef struct board_pin_s {
+    uint8_t port;  //!< Puerto del SCU
+    uint8_t pin;   //!< Pin del SCU
+    uint16_t mode; //!< Modo y función del SCU
+    uint8_t gpio;  //!< Puerto GPIO
+    uint8_t bit;   //!< Bit dentro del puerto GPIO
+    uint8_t flags; //!< Combinación de BOARD_PIN_OUTPUT y BOARD_PIN_ACTIVE_HIGH
+} const * board_pin_t;
 
-/**
- * @brief Función para apagar los LEDs de la placa EDU-CIAA
- * 
- */
-void CiaaTurnOff(void);
+/* === Private function declarations =============================================================================== */
 
 /**
  * @brief Función para apagar los dígitos de la pantalla
@@ -72,89 +166,167 @@ void DigitsTurnOn(uint8_t digit);
  */
 void DotsTurnOff(void);
 
-/* === Private variable definitions ================================================================================ */
-
-static const struct screen_driver_s screen_driver = {
-    .DigitsTurnOff = DigitsTurnOff,
-    .SegmentsUpdate = SegmentsUpdate,
-    .DigitsTurnOn = DigitsTurnOn,
-    // .DotsTurnOff = DotsTurnOff,
-};
-
-/* === Public variable definitions ================================================================================= */
+/**
+ * @brief   Función para programar una página completa de la EEPROM
+ *
+ * @param   page    Número de página
+ * @param   words   Contenido de la página
+ */
+static void EepromProgramPage(uint32_t page, const uint32_t * words);
 
-/* === Private function definitions ================================================================================ */
+/**
+ * @brief           Función para configurar un grupo de pines de la tabla de la placa, con las salidas apagadas
+ *
+ * @param first     Primer pin del grupo
+ * @param last      Pin siguiente al último del grupo
+ */
+static void BoardPinsInit(board_pin_id_t first, board_pin_id_t last);
 
-void CiaaTurnOff(void) {
-    Chip_SCU_PinMuxSet(LED_R_PORT, LED_R_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_R_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, LED_R_GPIO, LED_R_BIT, false); //Apaga el LED rojo
+/**
+ * @brief           Función para crear la salida digital de un pin de la tabla de la placa
+ *
+ * @param id        Pin de la salida
+ * @return          La salida digital creada
+ */
+static digital_output_t BoardOutputCreate(board_pin_id_t id);
 
-    Chip_SCU_PinMuxSet(LED_G_PORT, LED_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, LED_G_GPIO, LED_G_BIT, false); //Apaga el LED verde
+/**
+ * @brief           Función para crear la entrada digital de un pin de la tabla de la placa
+ *
+ * @param id        Pin de la entrada
+ * @return          La entrada digital creada
+ */
+static digital_input_t BoardInputCreate(board_pin_id_t id);
 
-    Chip_SCU_PinMuxSet(LED_B_PORT, LED_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, LED_B_GPIO, LED_B_BIT, false); //Apaga el LED azul
+/**
+ * @brief           Función para configurar los temporizadores del zumbador, detenidos
+ */
+static void BuzzerTimersInit(void);
 
-    Chip_SCU_PinMuxSet(LED_1_PORT, LED_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, LED_1_GPIO, LED_1_BIT, false); //Apaga el LED 1
+/**
+ * @brief           Función para generar un tono en el zumbador, o silenciarlo
+ *
+ * @param frequency Frecuencia del tono en Hz, cero para silenciar
+ * @param volume    Volumen de 0 a BUZZER_VOLUME_MAX, define el ciclo de trabajo de la onda
+ */
+static void BuzzerTone(uint16_t frequency, uint8_t volume);
 
-    Chip_SCU_PinMuxSet(LED_2_PORT, LED_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, LED_2_GPIO, LED_2_BIT, false); //Apaga el LED 2
+/**
+ * @brief           Función para programar el final de la nota del zumbador
+ *
+ * @param duration  Milisegundos hasta el final de la nota
+ */
+static void BuzzerSchedule(uint16_t duration);
 
-    Chip_SCU_PinMuxSet(LED_3_PORT, LED_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, LED_3_GPIO, LED_3_BIT, false); //Apaga el LED 3
-}
+/**
+ * @brief           Función para detener el temporizador de notas del zumbador
+ */
+static void BuzzerCancel(void);
 
-void DigitsInit(void) {
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
+/* === Private variable definitions ================================================================================ */
 
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
+//! Descripción de la placa: cambiar de placa o de poncho es cambiar esta tabla
+static const struct board_pin_s BOARD_PINS[BOARD_PINS_COUNT] = {
+    [BOARD_DIGIT_1] = BOARD_OUTPUT(DIGIT_1, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_DIGIT_2] = BOARD_OUTPUT(DIGIT_2, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_DIGIT_3] = BOARD_OUTPUT(DIGIT_3, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_DIGIT_4] = BOARD_OUTPUT(DIGIT_4, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_A] = BOARD_OUTPUT(SEGMENT_A, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_B] = BOARD_OUTPUT(SEGMENT_B, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_C] = BOARD_OUTPUT(SEGMENT_C, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_D] = BOARD_OUTPUT(SEGMENT_D, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_E] = BOARD_OUTPUT(SEGMENT_E, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_F] = BOARD_OUTPUT(SEGMENT_F, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_G] = BOARD_OUTPUT(SEGMENT_G, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_SEGMENT_P] = BOARD_OUTPUT(SEGMENT_P, BOARD_PIN_ACTIVE_HIGH),
+    // El zumbador comparte el pin P2_2 (GPIO5[2]) con el LED azul de la EDU-CIAA, que no se configura aparte
+    [BOARD_BUZZER] = BOARD_OUTPUT(BUZZER, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_RGB_RED] = BOARD_OUTPUT(SHIELD_RGB_RED, 0),
+    [BOARD_RGB_GREEN] = BOARD_OUTPUT(SHIELD_RGB_GREEN, 0),
+    [BOARD_RGB_BLUE] = BOARD_OUTPUT(SHIELD_RGB_BLUE, 0),
+    [BOARD_CIAA_LED_R] = BOARD_OUTPUT(LED_R, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_CIAA_LED_G] = BOARD_OUTPUT(LED_G, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_CIAA_LED_1] = BOARD_OUTPUT(LED_1, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_CIAA_LED_2] = BOARD_OUTPUT(LED_2, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_CIAA_LED_3] = BOARD_OUTPUT(LED_3, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_KEY_F1] = BOARD_INPUT(KEY_F1, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_KEY_F2] = BOARD_INPUT(KEY_F2, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_KEY_F3] = BOARD_INPUT(KEY_F3, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_KEY_F4] = BOARD_INPUT(KEY_F4, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_KEY_ACCEPT] = BOARD_INPUT(KEY_ACCEPT, BOARD_PIN_ACTIVE_HIGH),
+    [BOARD_KEY_CANCEL] = BOARD_INPUT(KEY_CANCEL, BOARD_PIN_ACTIVE_HIGH),
+};
 
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
+static const struct screen_driver_s screen_driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitsTurnOn = DigitsTurnOn,
+    // .DotsTurnOff = DotsTurnOff,
+};
 
-    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, true);
-}
+static const struct buzzer_driver_s buzzer_driver = {
+    .Tone = BuzzerTone,
+    .Schedule = BuzzerSchedule,
+    .Cancel = BuzzerCancel,
+};
 
-void SegmentsInit(void) {
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
+//! Generador de tonos del zumbador, recibe los vencimientos del temporizador de notas
+static buzzer_t buzzer;
 
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
+//! Función que recibe los bytes de la UART del puerto USB de depuración
+static uart_receive_t uart_receive;
 
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
+/* === Public variable definitions ================================================================================= */
 
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
+/* === Private function definitions ================================================================================ */
 
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
+static void BoardPinsInit(board_pin_id_t first, board_pin_id_t last) {
+    uint32_t high[BOARD_GPIO_PORTS] = {0};
+    uint32_t low[BOARD_GPIO_PORTS] = {0};
+    uint32_t outputs[BOARD_GPIO_PORTS] = {0};
+    uint32_t inputs[BOARD_GPIO_PORTS] = {0};
+
+    for (board_pin_id_t id = first; id < last; id++) {
+        board_pin_t pin = &BOARD_PINS[id];
+        uint32_t mask = 1UL << pin->bit;
+
+        Chip_SCU_PinMuxSet(pin->port, pin->pin, pin->mode);
+        if (!(pin->flags & BOARD_PIN_OUTPUT)) {
+            inputs[pin->gpio] |= mask;
+        } else if (pin->flags & BOARD_PIN_ACTIVE_HIGH) {
+            outputs[pin->gpio] |= mask;
+            low[pin->gpio] |= mask;
+        } else {
+            outputs[pin->gpio] |= mask;
+            high[pin->gpio] |= mask;
+        }
+    }
 
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
+    // Una escritura por puerto: primero el nivel de reposo y después la dirección, para no generar pulsos
+    for (uint8_t gpio = 0; gpio < BOARD_GPIO_PORTS; gpio++) {
+        if (high[gpio]) {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, gpio, high[gpio]);
+        }
+        if (low[gpio]) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, gpio, low[gpio]);
+        }
+        if (outputs[gpio]) {
+            Chip_GPIO_SetPortDIROutput(LPC_GPIO_PORT, gpio, outputs[gpio]);
+        }
+        if (inputs[gpio]) {
+            Chip_GPIO_SetPortDIRInput(LPC_GPIO_PORT, gpio, inputs[gpio]);
+        }
+    }
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
+static digital_output_t BoardOutputCreate(board_pin_id_t id) {
+    board_pin_t pin = &BOARD_PINS[id];
+    return DigitalOutputCreate(pin->gpio, pin->bit, (pin->flags & BOARD_PIN_ACTIVE_HIGH) != 0);
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, true);
+static digital_input_t BoardInputCreate(board_pin_id_t id) {
+    board_pin_t pin = &BOARD_PINS[id];
+    return DigitalInputCreate(pin->gpio, pin->bit, !(pin->flags & BOARD_PIN_ACTIVE_HIGH));
 }
 
 void DigitsTurnOff(void) {
@@ -175,50 +347,135 @@ void DotsTurnOff(void) {
     Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false); //Apaga el punto decimal
 }
 
-/* === Public function definitions ============================================================================== */
+static void BuzzerTimersInit(void) {
+    Chip_TIMER_Init(BUZZER_TONE_TIMER);
+    Chip_TIMER_Reset(BUZZER_TONE_TIMER);
+    Chip_TIMER_MatchEnableInt(BUZZER_TONE_TIMER, 0);
+    Chip_TIMER_ResetOnMatchEnable(BUZZER_TONE_TIMER, 0);
+    Chip_TIMER_MatchEnableInt(BUZZER_TONE_TIMER, 1);
+
+    Chip_TIMER_Init(BUZZER_STEP_TIMER);
+    Chip_TIMER_Reset(BUZZER_STEP_TIMER);
+    Chip_TIMER_PrescaleSet(BUZZER_STEP_TIMER, Chip_Clock_GetRate(BUZZER_STEP_CLOCK) / 1000 - 1);
+    Chip_TIMER_MatchEnableInt(BUZZER_STEP_TIMER, 0);
+    Chip_TIMER_ResetOnMatchEnable(BUZZER_STEP_TIMER, 0);
+    Chip_TIMER_StopOnMatchEnable(BUZZER_STEP_TIMER, 0);
+
+    // El tono tiene la prioridad más alta para que la forma de onda no se deforme, ninguna llama a FreeRTOS
+    NVIC_SetPriority(BUZZER_TONE_IRQ, 0);
+    NVIC_SetPriority(BUZZER_STEP_IRQ, 1);
+    NVIC_EnableIRQ(BUZZER_TONE_IRQ);
+    NVIC_EnableIRQ(BUZZER_STEP_IRQ);
+}
 
-board_t BoardCreate() {
-    struct board_s * self = malloc(sizeof(struct board_s));
-    if (self != NULL) {
-        CiaaTurnOff();  // Apaga los leds de la EDU_CIAA
+/* P2_2 no tiene salidas de coincidencia de temporizadores ni del SCT, por lo que el temporizador marca el período
+ * (MR0) y el fin del pulso (MR1) y la interrupción sólo cambia el nivel del pin. */
+static void BuzzerTone(uint16_t frequency, uint8_t volume) {
+    Chip_TIMER_Disable(BUZZER_TONE_TIMER);
+    Chip_TIMER_ClearMatch(BUZZER_TONE_TIMER, 0);
+    Chip_TIMER_ClearMatch(BUZZER_TONE_TIMER, 1);
+    NVIC_ClearPendingIRQ(BUZZER_TONE_IRQ);
+    Chip_GPIO_SetPinOutLow(LPC_GPIO_PORT, BUZZER_GPIO, BUZZER_BIT);
+
+    if (frequency && volume) {
+        uint32_t period = Chip_Clock_GetRate(BUZZER_TONE_CLOCK) / frequency;
+        if (volume > BUZZER_VOLUME_MAX) {
+            volume = BUZZER_VOLUME_MAX;
+        }
+        Chip_TIMER_Reset(BUZZER_TONE_TIMER);
+        Chip_TIMER_SetMatch(BUZZER_TONE_TIMER, 0, period - 1);
+        Chip_TIMER_SetMatch(BUZZER_TONE_TIMER, 1, period * volume / (2 * BUZZER_VOLUME_MAX));
+        Chip_TIMER_Enable(BUZZER_TONE_TIMER);
+    }
+}
 
-        // Salidas digitales
-        Chip_SCU_PinMuxSet(SHIELD_RGB_RED_PORT, SHIELD_RGB_RED_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SHIELD_RGB_RED_FUNC);
-        self->led_red = DigitalOutputCreate(SHIELD_RGB_RED_GPIO, SHIELD_RGB_RED_BIT, false);
+static void BuzzerSchedule(uint16_t duration) {
+    Chip_TIMER_Disable(BUZZER_STEP_TIMER);
+    Chip_TIMER_Reset(BUZZER_STEP_TIMER);
+    Chip_TIMER_SetMatch(BUZZER_STEP_TIMER, 0, duration);
+    Chip_TIMER_Enable(BUZZER_STEP_TIMER);
+}
 
-        Chip_SCU_PinMuxSet(SHIELD_RGB_GREEN_PORT, SHIELD_RGB_GREEN_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SHIELD_RGB_GREEN_FUNC);
-        self->led_green = DigitalOutputCreate(SHIELD_RGB_GREEN_GPIO, SHIELD_RGB_GREEN_BIT, false);
+static void BuzzerCancel(void) {
+    Chip_TIMER_Disable(BUZZER_STEP_TIMER);
+    Chip_TIMER_ClearMatch(BUZZER_STEP_TIMER, 0);
+    NVIC_ClearPendingIRQ(BUZZER_STEP_IRQ);
+}
 
-        Chip_SCU_PinMuxSet(SHIELD_RGB_BLUE_PORT, SHIELD_RGB_BLUE_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SHIELD_RGB_BLUE_FUNC);
-        self->led_blue = DigitalOutputCreate(SHIELD_RGB_BLUE_GPIO, SHIELD_RGB_BLUE_BIT, false);
+static void EepromProgramPage(uint32_t page, const uint32_t * words) {
+    volatile uint32_t * target = (volatile uint32_t *)EEPROM_ADDRESS(page, 0);
 
-        Chip_SCU_PinMuxSet(BUZZER_PORT, BUZZER_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | BUZZER_FUNC);
-        self->buzzer = DigitalOutputCreate(BUZZER_PORT, BUZZER_PIN, true);
-        
-        // Entradas digitales
-        Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F1_FUNC);
-        self->set_time = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, false);
+    // La EEPROM sólo acepta escrituras de 32 bits en el registro de página, que luego se programa completo
+    for (uint32_t index = 0; index < EEPROM_PAGE_SIZE / sizeof(uint32_t); index++) {
+        target[index] = words[index];
+    }
+    Chip_EEPROM_EraseProgramPage(LPC_EEPROM);
+    Chip_EEPROM_WaitForIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+}
 
-        Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F2_FUNC);
-        self->set_alarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, false);
+/* === Public function definitions ============================================================================== */
 
-        Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F3_FUNC);
-        self->decrease = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, false);
+board_t BoardCreate() {
+    static struct board_s self[1];
+    memset(self, 0, sizeof(struct board_s));
+
+    // La pantalla y las salidas de la alarma primero, para mostrar la hora cuanto antes con el zumbador apagado
+    BoardPinsInit(0, BOARD_DEFERRED_PINS);
+    self->screen = ScreenCreate(4, &(screen_driver));
+
+    BuzzerTimersInit();
+    buzzer = BuzzerCreate(&buzzer_driver);
+    self->buzzer = buzzer;
+    self->led_red = BoardOutputCreate(BOARD_RGB_RED);
+    self->led_green = BoardOutputCreate(BOARD_RGB_GREEN);
+    self->led_blue = BoardOutputCreate(BOARD_RGB_BLUE);
+    return self;
+}
 
-        Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F4_FUNC);
-        self->increase = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, false);
+void BoardCompleteInit(board_t self) {
+    // Apaga los leds de la EDU-CIAA y configura las teclas
+    BoardPinsInit(BOARD_DEFERRED_PINS, BOARD_PINS_COUNT);
 
-        Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_ACCEPT_FUNC);
-        self->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, false);
+    self->set_time = BoardInputCreate(BOARD_KEY_F1);
+    self->set_alarm = BoardInputCreate(BOARD_KEY_F2);
+    self->decrease = BoardInputCreate(BOARD_KEY_F3);
+    self->increase = BoardInputCreate(BOARD_KEY_F4);
+    self->accept = BoardInputCreate(BOARD_KEY_ACCEPT);
+    self->cancel = BoardInputCreate(BOARD_KEY_CANCEL);
+}
 
-        Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_CANCEL_FUNC);
-        self->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, false);
-        
-        DigitsInit();
-        SegmentsInit();
-        self->screen = ScreenCreate(4, &(screen_driver));
+void BUZZER_TONE_HANDLER(void) {
+    if (Chip_TIMER_MatchPending(BUZZER_TONE_TIMER, 0)) {
+        Chip_TIMER_ClearMatch(BUZZER_TONE_TIMER, 0);
+        Chip_GPIO_SetPinOutHigh(LPC_GPIO_PORT, BUZZER_GPIO, BUZZER_BIT);
+    }
+    if (Chip_TIMER_MatchPending(BUZZER_TONE_TIMER, 1)) {
+        Chip_TIMER_ClearMatch(BUZZER_TONE_TIMER, 1);
+        Chip_GPIO_SetPinOutLow(LPC_GPIO_PORT, BUZZER_GPIO, BUZZER_BIT);
+    }
+}
+
+void BUZZER_STEP_HANDLER(void) {
+    Chip_TIMER_ClearMatch(BUZZER_STEP_TIMER, 0);
+    BuzzerStepElapsed(buzzer);
+}
+
+/* La FIFO interrumpe con 8 bytes o, si quedan menos, al pasar el tiempo de 4 caracteres sin recibir; se vacía
+ * completa en cada interrupción para entregar los bytes en bloques en lugar de uno por uno. */
+void SERIAL_UART_HANDLER(void) {
+    uint8_t data[SERIAL_UART_CHUNK];
+    uint16_t size = 0;
+
+    while (Chip_UART_ReadLineStatus(SERIAL_UART) & UART_LSR_RDR) {
+        data[size++] = Chip_UART_ReadByte(SERIAL_UART);
+        if (size == SERIAL_UART_CHUNK) {
+            uart_receive(data, size);
+            size = 0;
+        }
+    }
+    if (size) {
+        uart_receive(data, size);
     }
-    return self;
 }
 
 void SysTickInit(uint32_t ticks) {
@@ -227,4 +484,154 @@ void SysTickInit(uint32_t ticks) {
     NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
 }
 
+uint16_t CycleCounterInit(void) {
+    SystemCoreClockUpdate();
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    return (uint16_t)(SystemCoreClock / 1000000);
+}
+
+uint32_t CycleCounterRead(void) {
+    return DWT->CYCCNT;
+}
+
+uint32_t CpuSleep(void) {
+    uint32_t start;
+    uint32_t slept;
+
+    // Con las interrupciones enmascaradas WFI igual despierta, pero la interrupción se atiende después de medir
+    __disable_irq();
+    start = DWT->CYCCNT;
+    __DSB();
+    __WFI();
+    slept = DWT->CYCCNT - start;
+    __enable_irq();
+    __ISB();
+    return slept;
+}
+
+void RtcInit(void) {
+    Chip_RTC_Init(LPC_RTC);
+    Chip_RTC_Enable(LPC_RTC, ENABLE);
+}
+
+bool RtcReadSeconds(uint32_t * seconds) {
+    RTC_TIME_T time;
+
+    // Los registros de respaldo se borran junto con la hora del RTC al perder la alimentación
+    if (Chip_REGFILE_Read(LPC_REGFILE, RTC_VALID_REGISTER) != RTC_VALID_MARK) {
+        return false;
+    }
+    Chip_RTC_GetFullTime(LPC_RTC, &time);
+    clock_date_t date = {
+        .year = (uint16_t)time.time[RTC_TIMETYPE_YEAR],
+        .month = (uint8_t)time.time[RTC_TIMETYPE_MONTH],
+        .day = (uint8_t)time.time[RTC_TIMETYPE_DAYOFMONTH],
+    };
+    if (!ClockDateIsValid(&date)) {
+        return false;
+    }
+    *seconds = ClockDateToDays(&date) * 86400UL +
+               (time.time[RTC_TIMETYPE_HOUR] * 60 + time.time[RTC_TIMETYPE_MINUTE]) * 60 + time.time[RTC_TIMETYPE_SECOND];
+    return true;
+}
+
+void RtcWriteSeconds(uint32_t seconds) {
+    RTC_TIME_T time;
+
+    clock_date_t date;
+    uint32_t days = seconds / 86400UL;
+
+    ClockDaysToDate(days, &date);
+    seconds = seconds % 86400UL;
+    time.time[RTC_TIMETYPE_SECOND] = seconds % 60;
+    time.time[RTC_TIMETYPE_MINUTE] = (seconds / 60) % 60;
+    time.time[RTC_TIMETYPE_HOUR] = seconds / 3600;
+    time.time[RTC_TIMETYPE_DAYOFMONTH] = date.day;
+    time.time[RTC_TIMETYPE_DAYOFWEEK] = ClockDaysToWeekday(days);
+    time.time[RTC_TIMETYPE_DAYOFYEAR] = days - ClockDateToDays(&(clock_date_t){.year = date.year, .month = 1, .day = 1}) + 1;
+    time.time[RTC_TIMETYPE_MONTH] = date.month;
+    time.time[RTC_TIMETYPE_YEAR] = date.year;
+
+    // El divisor del segundo se reinicia con el RTC detenido, así el segundo escrito comienza ahora
+    Chip_RTC_Enable(LPC_RTC, DISABLE);
+    Chip_RTC_ResetClockTickCounter(LPC_RTC);
+    Chip_RTC_SetFullTime(LPC_RTC, &time);
+    Chip_RTC_Enable(LPC_RTC, ENABLE);
+    Chip_REGFILE_Write(LPC_REGFILE, RTC_VALID_REGISTER, RTC_VALID_MARK);
+}
+
+void EepromInit(void) {
+    Chip_EEPROM_Init(LPC_EEPROM);
+    Chip_EEPROM_SetAutoProg(LPC_EEPROM, EEPROM_AUTOPROG_OFF);
+}
+
+bool EepromRead(uint32_t address, void * data, uint16_t size) {
+    if ((address + size) > EEPROM_LOG_SIZE) {
+        return false;
+    }
+    memcpy(data, (const void *)(EEPROM_START + address), size);
+    return true;
+}
+
+bool EepromWrite(uint32_t address, const void * data, uint16_t size) {
+    const uint8_t * bytes = data;
+    uint32_t words[EEPROM_PAGE_SIZE / sizeof(uint32_t)];
+
+    if ((address + size) > EEPROM_LOG_SIZE) {
+        return false;
+    }
+    while (size) {
+        uint32_t page = address / EEPROM_PAGE_SIZE;
+        uint32_t offset = address % EEPROM_PAGE_SIZE;
+        uint16_t chunk = (uint16_t)(((EEPROM_PAGE_SIZE - offset) < size) ? (EEPROM_PAGE_SIZE - offset) : size);
+
+        memcpy(words, (const void *)EEPROM_ADDRESS(page, 0), EEPROM_PAGE_SIZE);
+        memcpy((uint8_t *)words + offset, bytes, chunk);
+        EepromProgramPage(page, words);
+        if (memcmp((const void *)EEPROM_ADDRESS(page, offset), bytes, chunk) != 0) {
+            return false;
+        }
+        address += chunk;
+        bytes += chunk;
+        size -= chunk;
+    }
+    return true;
+}
+
+bool EepromErase(uint8_t sector) {
+    uint32_t words[EEPROM_PAGE_SIZE / sizeof(uint32_t)];
+
+    if (sector >= PERSIST_SECTORS) {
+        return false;
+    }
+    memset(words, 0xFF, sizeof(words));
+    for (uint32_t page = 0; page < PERSIST_SECTOR_SIZE / EEPROM_PAGE_SIZE; page++) {
+        EepromProgramPage(sector * (PERSIST_SECTOR_SIZE / EEPROM_PAGE_SIZE) + page, words);
+    }
+    return true;
+}
+
+void UartInit(uint32_t baud, uart_receive_t receive) {
+    uart_receive = receive;
+
+    Chip_SCU_PinMuxSet(UART_TXD_PORT, UART_TXD_PIN, SCU_MODE_PULLDOWN | UART_TXD_FUNC);
+    Chip_SCU_PinMuxSet(UART_RXD_PORT, UART_RXD_PIN, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | UART_RXD_FUNC);
+
+    Chip_UART_Init(SERIAL_UART);
+    Chip_UART_SetBaudFDR(SERIAL_UART, baud);
+    Chip_UART_ConfigData(SERIAL_UART, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    Chip_UART_SetupFIFOS(SERIAL_UART, UART_FCR_FIFO_EN | UART_FCR_RX_RS | UART_FCR_TX_RS | UART_FCR_TRG_LEV2);
+    Chip_UART_TXEnable(SERIAL_UART);
+
+    Chip_UART_IntEnable(SERIAL_UART, UART_IER_RBRINT);
+    NVIC_SetPriority(SERIAL_UART_IRQ, SERIAL_UART_PRIORITY);
+    NVIC_EnableIRQ(SERIAL_UART_IRQ);
+}
+
+void UartWrite(const uint8_t * data, uint16_t size) {
+    Chip_UART_SendBlocking(SERIAL_UART, data, size);
+}
+
 /* === End of documentation ======================================================================================== */
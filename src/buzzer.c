@@ -0,0 +1,149 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file buzzer.c
+ ** @brief Código fuente del generador de tonos del zumbador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "buzzer.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Frecuencia de los pitidos, cercana a la de resonancia de un zumbador piezoeléctrico
+#define BEEP_FREQUENCY 2700
+
+//! Pitido de 100 ms seguido de un silencio de 100 ms, con el volumen indicado
+#define BEEP(VOLUME) {BEEP_FREQUENCY, (VOLUME), 100}, {0, 0, 100}
+
+//! Silencio entre grupos de pitidos
+#define PAUSE {0, 0, 600}
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura interna del generador de tonos
+struct buzzer_s {
+    buzzer_driver_t driver;          //!< Controlador del zumbador
+    volatile buzzer_melody_t melody; //!< Melodía que está sonando, NULL si está en silencio
+    volatile uint8_t step;           //!< Nota que está sonando
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief       Genera la nota actual de la melodía y programa su final.
+ *
+ * @param self  El generador de tonos.
+ */
+static void BuzzerPlayStep(buzzer_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+static const buzzer_note_t BEEPS_NOTES[] = {
+    BEEP(BUZZER_VOLUME_MAX), BEEP(BUZZER_VOLUME_MAX), BEEP(BUZZER_VOLUME_MAX), BEEP(BUZZER_VOLUME_MAX), PAUSE,
+};
+
+static const buzzer_note_t ESCALATING_NOTES[] = {
+    BEEP(10), BEEP(10), PAUSE, BEEP(30), BEEP(30), PAUSE, BEEP(60), BEEP(60), PAUSE,
+    BEEP(BUZZER_VOLUME_MAX), BEEP(BUZZER_VOLUME_MAX), BEEP(BUZZER_VOLUME_MAX), BEEP(BUZZER_VOLUME_MAX), PAUSE,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+const struct buzzer_melody_s BUZZER_MELODY_BEEPS = {
+    .notes = BEEPS_NOTES,
+    .count = sizeof(BEEPS_NOTES) / sizeof(BEEPS_NOTES[0]),
+    .repeat_from = 0,
+};
+
+const struct buzzer_melody_s BUZZER_MELODY_ESCALATING = {
+    .notes = ESCALATING_NOTES,
+    .count = sizeof(ESCALATING_NOTES) / sizeof(ESCALATING_NOTES[0]),
+    .repeat_from = 15, // Primer pitido al volumen máximo
+};
+
+/* === Private function definitions ================================================================================ */
+
+static void BuzzerPlayStep(buzzer_t self) {
+    const buzzer_note_t * note = &self->melody->notes[self->step];
+    self->driver->Tone(note->frequency, note->volume);
+    self->driver->Schedule(note->duration);
+}
+
+/* === Public function definitions ============================================================================== */
+
+buzzer_t BuzzerCreate(buzzer_driver_t driver) {
+    static struct buzzer_s self[1];
+
+    if (!driver || !driver->Tone || !driver->Schedule || !driver->Cancel) {
+        return NULL;
+    }
+    self->driver = driver;
+    self->melody = NULL;
+    self->step = 0;
+    driver->Cancel();
+    driver->Tone(0, 0);
+    return self;
+}
+
+void BuzzerPlay(buzzer_t self, buzzer_melody_t melody) {
+    if (!self || !melody || !melody->count) {
+        return;
+    }
+    // Sin el temporizador de notas la interrupción no puede cambiar la melodía mientras se reemplaza
+    self->driver->Cancel();
+    self->melody = melody;
+    self->step = 0;
+    BuzzerPlayStep(self);
+}
+
+void BuzzerStop(buzzer_t self) {
+    if (!self || !self->melody) {
+        return;
+    }
+    self->driver->Cancel();
+    self->melody = NULL;
+    self->driver->Tone(0, 0);
+}
+
+bool BuzzerIsPlaying(buzzer_t self) {
+    return self && self->melody;
+}
+
+void BuzzerStepElapsed(buzzer_t self) {
+    if (!self || !self->melody) {
+        return;
+    }
+    uint8_t step = self->step + 1;
+    if (step >= self->melody->count) {
+        if (self->melody->repeat_from >= self->melody->count) {
+            self->melody = NULL;
+            self->driver->Tone(0, 0);
+            return;
+        }
+        step = self->melody->repeat_from;
+    }
+    self->step = step;
+    BuzzerPlayStep(self);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,183 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chrono.c
+ ** @brief Código fuente del temporizador de cuenta regresiva y del cronómetro
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chrono.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Segundos de un minuto y minutos de una hora
+#define CHRONO_SIXTY 60
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura interna del temporizador o cronómetro
+struct chrono_s {
+    chrono_kind_t kind;           //!< Temporizador o cronómetro
+    source_get_ticks_t get_ticks; //!< Contador libre de ticks
+    uint16_t ticks_per_second;    //!< Ticks por segundo del contador
+    uint32_t countdown;           //!< Duración de la cuenta regresiva en segundos, cero en el cronómetro
+    uint32_t accumulated;         //!< Ticks contados hasta la última detención
+    uint32_t start;               //!< Valor del contador al poner en marcha la cuenta
+    bool running;                 //!< Indica si la cuenta está en marcha
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief       Calcula el tiempo contado en centésimas, leyendo el contador sólo si la cuenta está en marcha.
+ *
+ * @param self  El temporizador o cronómetro.
+ * @return      Centésimas de segundo contadas desde el comienzo.
+ */
+static uint32_t ChronoElapsed(chrono_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Instancias, indexadas por chrono_kind_t
+static struct chrono_s instances[CHRONO_COUNT];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t ChronoElapsed(chrono_t self) {
+    uint32_t ticks = self->accumulated;
+    if (self->running) {
+        ticks += self->get_ticks() - self->start; // La resta sin signo tolera el desborde del contador
+    }
+    // Se divide antes de multiplicar para que los ticks de varias horas no desborden
+    return (ticks / self->ticks_per_second) * CHRONO_CENTISECONDS +
+           (ticks % self->ticks_per_second) * CHRONO_CENTISECONDS / self->ticks_per_second;
+}
+
+/* === Public function definitions ============================================================================== */
+
+chrono_t ChronoCreate(chrono_kind_t kind, source_get_ticks_t get_ticks, uint16_t ticks_per_second) {
+    if ((kind >= CHRONO_COUNT) || !get_ticks || !ticks_per_second) {
+        return NULL;
+    }
+    chrono_t self = &instances[kind];
+    memset(self, 0, sizeof(struct chrono_s));
+    self->kind = kind;
+    self->get_ticks = get_ticks;
+    self->ticks_per_second = ticks_per_second;
+    return self;
+}
+
+void ChronoSetCountdown(chrono_t self, uint32_t seconds) {
+    if (!self || (self->kind != CHRONO_TIMER)) {
+        return;
+    }
+    self->countdown = seconds;
+    ChronoReset(self);
+}
+
+uint32_t ChronoGetCountdown(chrono_t self) {
+    return self ? self->countdown : 0;
+}
+
+void ChronoStart(chrono_t self) {
+    if (!self || self->running || ChronoExpired(self)) {
+        return;
+    }
+    self->start = self->get_ticks();
+    self->running = true;
+}
+
+void ChronoStop(chrono_t self) {
+    if (!self || !self->running) {
+        return;
+    }
+    self->accumulated += self->get_ticks() - self->start;
+    self->running = false;
+}
+
+void ChronoReset(chrono_t self) {
+    if (!self) {
+        return;
+    }
+    self->accumulated = 0;
+    self->running = false;
+}
+
+bool ChronoIsRunning(chrono_t self) {
+    return self && self->running;
+}
+
+bool ChronoExpired(chrono_t self) {
+    if (!self || (self->kind != CHRONO_TIMER)) {
+        return false;
+    }
+    return ChronoElapsed(self) / CHRONO_CENTISECONDS >= self->countdown;
+}
+
+uint32_t ChronoRead(chrono_t self) {
+    if (!self) {
+        return 0;
+    }
+    uint32_t elapsed = ChronoElapsed(self);
+    if (self->kind != CHRONO_TIMER) {
+        return elapsed;
+    }
+    uint32_t total = self->countdown * CHRONO_CENTISECONDS;
+    return (elapsed < total) ? total - elapsed : 0;
+}
+
+void ChronoToBCD(chrono_t self, uint8_t value[4]) {
+    uint32_t centiseconds = ChronoRead(self);
+    uint32_t high;
+    uint32_t low;
+
+    if (self && (self->kind == CHRONO_TIMER)) {
+        uint32_t seconds = (centiseconds + CHRONO_CENTISECONDS - 1) / CHRONO_CENTISECONDS;
+        if (seconds < CHRONO_SIXTY * CHRONO_SIXTY) {
+            high = seconds / CHRONO_SIXTY;
+            low = seconds % CHRONO_SIXTY;
+        } else {
+            uint32_t minutes = (seconds + CHRONO_SIXTY - 1) / CHRONO_SIXTY;
+            high = minutes / CHRONO_SIXTY;
+            low = minutes % CHRONO_SIXTY;
+        }
+    } else if (centiseconds < CHRONO_SIXTY * CHRONO_CENTISECONDS) {
+        high = centiseconds / CHRONO_CENTISECONDS;
+        low = centiseconds % CHRONO_CENTISECONDS;
+    } else if (centiseconds < CHRONO_SIXTY * CHRONO_SIXTY * CHRONO_CENTISECONDS) {
+        high = centiseconds / (CHRONO_SIXTY * CHRONO_CENTISECONDS);
+        low = (centiseconds / CHRONO_CENTISECONDS) % CHRONO_SIXTY;
+    } else {
+        high = centiseconds / (CHRONO_SIXTY * CHRONO_SIXTY * CHRONO_CENTISECONDS);
+        low = (centiseconds / (CHRONO_SIXTY * CHRONO_CENTISECONDS)) % CHRONO_SIXTY;
+    }
+
+    high %= 100; // Más de 99 horas no entran en la pantalla
+    value[0] = (uint8_t)(high / 10);
+    value[1] = (uint8_t)(high % 10);
+    value[2] = (uint8_t)(low / 10);
+    value[3] = (uint8_t)(low % 10);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -24,42 +24,470 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "clock.h"
+#include "trace.h"
 #include <stddef.h>
 #include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+//! Partes por millón, escala del acumulador de la corrección
+#define CLOCK_PPM 1000000
+
+//! Cantidad de segundos de un día
+#define SECONDS_PER_DAY 86400UL
+
+//! Valor del minuto de la última alarma que indica que todavía no sonó
+#define ALARM_NEVER 0xFFFFFFFFUL
+
+//! Días entre el 0000-03-01 del calendario gregoriano proléptico y la época (1970-01-01)
+#define DAYS_TO_EPOCH 719468UL
+
+//! Días de un ciclo de 400 años del calendario gregoriano
+#define DAYS_PER_ERA 146097UL
+
+//! Bit alto de cada uno de los seis dígitos, el dígito n ocupa el byte n de la palabra
+#define CLOCK_DIGITS_HIGH 0x808080808080ULL
+
+//! Sesgo que lleva cada dígito por encima de su límite (9, 5, 9, 5, 9 y 2 desde los segundos) a 0x80 o más
+#define CLOCK_DIGITS_BIAS 0x7D767A767A76ULL
+
+//! Arma la palabra de dígitos con los primeros cuatro bytes y los últimos dos, las CPU del proyecto son little endian
+#define CLOCK_DIGITS_WORD(low, high) ((uint64_t)(low) | ((uint64_t)(high) << 32))
+
+//! Sesgo que hace desbordar cada dígito empaquetado al pasar su límite: 6 sobre 9 y 0xA sobre 5
+#define CLOCK_PACKED_BIAS 0x66A6A6UL
+
+//! Bit menos significativo de cada uno de los seis dígitos empaquetados
+#define CLOCK_PACKED_NIBBLES 0x111111UL
+
+//! Primer valor fuera de rango de las horas empaquetadas (24:00:00)
+#define CLOCK_PACKED_DAY 0x240000UL
+
+//! LEDs de la alarma que se escriben juntos: el rojo (bit 0) se enciende mientras suena, el verde y el azul apagados
+#define CLOCK_ALARM_LEDS 0x7U
+
+//! Bit del LED rojo en el grupo de LEDs de la alarma
+#define CLOCK_ALARM_LED_RINGING 0x1U
+
 /* === Private data type declarations ============================================================================== */
 
 /**
  * @brief                   Definición de la estructura interna del reloj.
- * @param clock_ticks       Cantidad de ticks del reloj.
+ * @param clock_ticks       Cantidad de ticks del segundo en curso.
+ * @param ticks_per_second  Cantidad de ticks por segundo.
+ * @param trim_ppm          Corrección de la frecuencia del oscilador en partes por millón.
+ * @param slew_ppm          Corrección transitoria que se suma a la del oscilador, en partes por millón.
+ * @param rate_ppm          Corrección que se aplica a los ticks, la suma de las dos dentro del límite.
+ * @param trim_accumulator  Fracción de tick acumulada por la corrección, en millonésimas de tick.
+ * @param sync_counter      Valor del contador libre de ticks en la última sincronización.
+ * @param source            Fuente de tiempo asociada, NULL si el reloj se avanza con ClockNewTick o ClockSync.
+ * @param source_seconds    Últimos segundos leídos del calendario de la fuente.
+ * @param source_edge       Valor del contador libre cuando cambiaron los segundos del calendario de la fuente.
+ * @param source_align      Indica si hay que volver a escribir el calendario al comenzar el segundo, para que cuente
+ *                          los segundos con la fracción ajustada por ClockSetUtcMillis.
+ * @param days              Fecha actual en días desde la época (1970-01-01).
  * @param current_time      Tiempo actual del reloj.
  * @param alarm_time        Hora de la alarma.
- * @param alarm_posponed    Hora de la alarma pospuesta.
+ * @param alarm_last        Minuto local, desde la época, en que la alarma sonó a la hora ajustada por última vez.
+ * @param snooze            Configuración del aplazamiento de la alarma.
+ * @param snooze_deadline   Segundo, desde la época, en que vuelve a sonar la alarma aplazada.
+ * @param snooze_count      Cantidad de aplazamientos desde que la alarma sonó a la hora ajustada.
+ * @param snoozed           Indica si hay un aplazamiento pendiente.
+ * @param ring_timeout      Segundos que suena la alarma antes de aplazarse sola, cero si suena hasta que se atiende.
+ * @param ring_deadline     Segundo, desde la época, en que la alarma que está sonando se aplaza sola.
  * @param alarm_enabled     Indica si la alarma está habilitada.
+ * @param alarm_weekdays    Días de la semana en los que suena la alarma, un bit por día desde el domingo.
+ * @param zone              Zona horaria que se aplica al leer la hora.
+ * @param zone_active       Indica si la zona difiere de UTC, si no la hora se lee sin convertir.
+ * @param zone_offset       Diferencia vigente entre la hora local y UTC, en segundos.
+ * @param zone_next         Segundo UTC, desde la época, en que hay que volver a calcular la diferencia vigente.
  * @param valid             Indica si el reloj tiene un tiempo válido.
  * @param alarm_ringing     Indica si la alarma está sonando.
  *
  */
 struct clock_s {
     uint16_t clock_ticks;
+    uint16_t ticks_per_second;
+    int32_t trim_ppm;
+    int32_t slew_ppm;
+    int32_t rate_ppm;
+    int32_t trim_accumulator;
+    uint32_t sync_counter;
+    clock_source_t source;
+    uint32_t source_seconds;
+    uint32_t source_edge;
+    bool source_align;
+    uint32_t days;
     clock_time_t current_time;
     clock_time_t alarm_time;
-    clock_time_t alarm_posponed;
+    uint32_t alarm_last;
+    clock_snooze_t snooze;
+    uint32_t snooze_deadline;
+    uint8_t snooze_count;
+    bool snoozed;
+    uint16_t ring_timeout;
+    uint32_t ring_deadline;
     bool alarm_enabled;
+    uint8_t alarm_weekdays;
+    clock_zone_t zone;
+    bool zone_active;
+    int32_t zone_offset;
+    uint32_t zone_next;
     bool valid;
     bool alarm_ringing;
 };
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief       Avanza un segundo el tiempo actual, propagando el acarreo a minutos y horas.
+ * @param self  El reloj a avanzar.
+ */
+static void ClockIncrementSecond(clock_t self);
+
+/**
+ * @brief       Convierte un tiempo en BCD a segundos desde el comienzo del día.
+ * @param time  El tiempo a convertir.
+ * @return      Segundos desde las 00:00:00.
+ */
+static uint32_t ClockTimeToSeconds(const clock_time_t * time);
+
+/**
+ * @brief       Escribe la fecha y la hora actuales en el calendario de la fuente de tiempo, si lo tiene.
+ * @param self  El reloj.
+ */
+static void ClockWriteSource(clock_t self);
+
+/**
+ * @brief         Convierte segundos desde el comienzo del día a un tiempo en BCD.
+ * @param seconds Segundos desde las 00:00:00, menor a un día.
+ * @param time    El tiempo convertido.
+ */
+static void ClockSecondsToTime(uint32_t seconds, clock_time_t * time);
+
+/**
+ * @brief       Obtiene la fecha y la hora actuales en segundos desde la época.
+ * @param self  El reloj.
+ * @return      Segundos desde 1970-01-01 00:00:00.
+ */
+static uint32_t ClockNowSeconds(clock_t self);
+
+/**
+ * @brief       Calcula la corrección que se aplica a los ticks con la del oscilador y la transitoria.
+ * @param self  El reloj.
+ */
+static void ClockUpdateRate(clock_t self);
+
+/**
+ * @brief       Hace sonar la alarma y fija el instante en que se aplaza sola si nadie la atiende.
+ * @param self  El reloj.
+ * @param now   Fecha y hora actuales en segundos desde la época.
+ */
+static void ClockStartRinging(clock_t self, uint32_t now);
+
+/**
+ * @brief           Verifica que una regla de cambio de horario esté en rango.
+ * @param change    La regla.
+ * @return          true si la regla es válida, false en caso contrario.
+ */
+static bool ClockDstChangeIsValid(const clock_dst_change_t * change);
+
+/**
+ * @brief           Calcula el instante de un cambio de horario en un año.
+ * @param zone      La zona horaria.
+ * @param change    La regla del cambio.
+ * @param year      El año.
+ * @return          Segundos UTC desde la época, negativo si el cambio es anterior a la época.
+ */
+static int64_t ClockDstChangeSeconds(const clock_zone_t * zone, const clock_dst_change_t * change, uint16_t year);
+
+/**
+ * @brief       Indica si rige el horario de verano en un instante y busca el cambio siguiente.
+ * @param zone  La zona horaria, con horario de verano.
+ * @param utc   Segundos UTC desde la época.
+ * @param next  Segundo UTC del próximo cambio de horario, UINT32_MAX si no hay otro en el rango del reloj.
+ * @return      true si rige el horario de verano, false en caso contrario.
+ */
+static bool ClockZoneIsDst(const clock_zone_t * zone, uint32_t utc, uint32_t * next);
+
+/**
+ * @brief       Calcula la diferencia vigente con UTC y el instante en que deja de regir.
+ * @param self  El reloj.
+ * @param utc   Segundos UTC desde la época.
+ */
+static void ClockZoneUpdate(clock_t self, uint32_t utc);
+
+/**
+ * @brief       Convierte un instante UTC a la hora local del reloj.
+ * @param self  El reloj.
+ * @param utc   Segundos UTC desde la época.
+ * @return      Segundos locales desde la época.
+ */
+static uint32_t ClockToLocal(clock_t self, uint32_t utc);
+
+/**
+ * @brief       Establece el reloj a partir de una fecha y hora locales.
+ * @param self  El reloj.
+ * @param local Segundos locales desde la época.
+ */
+static void ClockSetLocal(clock_t self, uint32_t local);
+
+/**
+ * @brief       Actualiza la fecha y la hora con el contador y el calendario de la fuente de tiempo.
+ * @param self  El reloj, con fuente de tiempo.
+ * @return      Ticks del contador transcurridos desde la lectura anterior.
+ */
+static uint32_t ClockReadSource(clock_t self);
+
+/**
+ * @brief       Entra en la sección crítica de la fuente de tiempo, si la tiene.
+ * @param self  El reloj.
+ */
+static void ClockLock(clock_t self);
+
+/**
+ * @brief       Sale de la sección crítica de la fuente de tiempo, si la tiene.
+ * @param self  El reloj.
+ */
+static void ClockUnlock(clock_t self);
+
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void ClockIncrementSecond(clock_t self) {
+    // Incrementar segundos (unidades en [0])
+    self->current_time.time.seconds[0]++;
+    if (self->current_time.time.seconds[0] > 9) {
+        self->current_time.time.seconds[0] = 0;
+        // Incrementar segundos (decenas en [1])
+        self->current_time.time.seconds[1]++;
+        if (self->current_time.time.seconds[1] > 5) {
+            self->current_time.time.seconds[1] = 0;
+
+            // Incrementar minutos (unidades en [0])
+            self->current_time.time.minutes[0]++;
+            if (self->current_time.time.minutes[0] > 9) {
+                self->current_time.time.minutes[0] = 0;
+                // Incrementar minutos (decenas en [1])
+                self->current_time.time.minutes[1]++;
+                if (self->current_time.time.minutes[1] > 5) {
+                    self->current_time.time.minutes[1] = 0;
+
+                    // Incrementar horas (unidades en [0])
+                    self->current_time.time.hours[0]++;
+                    if (self->current_time.time.hours[0] > 9) {
+                        self->current_time.time.hours[0] = 0;
+                        // Incrementar horas (decenas en [1])
+                        self->current_time.time.hours[1]++;
+                    }
+
+                    // Verificar límite de 24 horas: 23 (decenas=2, unidades=3) -> 00 del día siguiente
+                    if ((self->current_time.time.hours[1] == 2) && (self->current_time.time.hours[0] == 4)) {
+                        self->current_time.time.hours[0] = 0;
+                        self->current_time.time.hours[1] = 0;
+                        self->days++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static uint32_t ClockTimeToSeconds(const clock_time_t * time) {
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
+    uint32_t seconds = time->time.seconds[1] * 10 + time->time.seconds[0];
+    return (hours * 60 + minutes) * 60 + seconds;
+}
+
+static uint32_t ClockNowSeconds(clock_t self) {
+    return self->days * SECONDS_PER_DAY + ClockTimeToSeconds(&self->current_time);
+}
+
+static void ClockUpdateRate(clock_t self) {
+    int32_t rate = self->trim_ppm + self->slew_ppm;
+
+    if (rate > CLOCK_TRIM_LIMIT_PPM) {
+        rate = CLOCK_TRIM_LIMIT_PPM;
+    } else if (rate < -CLOCK_TRIM_LIMIT_PPM) {
+        rate = -CLOCK_TRIM_LIMIT_PPM;
+    }
+    self->rate_ppm = rate;
+}
+
+static void ClockStartRinging(clock_t self, uint32_t now) {
+    self->alarm_ringing = true;
+    self->ring_deadline = now + self->ring_timeout;
+}
+
+static void ClockWriteSource(clock_t self) {
+    if (self->source && self->source->WriteSeconds) {
+        self->source_seconds = ClockNowSeconds(self);
+        self->source_edge = self->source->GetTicks();
+        self->source_align = false;
+        self->source->WriteSeconds(self->source_seconds);
+    }
+}
+
+static void ClockSecondsToTime(uint32_t seconds, clock_time_t * time) {
+    uint32_t minutes = seconds / 60;
+    uint32_t hours = minutes / 60;
+
+    seconds = seconds % 60;
+    minutes = minutes % 60;
+    time->time.seconds[0] = seconds % 10;
+    time->time.seconds[1] = seconds / 10;
+    time->time.minutes[0] = minutes % 10;
+    time->time.minutes[1] = minutes / 10;
+    time->time.hours[0] = hours % 10;
+    time->time.hours[1] = hours / 10;
+}
+
+static bool ClockDstChangeIsValid(const clock_dst_change_t * change) {
+    return (change->month >= 1) && (change->month <= 12) && (change->week >= 1) &&
+           (change->week <= CLOCK_DST_LAST_WEEK) && (change->weekday < 7) && (change->minutes < 24 * 60);
+}
+
+static int64_t ClockDstChangeSeconds(const clock_zone_t * zone, const clock_dst_change_t * change, uint16_t year) {
+    clock_date_t first = {.year = year, .month = change->month, .day = 1};
+    uint32_t days = ClockDateToDays(&first);
+    uint32_t day = (7u + change->weekday - ClockDaysToWeekday(days)) % 7 + 7u * (change->week - 1u);
+
+    if (day >= ClockDaysInMonth(year, change->month)) {
+        day -= 7; // La quinta semana no existe en este mes, es la última
+    }
+    return (int64_t)(days + day) * SECONDS_PER_DAY + 60 * ((int64_t)change->minutes - zone->offset_minutes);
+}
+
+static bool ClockZoneIsDst(const clock_zone_t * zone, uint32_t utc, uint32_t * next) {
+    clock_date_t date;
+    int64_t last = -1;
+    int64_t following = UINT32_MAX;
+    bool dst = false;
+
+    // El estado lo fija el último cambio anterior, que puede ser del año pasado; el año siguiente cubre el cambio
+    // próximo cuando ya pasaron los dos de este año
+    ClockDaysToDate(utc / SECONDS_PER_DAY, &date);
+    for (uint16_t year = date.year - 1; year <= date.year + 1; year++) {
+        if ((year < CLOCK_EPOCH_YEAR) || (year > CLOCK_MAX_YEAR)) {
+            continue;
+        }
+        for (uint8_t index = 0; index < 2; index++) {
+            int64_t change = ClockDstChangeSeconds(zone, index ? &zone->end : &zone->start, year);
+            if ((change <= utc) && (change > last)) {
+                last = change;
+                dst = (index == 0);
+            } else if ((change > utc) && (change < following)) {
+                following = change;
+            }
+        }
+    }
+    *next = (uint32_t)following;
+    return dst;
+}
+
+static void ClockZoneUpdate(clock_t self, uint32_t utc) {
+    uint32_t next = UINT32_MAX;
+    int32_t offset = self->zone.offset_minutes * 60;
+
+    if (self->zone.dst_minutes && ClockZoneIsDst(&self->zone, utc, &next)) {
+        offset += self->zone.dst_minutes * 60;
+    }
+    if ((offset < 0) && (utc < (uint32_t)-offset)) {
+        // La hora local sería anterior a la época: se muestra UTC hasta que deje de serlo, sólo pasa con el reloj sin
+        // ajustar y así la lectura no necesita otra comparación
+        next = (uint32_t)-offset;
+        offset = 0;
+    }
+    self->zone_offset = offset;
+    self->zone_next = next;
+}
+
+static uint32_t ClockToLocal(clock_t self, uint32_t utc) {
+    if (utc >= self->zone_next) {
+        ClockZoneUpdate(self, utc);
+    }
+    return utc + (uint32_t)self->zone_offset;
+}
+
+static void ClockSetLocal(clock_t self, uint32_t local) {
+    int64_t utc = (int64_t)local - self->zone.offset_minutes * 60;
+    uint32_t next;
+
+    // Se prueba primero con el horario de verano: en la hora que se repite al terminar se toma la primera vez, y una
+    // hora salteada al comenzar queda adelantada
+    if (self->zone.dst_minutes && (utc >= self->zone.dst_minutes * 60) &&
+        ClockZoneIsDst(&self->zone, (uint32_t)(utc - self->zone.dst_minutes * 60), &next)) {
+        utc -= self->zone.dst_minutes * 60;
+    }
+    if (utc < 0) {
+        utc += SECONDS_PER_DAY; // Hora local anterior a la época, sólo con el reloj sin fecha
+    }
+    self->days = (uint32_t)(utc / SECONDS_PER_DAY);
+    ClockSecondsToTime((uint32_t)(utc % SECONDS_PER_DAY), &self->current_time);
+    self->zone_next = 0; // El reloj pudo retroceder, se vuelve a calcular la diferencia en la próxima lectura
+}
+
+static uint32_t ClockReadSource(clock_t self) {
+    uint32_t seconds;
+    uint32_t counter;
+    uint32_t elapsed;
+
+    counter = self->source->GetTicks();
+    if (!self->source->ReadSeconds) {
+        return ClockSync(self, counter);
+    }
+
+    // Calendario por hardware: no se cuentan ticks, sólo se interpola la fracción del segundo en curso
+    elapsed = counter - self->sync_counter;
+    self->sync_counter = counter;
+    if (self->source_align) {
+        // El calendario todavía cuenta con la fase anterior, se interpola hasta que comienza el segundo ajustado
+        uint32_t fraction = counter - self->source_edge;
+        if (fraction < self->ticks_per_second) {
+            self->clock_ticks = (uint16_t)fraction;
+            return elapsed;
+        }
+        // Al escribirlo el calendario comienza el segundo, el error es la demora de esta llamada
+        seconds = self->source_seconds + fraction / self->ticks_per_second;
+        self->days = seconds / SECONDS_PER_DAY;
+        ClockSecondsToTime(seconds % SECONDS_PER_DAY, &self->current_time);
+        ClockWriteSource(self);
+        self->clock_ticks = 0;
+        return elapsed;
+    }
+    self->valid = self->source->ReadSeconds(&seconds);
+    if (self->valid) {
+        if (seconds != self->source_seconds) {
+            if (seconds < self->source_seconds) {
+                self->zone_next = 0; // El calendario retrocedió, se vuelve a calcular la diferencia con UTC
+            }
+            self->source_seconds = seconds;
+            self->source_edge = counter;
+        }
+        uint32_t fraction = counter - self->source_edge;
+        self->clock_ticks = (fraction < self->ticks_per_second) ? (uint16_t)fraction : self->ticks_per_second - 1;
+        self->days = seconds / SECONDS_PER_DAY;
+        ClockSecondsToTime(seconds % SECONDS_PER_DAY, &self->current_time);
+    }
+    return elapsed;
+}
+
+static void ClockLock(clock_t self) {
+    if (self->source && self->source->EnterCritical) {
+        self->source->EnterCritical();
+    }
+}
+
+static void ClockUnlock(clock_t self) {
+    if (self->source && self->source->ExitCritical) {
+        self->source->ExitCritical();
+    }
+}
+
 /* === Public function definitions ============================================================================== */
 
 clock_t ClockCreate(uint16_t ticks_per_seconds) {
@@ -68,104 +496,390 @@ clock_t ClockCreate(uint16_t ticks_per_seconds) {
     self->valid = false;
     self->alarm_enabled = false;
     self->alarm_ringing = false;
-    self->clock_ticks = ticks_per_seconds;
+    self->clock_ticks = 0;
+    self->ticks_per_second = ticks_per_seconds ? ticks_per_seconds : 1;
+    self->trim_ppm = 0;
+    self->slew_ppm = 0;
+    self->rate_ppm = 0;
+    self->trim_accumulator = 0;
+    self->sync_counter = 0;
+    self->source = NULL;
+    self->days = 0;
+    self->alarm_weekdays = CLOCK_ALARM_EVERY_DAY;
+    self->alarm_last = ALARM_NEVER;
+    self->snooze = (clock_snooze_t){.minutes = 5, .step = 0, .min_minutes = 5, .limit = 0};
     return self;
 }
 
-bool ClockTimeIsValid(clock_time_t * self) {
-    // Validar horas: 00-23
-    if (self->time.hours[0] > 2) {
-        return false; // Decena de horas no puede ser mayor a 2
-    }
-    if ((self->time.hours[0] == 2) && (self->time.hours[1] > 3)) {
-        return false; // Si decena es 2, unidad no puede ser mayor a 3 (máximo 23)
+bool ClockTimeIsValid(const clock_time_t * self) {
+    uint32_t low;
+    uint16_t high;
+
+    // Los seis dígitos se comparan juntos, con el dígito n en el byte n: al sumar el sesgo a los siete bits bajos de
+    // cada byte el bit alto queda en uno sólo si el dígito supera su límite, y la suma nunca pasa al byte siguiente.
+    // Se leen en dos partes que sí existen en memoria, una lectura de 64 bits armada en la pila es más lenta
+    memcpy(&low, &self->bcd[0], sizeof(low));
+    memcpy(&high, &self->bcd[4], sizeof(high));
+    uint64_t digits = CLOCK_DIGITS_WORD(low, high);
+    uint64_t over = (((digits & ~CLOCK_DIGITS_HIGH) + CLOCK_DIGITS_BIAS) | digits) & CLOCK_DIGITS_HIGH;
+
+    // Con los dígitos en rango sólo falta el límite conjunto de las horas (23), se combina sin saltos
+    return (over == 0) & ((self->time.hours[1] * 10U + self->time.hours[0]) < 24U);
+}
+
+uint16_t ClockTimesAreValid(const clock_time_t * times, uint16_t count) {
+    for (uint16_t index = 0; index < count; index++) {
+        if (!ClockTimeIsValid(&times[index])) {
+            return index;
+        }
     }
-    if (self->time.hours[1] > 9) {
-        return false; // Unidad de horas no puede ser mayor a 9
+    return count;
+}
+
+clock_packed_t ClockTimePack(const clock_time_t * time) {
+    return ((clock_packed_t)time->time.hours[1] << 20) | ((clock_packed_t)time->time.hours[0] << 16) |
+           ((clock_packed_t)time->time.minutes[1] << 12) | ((clock_packed_t)time->time.minutes[0] << 8) |
+           ((clock_packed_t)time->time.seconds[1] << 4) | time->time.seconds[0];
+}
+
+void ClockTimeUnpack(clock_packed_t packed, clock_time_t * time) {
+    for (uint8_t digit = 0; digit < sizeof(time->bcd); digit++) {
+        time->bcd[digit] = (packed >> (4 * digit)) & 0x0F;
     }
+}
 
-    // Validar minutos: 00-59
-    if (self->time.minutes[0] > 5) {
-        return false; // Decena de minutos no puede ser mayor a 5
+clock_packed_t ClockPackedIncrement(clock_packed_t packed, bool * next_day) {
+    // Con el sesgo cada dígito que llega a su límite desborda al siguiente en la misma suma; a los dígitos que no
+    // desbordaron se les resta el sesgo, el acarreo de cada dígito aparece en el bit siguiente de sum ^ packed ^ add
+    clock_packed_t add = CLOCK_PACKED_BIAS + 1;
+    clock_packed_t sum = packed + add;
+    clock_packed_t kept = (~(sum ^ packed ^ add) >> 4) & CLOCK_PACKED_NIBBLES;
+    sum -= (kept * 0x0F) & CLOCK_PACKED_BIAS;
+
+    // Las horas desbordan en 24 y no en un límite por dígito, se vuelven a cero sin saltos
+    clock_packed_t wrap = (clock_packed_t)0 - (sum >= CLOCK_PACKED_DAY);
+    if (next_day) {
+        *next_day = wrap != 0;
     }
-    if (self->time.minutes[1] > 9) {
-        return false; // Unidad de minutos no puede ser mayor a 9
+    return sum & ~(wrap & 0xFF0000UL);
+}
+
+bool ClockGetTime(clock_t self, clock_time_t * result) {
+    bool valid;
+
+    ClockLock(self);
+    if (self->zone_active) {
+        ClockSecondsToTime(ClockToLocal(self, ClockNowSeconds(self)) % SECONDS_PER_DAY, result);
+    } else {
+        memcpy(result, &self->current_time, 6);
     }
+    valid = self->valid;
+    ClockUnlock(self);
+    return valid;
+}
 
-    // Validar segundos: 00-59
-    if (self->time.seconds[0] > 5) {
-        return false; // Decena de segundos no puede ser mayor a 5
+bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
+    if (!ClockTimeIsValid(new_time)) {
+        return false; // El reloj conserva la hora anterior
     }
-    if (self->time.seconds[1] > 9) {
-        return false; // Unidad de segundos no puede ser mayor a 9
+    ClockLock(self);
+    if (self->zone_active) {
+        uint32_t local = ClockToLocal(self, ClockNowSeconds(self));
+        ClockSetLocal(self, local - local % SECONDS_PER_DAY + ClockTimeToSeconds(new_time));
+    } else {
+        memcpy(&self->current_time, new_time, sizeof(clock_time_t));
+    }
+    self->clock_ticks = 0; // El segundo ajustado comienza en este instante
+    if (self->source) {
+        self->sync_counter = self->source->GetTicks(); // Los ticks pendientes pertenecen a la hora anterior
     }
+    self->valid = true;
+    ClockWriteSource(self);
+    ClockUnlock(self);
     return true;
 }
 
-bool ClockGetTime(clock_t self, clock_time_t * result) {
-    memcpy(result, &self->current_time, 6);
-    return self->valid;
+void ClockNewTick(clock_t self) {
+    TRACE_EVENT(TRACE_CLOCK_TICK_BEGIN, 0);
+
+    // Corrección del oscilador: cada millón de ppm acumuladas se agrega o se descarta un tick
+    uint16_t step = 1;
+    self->trim_accumulator += self->rate_ppm;
+    if (self->trim_accumulator >= CLOCK_PPM) {
+        self->trim_accumulator -= CLOCK_PPM;
+        step = 2;
+    } else if (self->trim_accumulator <= -CLOCK_PPM) {
+        self->trim_accumulator += CLOCK_PPM;
+        step = 0;
+    }
+
+    self->clock_ticks += step;
+    while (self->clock_ticks >= self->ticks_per_second) {
+        self->clock_ticks -= self->ticks_per_second;
+        ClockIncrementSecond(self);
+    }
+    TRACE_EVENT(TRACE_CLOCK_TICK_END, 0);
 }
 
-bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
+void ClockAdvance(clock_t self, uint32_t ticks) {
+    TRACE_EVENT(TRACE_CLOCK_TICK_BEGIN, 0);
+
+    // Misma corrección que ClockNewTick, calculada de una vez para todos los ticks
+    int64_t accumulator = (int64_t)self->trim_accumulator + (int64_t)self->rate_ppm * ticks;
+    int64_t extra = accumulator / CLOCK_PPM;
+    self->trim_accumulator = (int32_t)(accumulator - extra * CLOCK_PPM);
+
+    uint64_t total = (uint64_t)((int64_t)self->clock_ticks + ticks + extra);
+    uint64_t seconds = total / self->ticks_per_second;
+    self->clock_ticks = (uint16_t)(total % self->ticks_per_second);
+
+    if (seconds) {
+        // La fecha avanza con una división, sin importar cuántos días o años se saltearon
+        seconds += ClockTimeToSeconds(&self->current_time);
+        self->days += (uint32_t)(seconds / SECONDS_PER_DAY);
+        ClockSecondsToTime((uint32_t)(seconds % SECONDS_PER_DAY), &self->current_time);
+    }
+    TRACE_EVENT(TRACE_CLOCK_TICK_END, 0);
+}
+
+uint32_t ClockSync(clock_t self, uint32_t counter) {
+    uint32_t elapsed = counter - self->sync_counter; // La resta sin signo tolera el desborde del contador
+
+    self->sync_counter = counter;
+    if (elapsed) {
+        ClockAdvance(self, elapsed);
+    }
+    return elapsed;
+}
+
+void ClockAttachSource(clock_t self, clock_source_t source) {
+    self->source = source;
+    if (source) {
+        self->sync_counter = source->GetTicks();
+        self->source_edge = self->sync_counter;
+        self->source_seconds = UINT32_MAX; // Fuerza a tomar los segundos del calendario en la primera lectura
+        self->source_align = false;
+        ClockRefresh(self);
+    }
+}
+
+uint32_t ClockRefresh(clock_t self) {
+    uint32_t elapsed;
+
+    if (!self->source) {
+        return 0;
+    }
+    // Quien lee la hora desde otra tarea nunca la ve con el acarreo a medio propagar
+    ClockLock(self);
+    elapsed = ClockReadSource(self);
+    ClockUnlock(self);
+    return elapsed;
+}
+
+bool ClockHasCalendar(clock_t self) {
+    return (self->source != NULL) && (self->source->ReadSeconds != NULL);
+}
+
+uint16_t ClockGetSubsecond(clock_t self) {
+    return self->clock_ticks;
+}
+
+uint64_t ClockGetUtcMillis(clock_t self) {
+    uint64_t ticks;
+    uint64_t seconds;
+
+    ClockLock(self);
+    ticks = self->clock_ticks;
+    if (self->source) {
+        ticks += self->source->GetTicks() - self->sync_counter;
+    }
+    seconds = ClockNowSeconds(self);
+    ClockUnlock(self);
+    return seconds * 1000 + ticks * 1000 / self->ticks_per_second;
+}
+
+bool ClockSetUtcMillis(clock_t self, uint64_t millis) {
+    uint64_t seconds = millis / 1000;
+    clock_date_t last = {.year = CLOCK_MAX_YEAR, .month = 12, .day = 31};
+
+    if (seconds >= (uint64_t)(ClockDateToDays(&last) + 1) * SECONDS_PER_DAY) {
+        return false;
+    }
+    ClockLock(self);
+    self->days = (uint32_t)(seconds / SECONDS_PER_DAY);
+    ClockSecondsToTime((uint32_t)(seconds % SECONDS_PER_DAY), &self->current_time);
+    self->clock_ticks = (uint16_t)((millis % 1000) * self->ticks_per_second / 1000);
     self->valid = true;
-    memcpy(&self->current_time, new_time, sizeof(clock_time_t));
-    if (ClockTimeIsValid(new_time)) {
-        self->valid = true;
+    self->zone_next = 0; // El instante puede haber retrocedido, se vuelve a calcular la diferencia con UTC
+    if (self->source) {
+        // Los ticks pendientes ya están incluidos en el instante ajustado
+        self->sync_counter = self->source->GetTicks();
+        ClockWriteSource(self);
+        self->source_edge = self->sync_counter - self->clock_ticks;
+        self->source_align = (self->source->WriteSeconds != NULL) && (self->clock_ticks != 0);
+    }
+    ClockUnlock(self);
+    return true;
+}
+
+bool ClockSetTrim(clock_t self, int32_t ppm) {
+    if ((ppm > CLOCK_TRIM_LIMIT_PPM) || (ppm < -CLOCK_TRIM_LIMIT_PPM)) {
+        return false;
+    }
+    self->trim_ppm = ppm;
+    ClockUpdateRate(self);
+    return true;
+}
+
+int32_t ClockGetTrim(clock_t self) {
+    return self->trim_ppm;
+}
+
+bool ClockSetSlew(clock_t self, int32_t ppm) {
+    if ((ppm > CLOCK_TRIM_LIMIT_PPM) || (ppm < -CLOCK_TRIM_LIMIT_PPM)) {
+        return false;
+    }
+    self->slew_ppm = ppm;
+    ClockUpdateRate(self);
+    return true;
+}
+
+int32_t ClockGetSlew(clock_t self) {
+    return self->slew_ppm;
+}
+
+bool ClockCalibrate(clock_t self, uint32_t measured_ticks, uint32_t reference_ticks) {
+    if (measured_ticks == 0) {
+        return false;
+    }
+
+    // ppm = (referencia - medido) / medido * 10^6, redondeado al entero más cercano
+    int64_t error = ((int64_t)reference_ticks - (int64_t)measured_ticks) * CLOCK_PPM;
+    int64_t half = (error < 0) ? -(int64_t)(measured_ticks / 2) : (int64_t)(measured_ticks / 2);
+    int64_t ppm = (error + half) / (int64_t)measured_ticks;
+
+    if ((ppm > CLOCK_TRIM_LIMIT_PPM) || (ppm < -CLOCK_TRIM_LIMIT_PPM)) {
+        return false;
+    }
+    return ClockSetTrim(self, (int32_t)ppm);
+}
+
+bool ClockIsLeapYear(uint16_t year) {
+    return ((year % 4) == 0) & (((year % 100) != 0) | ((year % 400) == 0));
+}
+
+uint8_t ClockDaysInMonth(uint16_t year, uint8_t month) {
+    // 31 días en los meses impares hasta julio y en los pares desde agosto, 28 o 29 en febrero
+    return (uint8_t)((month == 2) ? (28 + ClockIsLeapYear(year)) : (30 + ((month + (month >> 3)) & 1)));
+}
+
+bool ClockDateIsValid(const clock_date_t * date) {
+    return (date->year >= CLOCK_EPOCH_YEAR) && (date->year <= CLOCK_MAX_YEAR) && (date->month >= 1) &&
+           (date->month <= 12) && (date->day >= 1) && (date->day <= ClockDaysInMonth(date->year, date->month));
+}
+
+uint32_t ClockDateToDays(const clock_date_t * date) {
+    // Los años se cuentan desde marzo, así el 29 de febrero queda al final del año y no desplaza a los demás días
+    uint32_t year = date->year - (date->month <= 2);
+    uint32_t era = year / 400;
+    uint32_t year_of_era = year - era * 400;
+    uint32_t month_from_march = (date->month > 2) ? date->month - 3u : date->month + 9u;
+    uint32_t day_of_year = (153 * month_from_march + 2) / 5 + date->day - 1;
+    uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * DAYS_PER_ERA + day_of_era - DAYS_TO_EPOCH;
+}
+
+void ClockDaysToDate(uint32_t days, clock_date_t * date) {
+    uint32_t shifted = days + DAYS_TO_EPOCH;
+    uint32_t era = shifted / DAYS_PER_ERA;
+    uint32_t day_of_era = shifted - era * DAYS_PER_ERA;
+    uint32_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    uint32_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    uint32_t month_from_march = (5 * day_of_year + 2) / 153;
+
+    date->day = (uint8_t)(day_of_year - (153 * month_from_march + 2) / 5 + 1);
+    date->month = (uint8_t)((month_from_march < 10) ? month_from_march + 3 : month_from_march - 9);
+    date->year = (uint16_t)(year_of_era + era * 400 + (date->month <= 2));
+}
+
+uint8_t ClockDaysToWeekday(uint32_t days) {
+    return (uint8_t)((days + 4) % 7); // El 1970-01-01 fue jueves
+}
+
+bool ClockSetDate(clock_t self, const clock_date_t * date) {
+    if (!ClockDateIsValid(date)) {
+        return false;
+    }
+    ClockLock(self);
+    if (self->zone_active) {
+        uint32_t local = ClockToLocal(self, ClockNowSeconds(self));
+        ClockSetLocal(self, ClockDateToDays(date) * SECONDS_PER_DAY + local % SECONDS_PER_DAY);
     } else {
-        self->valid = false;
+        self->days = ClockDateToDays(date);
+    }
+    if (self->valid) {
+        ClockWriteSource(self);
     }
-    return self->valid;
+    ClockUnlock(self);
+    return true;
 }
 
-void ClockNewTick(clock_t self) {
-    self->clock_ticks++;
+bool ClockGetDate(clock_t self, clock_date_t * date) {
+    uint32_t days;
+    bool valid;
 
-    if (self->clock_ticks >= 1000) {
-        self->clock_ticks = 0;
+    ClockLock(self);
+    days = self->zone_active ? ClockToLocal(self, ClockNowSeconds(self)) / SECONDS_PER_DAY : self->days;
+    valid = self->valid;
+    ClockUnlock(self);
+    ClockDaysToDate(days, date);
+    return valid;
+}
 
-        // Incrementar segundos (unidades en [0])
-        self->current_time.time.seconds[0]++;
-        if (self->current_time.time.seconds[0] > 9) {
-            self->current_time.time.seconds[0] = 0;
-            // Incrementar segundos (decenas en [1])
-            self->current_time.time.seconds[1]++;
-            if (self->current_time.time.seconds[1] > 5) {
-                self->current_time.time.seconds[1] = 0;
-
-                // Incrementar minutos (unidades en [0])
-                self->current_time.time.minutes[0]++;
-                if (self->current_time.time.minutes[0] > 9) {
-                    self->current_time.time.minutes[0] = 0;
-                    // Incrementar minutos (decenas en [1])
-                    self->current_time.time.minutes[1]++;
-                    if (self->current_time.time.minutes[1] > 5) {
-                        self->current_time.time.minutes[1] = 0;
-
-                        // Incrementar horas (unidades en [0])
-                        self->current_time.time.hours[0]++;
-                        if (self->current_time.time.hours[0] > 9) {
-                            self->current_time.time.hours[0] = 0;
-                            // Incrementar horas (decenas en [1])
-                            self->current_time.time.hours[1]++;
-                        }
-
-                        // Verificar límite de 24 horas: 23 (decenas=2, unidades=3) -> 00
-                        if ((self->current_time.time.hours[1] == 2) && (self->current_time.time.hours[0] == 4)) {
-                            self->current_time.time.hours[0] = 0;
-                            self->current_time.time.hours[1] = 0;
-                        }
-                    }
-                }
-            }
-        }
+uint8_t ClockGetWeekday(clock_t self) {
+    uint32_t days;
+
+    ClockLock(self);
+    days = self->zone_active ? ClockToLocal(self, ClockNowSeconds(self)) / SECONDS_PER_DAY : self->days;
+    ClockUnlock(self);
+    return ClockDaysToWeekday(days);
+}
+
+bool ClockSetZone(clock_t self, const clock_zone_t * zone) {
+    static const clock_zone_t utc = {0};
+
+    if (!zone) {
+        zone = &utc;
     }
+    if ((zone->offset_minutes > CLOCK_ZONE_LIMIT_MINUTES) || (zone->offset_minutes < -CLOCK_ZONE_LIMIT_MINUTES) ||
+        (zone->dst_minutes > CLOCK_DST_LIMIT_MINUTES) ||
+        (zone->dst_minutes && (!ClockDstChangeIsValid(&zone->start) || !ClockDstChangeIsValid(&zone->end)))) {
+        return false;
+    }
+    self->zone = *zone;
+    self->zone_active = (zone->offset_minutes != 0) || (zone->dst_minutes != 0);
+    self->zone_offset = 0;
+    self->zone_next = 0;
+    return true;
+}
+
+int16_t ClockGetUtcOffset(clock_t self) {
+    uint32_t utc;
+    uint32_t local;
+
+    ClockLock(self);
+    utc = ClockNowSeconds(self);
+    local = ClockToLocal(self, utc);
+    ClockUnlock(self);
+    return (int16_t)((int32_t)(local - utc) / 60);
 }
 
 bool ClockEnableAlarm(clock_t self, bool enable) {
     self->alarm_enabled = enable;
     if(!enable) {
         self->alarm_ringing = false; // Si desactivamos la alarma, también deja de sonar
+        self->snoozed = false;
+        self->snooze_count = 0;
     }
     return self->alarm_enabled;
 }
@@ -173,61 +887,146 @@ bool ClockEnableAlarm(clock_t self, bool enable) {
 bool ClockSetAlarm(clock_t self, const clock_time_t * new_alarm_time) {
     // bool result = false;
     memcpy(&self->alarm_time, new_alarm_time, sizeof(clock_time_t));
+    self->alarm_last = ALARM_NEVER; // La alarma nueva puede sonar en el minuto actual
+    self->snoozed = false;
+    self->snooze_count = 0;
     return true;
 }
 
 bool ClockCheckAlarm(clock_t self) {
     if (self->alarm_enabled) {
+        ClockLock(self);
+        uint32_t now = ClockNowSeconds(self);
+        clock_time_t local_time = self->current_time;
+        uint32_t local = now;
+
+        if (self->zone_active) {
+            local = ClockToLocal(self, now);
+            ClockSecondsToTime(local % SECONDS_PER_DAY, &local_time);
+        }
+        ClockUnlock(self);
+
         if (self->alarm_ringing) {
+            if (self->ring_timeout && ((int32_t)(now - self->ring_deadline) >= 0)) {
+                // Nadie atendió la alarma: se aplaza, o se detiene si ya no quedan aplazamientos
+                if (!ClockSnoozeAlarm(self)) {
+                    ClockStopAlarm(self);
+                }
+                return false;
+            }
             return true; // Alarma ya está sonando
         }
-        else if ((self->current_time.time.hours[0] == self->alarm_time.time.hours[0]) &&
-            (self->current_time.time.hours[1] == self->alarm_time.time.hours[1]) &&
-            (self->current_time.time.minutes[0] == self->alarm_time.time.minutes[0]) &&
-            (self->current_time.time.minutes[1] == self->alarm_time.time.minutes[1])) {
-            self->alarm_ringing = true; // Alarma debe sonar
+        else if (self->snoozed && ((int32_t)(now - self->snooze_deadline) >= 0)) {
+            self->snoozed = false;
+            ClockStartRinging(self, now); // Venció el aplazamiento
+            return true;
+        }
+        else if ((local / 60 != self->alarm_last) &&
+            (local_time.time.hours[0] == self->alarm_time.time.hours[0]) &&
+            (local_time.time.hours[1] == self->alarm_time.time.hours[1]) &&
+            (local_time.time.minutes[0] == self->alarm_time.time.minutes[0]) &&
+            (local_time.time.minutes[1] == self->alarm_time.time.minutes[1]) &&
+            (self->alarm_weekdays & (1u << ClockDaysToWeekday(local / SECONDS_PER_DAY)))) {
+            // Cada minuto de alarma suena una sola vez, aunque se detenga o se aplace dentro del mismo minuto; se
+            // cuenta en hora local, así la hora que se repite al terminar el horario de verano no la hace sonar dos
+            // veces
+            self->alarm_last = local / 60;
+            self->snoozed = false;
+            self->snooze_count = 0;
+            ClockStartRinging(self, now); // Alarma debe sonar
             return true; // Alarma debe sonar
         }
     }
     return false;
 }
 
-bool ClockPostponeAlarm(clock_t self, uint16_t minutes_postpone) {
-    if (minutes_postpone == 0) {
-        return false;
+uint32_t ClockAlarmDelay(clock_t self) {
+    uint32_t now;
+    uint32_t local;
+    uint32_t change;
+    uint32_t seconds;
+    uint16_t ticks;
+
+    if (!self->alarm_enabled || (self->alarm_ringing && !self->ring_timeout)) {
+        return CLOCK_NO_DEADLINE;
     }
+    ClockLock(self);
+    now = ClockNowSeconds(self);
+    local = self->zone_active ? ClockToLocal(self, now) : now;
+    change = self->zone_active ? self->zone_next : UINT32_MAX;
+    ticks = self->clock_ticks;
+    ClockUnlock(self);
 
-    // Copiar la hora actual de la alarma
-    memcpy(&self->alarm_posponed, &self->alarm_time, sizeof(clock_time_t));
-    
-    uint8_t total_minutes = (self->alarm_posponed.time.minutes[1] * 10) + self->alarm_posponed.time.minutes[0] + minutes_postpone;
+    if (self->alarm_ringing || self->snoozed) {
+        int32_t remaining = (int32_t)((self->alarm_ringing ? self->ring_deadline : self->snooze_deadline) - now);
+        seconds = (remaining > 0) ? (uint32_t)remaining : 0;
+    } else {
+        // En el minuto de la alarma ClockCheckAlarm ya decidió, el próximo es el del día siguiente
+        uint32_t minute = ClockTimeToSeconds(&self->alarm_time) / 60 * 60;
+        seconds = (minute + SECONDS_PER_DAY - local % SECONDS_PER_DAY) % SECONDS_PER_DAY;
+        if (seconds == 0) {
+            seconds = SECONDS_PER_DAY;
+        }
+        if (change - now < seconds) {
+            seconds = change - now;
+        }
+    }
+    return (seconds == 0) ? 0 : seconds * self->ticks_per_second - ticks;
+}
 
-    uint8_t total_hours = (self->alarm_posponed.time.hours[1] * 10) + self->alarm_posponed.time.hours[0];
+void ClockSetAlarmWeekdays(clock_t self, uint8_t weekdays) {
+    self->alarm_weekdays = weekdays & CLOCK_ALARM_EVERY_DAY;
+}
 
-    // Manejar overflow de minutos
-    while (total_minutes >= 60) {
-        total_minutes -= 60;
-        total_hours++;
+uint8_t ClockGetAlarmWeekdays(clock_t self) {
+    return self->alarm_weekdays;
+}
+
+bool ClockPostponeAlarm(clock_t self, uint16_t minutes_postpone) {
+    if ((minutes_postpone == 0) || (self->snooze.limit && (self->snooze_count >= self->snooze.limit))) {
+        return false;
     }
+    // Un único vencimiento en segundos desde la época, la alarma ajustada no se modifica
+    ClockLock(self);
+    self->snooze_deadline = ClockNowSeconds(self) + (uint32_t)minutes_postpone * 60;
+    ClockUnlock(self);
+    self->snoozed = true;
+    self->snooze_count++;
+    self->alarm_ringing = false;
+    return true;
+}
 
-    // Manejar overflow de horas (formato 24h)
-    if (total_hours >= 24) {
-        total_hours = total_hours % 24;
+bool ClockSetSnooze(clock_t self, const clock_snooze_t * snooze) {
+    if (!snooze || !snooze->minutes || !snooze->min_minutes) {
+        return false;
     }
+    self->snooze = *snooze;
+    return true;
+}
 
-    self->alarm_posponed.time.minutes[0] = total_minutes % 10; // unidades
-    self->alarm_posponed.time.minutes[1] = total_minutes / 10; // decenas
-    self->alarm_posponed.time.hours[0] = total_hours % 10;     // unidades
-    self->alarm_posponed.time.hours[1] = total_hours / 10;     // decenas
+bool ClockSnoozeAlarm(clock_t self) {
+    uint32_t shorten = (uint32_t)self->snooze_count * self->snooze.step;
+    uint16_t minutes = self->snooze.min_minutes;
 
-    // Establecer la nueva alarma
-    ClockSetAlarm(self, &self->alarm_posponed);
-    return true;
+    if (self->snooze.minutes > shorten + self->snooze.min_minutes) {
+        minutes = (uint16_t)(self->snooze.minutes - shorten);
+    }
+    return ClockPostponeAlarm(self, minutes);
+}
+
+void ClockSetRingTimeout(clock_t self, uint16_t seconds) {
+    self->ring_timeout = seconds;
+}
+
+uint8_t ClockGetSnoozeCount(clock_t self) {
+    return self->snooze_count;
 }
 
 void ClockStopAlarm(clock_t self) {
     if (self){
         self->alarm_ringing = false; // Detener la alarma
+        self->snoozed = false;
+        self->snooze_count = 0;
     }
 }
 
@@ -252,20 +1051,24 @@ bool ClockAlarmIsEnabled(clock_t self) {
 }
 
 void ClockUpdateAlarmVisual(clock_t self, board_t board, bool alarm_ringing) {
+    const digital_output_t leds[] = {board->led_red, board->led_green, board->led_blue};
+
+    // Una sola escritura por puerto, y ninguna si los LEDs ya tienen el estado pedido
+    DigitalOutputGroupWrite(leds, 3, CLOCK_ALARM_LEDS, alarm_ringing ? CLOCK_ALARM_LED_RINGING : 0);
     if (alarm_ringing) {
 
         ScreenFlashDigits(board->screen, 0, 3, 0);
 
-        DigitalOutputActivate(board->buzzer);
-        DigitalOutputActivate(board->led_red);
+        if (!BuzzerIsPlaying(board->buzzer)) {
+            // Después de un aplazamiento suena directamente con el volumen máximo
+            BuzzerPlay(board->buzzer, self->snooze_count ? &BUZZER_MELODY_BEEPS : &BUZZER_MELODY_ESCALATING);
+        }
         ScreenSetDots(board->screen, 3, 3);
     } else if (self->alarm_enabled) {
-        DigitalOutputDeactivate(board->buzzer);
-        DigitalOutputDeactivate(board->led_red);
+        BuzzerStop(board->buzzer);
         ScreenSetDots(board->screen, 3, 3);
     } else {
-        DigitalOutputDeactivate(board->buzzer);
-        DigitalOutputDeactivate(board->led_red);
+        BuzzerStop(board->buzzer);
         ScreenClearDots(board->screen);
     }
 }
@@ -0,0 +1,367 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file command.c
+ ** @brief Código fuente de los comandos del reloj por el enlace serie
+ **
+ ** Igual que la aplicación, los comandos se describen en una tabla constante con la longitud de los datos de cada
+ ** pedido y la función que lo ejecuta; el intérprete sólo verifica la longitud e indexa la tabla.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "command.h"
+#include "trace.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Función que ejecuta un pedido y arma los datos de la respuesta, devuelve false si algún valor está fuera de rango
+typedef bool (*command_handler_t)(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+//! Descripción de un comando
+typedef struct command_entry_s {
+    uint8_t length;            //!< Longitud de los datos del pedido
+    command_handler_t handler; //!< Función que ejecuta el pedido, NULL si el comando no existe
+    bool deferred;             //!< El pedido ajusta la aplicación, se ejecuta en la tarea que la atiende
+} const * command_entry_t;
+
+//! Estructura interna del intérprete de comandos
+struct command_s {
+    serial_t serial;                //!< Enlace serie de los pedidos y las respuestas
+    app_t app;                      //!< Aplicación que se ajusta
+    clock_t clock;                  //!< Reloj de la aplicación
+    timesync_t sync;                //!< Cliente de sincronización, NULL si no hay
+    idle_t idle;                    //!< Tarea inactiva, NULL si no se mide
+    command_defer_t defer;          //!< Traslada los ajustes a la tarea de la aplicación, NULL si no se trasladan
+    const serial_frame_t * pending; //!< Ajuste que espera a CommandApply, NULL si no hay
+    serial_frame_t * pending_reply; //!< Respuesta del ajuste que espera
+    bool pending_result;            //!< Resultado del último ajuste ejecutado por CommandApply
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Agrega un número de 32 bits a los datos de una trama, con el byte bajo primero.
+ *
+ * @param frame     La trama.
+ * @param value     El número.
+ */
+static void CommandPutWord(serial_frame_t * frame, uint32_t value);
+
+/**
+ * @brief           Convierte un valor binario de 0 a 99 a dos dígitos BCD.
+ *
+ * @param value     El valor.
+ * @param digits    Dígitos de unidades y decenas, en el orden de clock_time_t.
+ */
+static void CommandToDigits(uint8_t value, uint8_t digits[2]);
+
+/**
+ * @brief           Convierte dos dígitos BCD a un valor binario.
+ *
+ * @param digits    Dígitos de unidades y decenas, en el orden de clock_time_t.
+ * @return          El valor.
+ */
+static uint8_t CommandFromDigits(const uint8_t digits[2]);
+
+/**
+ * @brief           Responde la versión del protocolo.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandPing(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Responde la fecha y la hora locales.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandGetTime(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Ajusta la fecha y la hora locales.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandSetTime(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Responde la alarma.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandGetAlarm(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Ajusta la alarma.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandSetAlarm(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Responde los contadores del enlace y de las trazas y la corrección del oscilador.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandGetStats(command_t self, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Ejecuta un pedido en la tarea que corresponde y arma los datos de la respuesta.
+ *
+ * @param self      El intérprete.
+ * @param entry     Descripción del comando pedido.
+ * @param request   Pedido recibido.
+ * @param reply     Respuesta, con los datos vacíos.
+ * @return          true si se ejecutó el pedido, false si algún valor está fuera de rango.
+ */
+static bool CommandRun(command_t self, command_entry_t entry, const serial_frame_t * request, serial_frame_t * reply);
+
+/**
+ * @brief           Ejecuta un pedido y envía la respuesta o el motivo por el que no se pudo ejecutar.
+ *
+ * @param self      El intérprete.
+ * @param request   Pedido recibido.
+ */
+static void CommandExecute(command_t self, const serial_frame_t * request);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Tabla de comandos, los que no aparecen no existen
+static const struct command_entry_s COMMANDS[COMMAND_COUNT] = {
+    [COMMAND_PING] = {0, CommandPing},
+    [COMMAND_GET_TIME] = {0, CommandGetTime},
+    [COMMAND_SET_TIME] = {7, CommandSetTime, true},
+    [COMMAND_GET_ALARM] = {0, CommandGetAlarm},
+    [COMMAND_SET_ALARM] = {4, CommandSetAlarm, true},
+    [COMMAND_GET_STATS] = {0, CommandGetStats},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void CommandPutWord(serial_frame_t * frame, uint32_t value) {
+    for (uint8_t index = 0; index < 4; index++) {
+        frame->payload[frame->length++] = (uint8_t)(value >> (8 * index));
+    }
+}
+
+static void CommandToDigits(uint8_t value, uint8_t digits[2]) {
+    digits[0] = value % 10;
+    digits[1] = value / 10;
+}
+
+static uint8_t CommandFromDigits(const uint8_t digits[2]) {
+    return (uint8_t)(digits[1] * 10 + digits[0]);
+}
+
+static bool CommandPing(command_t self, const serial_frame_t * request, serial_frame_t * reply) {
+    (void)self;
+    (void)request;
+    reply->payload[reply->length++] = COMMAND_VERSION;
+    return true;
+}
+
+static bool CommandGetTime(command_t self, const serial_frame_t * request, serial_frame_t * reply) {
+    clock_date_t date;
+    clock_time_t time;
+
+    (void)request;
+    bool valid = ClockGetTime(self->clock, &time);
+    ClockGetDate(self->clock, &date);
+    reply->payload[0] = (uint8_t)date.year;
+    reply->payload[1] = (uint8_t)(date.year >> 8);
+    reply->payload[2] = date.month;
+    reply->payload[3] = date.day;
+    reply->payload[4] = CommandFromDigits(time.time.hours);
+    reply->payload[5] = CommandFromDigits(time.time.minutes);
+    reply->payload[6] = CommandFromDigits(time.time.seconds);
+    reply->payload[7] = ClockGetWeekday(self->clock);
+    reply->payload[8] = valid;
+    reply->length = 9;
+    return true;
+}
+
+static bool CommandSetTime(command_t self, const serial_frame_t * request, serial_frame_t * reply) {
+    const uint8_t * data = request->payload;
+    clock_date_t date = {.year = (uint16_t)(data[0] | (data[1] << 8)), .month = data[2], .day = data[3]};
+    clock_time_t time;
+
+    (void)reply;
+    if ((data[4] > 99) || (data[5] > 99) || (data[6] > 99)) {
+        return false; // No entran en dos dígitos, ClockTimeIsValid no los vería
+    }
+    CommandToDigits(data[4], time.time.hours);
+    CommandToDigits(data[5], time.time.minutes);
+    CommandToDigits(data[6], time.time.seconds);
+    return AppSetTime(self->app, &date, &time);
+}
+
+static bool CommandGetAlarm(command_t self, const serial_frame_t * request, serial_frame_t * reply) {
+    clock_time_t alarm;
+
+    (void)request;
+    ClockGetAlarm(self->clock, &alarm);
+    reply->payload[0] = CommandFromDigits(alarm.time.hours);
+    reply->payload[1] = CommandFromDigits(alarm.time.minutes);
+    reply->payload[2] = ClockGetAlarmWeekdays(self->clock);
+    reply->payload[3] = ClockAlarmIsEnabled(self->clock);
+    reply->length = 4;
+    return true;
+}
+
+static bool CommandSetAlarm(command_t self, const serial_frame_t * request, serial_frame_t * reply) {
+    const uint8_t * data = request->payload;
+    clock_time_t alarm = {0};
+
+    (void)reply;
+    if ((data[0] > 99) || (data[1] > 99) || (data[2] & ~CLOCK_ALARM_EVERY_DAY) || (data[3] > 1)) {
+        return false;
+    }
+    CommandToDigits(data[0], alarm.time.hours);
+    CommandToDigits(data[1], alarm.time.minutes);
+    return AppSetAlarm(self->app, &alarm, data[2], data[3]);
+}
+
+static bool CommandGetStats(command_t self, const serial_frame_t * request, serial_frame_t * reply) {
+    serial_stats_t stats;
+    idle_stats_t idle;
+
+    (void)request;
+    SerialGetStats(self->serial, &stats);
+    IdleGetStats(self->idle, &idle);
+    CommandPutWord(reply, stats.received);
+    CommandPutWord(reply, stats.overruns);
+    CommandPutWord(reply, stats.frames);
+    CommandPutWord(reply, stats.errors);
+    CommandPutWord(reply, TraceDropped());
+    CommandPutWord(reply, (uint32_t)ClockGetTrim(self->clock));
+    CommandPutWord(reply, idle.idle_permille);
+    CommandPutWord(reply, idle.min_idle_permille);
+    return true;
+}
+
+static bool CommandRun(command_t self, command_entry_t entry, const serial_frame_t * request, serial_frame_t * reply) {
+    if (!entry->deferred || !self->defer) {
+        return entry->handler(self, request, reply);
+    }
+    // La tarea de la aplicación ejecuta el ajuste entre dos eventos, mientras esta tarea espera el resultado
+    self->pending = request;
+    self->pending_reply = reply;
+    self->defer();
+    self->pending = NULL;
+    return self->pending_result;
+}
+
+static void CommandExecute(command_t self, const serial_frame_t * request) {
+    command_entry_t entry = (request->command < COMMAND_COUNT) ? &COMMANDS[request->command] : NULL;
+    serial_frame_t reply = {.length = 0};
+    uint8_t error = 0;
+
+    if (!entry || !entry->handler) {
+        error = COMMAND_ERROR_UNKNOWN;
+    } else if (request->length != entry->length) {
+        error = COMMAND_ERROR_LENGTH;
+    } else if (!CommandRun(self, entry, request, &reply)) {
+        error = COMMAND_ERROR_VALUE;
+    }
+
+    if (error) {
+        uint8_t payload[2] = {request->command, error};
+        SerialSendFrame(self->serial, COMMAND_ERROR, payload, sizeof(payload));
+    } else {
+        SerialSendFrame(self->serial, request->command | COMMAND_REPLY, reply.payload, reply.length);
+    }
+}
+
+/* === Public function definitions ============================================================================== */
+
+command_t CommandCreate(serial_t serial, app_t app, clock_t clock) {
+    static struct command_s self[1];
+
+    self->serial = serial;
+    self->app = app;
+    self->clock = clock;
+    self->sync = NULL;
+    self->idle = NULL;
+    self->defer = NULL;
+    self->pending = NULL;
+    return self;
+}
+
+void CommandAttachSync(command_t self, timesync_t sync) {
+    self->sync = sync;
+}
+
+void CommandAttachIdle(command_t self, idle_t idle) {
+    self->idle = idle;
+}
+
+void CommandAttachDefer(command_t self, command_defer_t defer) {
+    self->defer = defer;
+}
+
+void CommandApply(command_t self) {
+    if (self->pending) {
+        self->pending_result = COMMANDS[self->pending->command].handler(self, self->pending, self->pending_reply);
+    }
+}
+
+uint16_t CommandProcess(command_t self) {
+    serial_frame_t request;
+    uint16_t count = 0;
+
+    while (SerialReadFrame(self->serial, &request)) {
+        if (request.command == (COMMAND_SYNC | COMMAND_REPLY)) {
+            // Respuesta de la PC a un pedido del reloj, no se contesta
+            if (self->sync) {
+                TimeSyncReceive(self->sync, &request);
+            }
+        } else {
+            CommandExecute(self, &request);
+        }
+        count++;
+    }
+    return count;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -27,19 +27,28 @@ SPDX-License-Identifier: MIT
 #include "digital.h"
 #include "chip.h"
 #include "ciaa.h"
-#include <stdio.h>
 #include <stdbool.h>
-#include <stdlib.h>
+#include <stddef.h>
 
 /* === Macros definitions ========================================================================================== */
 
+//! Cantidad de puertos GPIO del microcontrolador
+#define DIGITAL_GPIO_PORTS 8
+
+//! Suma uno a un contador de escrituras, sólo si están habilitados
+#if DIGITAL_OUTPUT_STATS
+#define DIGITAL_COUNT(counter) (stats.counter++)
+#else
+#define DIGITAL_COUNT(counter) ((void)0)
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
 /*! Estructura que representa una salida digital */
 struct digital_output_s {
     uint8_t port;     /*!< Puerto al que pertenece la salida */
     uint8_t pin;      /*!< Pin al que pertenece la salida */
-    bool estado;      /*!< Estado de la salida */
+    bool estado;      /*!< Estado lógico de la salida, evita escribir el registro si no cambia */
     bool active_high; /*!< Indica si la salida es activa en bajo (false) o alto (true)*/
 };
 
@@ -53,60 +62,141 @@ struct digital_input_s {
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief   Cambia el estado lógico de una salida, escribiendo el pin sólo si el estado es distinto del actual
+ *
+ * @param self  Estructura que representa la salida digital
+ * @param state Nuevo estado lógico, true para activar
+ */
+static void DigitalOutputWrite(digital_output_t self, bool state);
+
 /* === Private variable definitions ================================================================================ */
 
+//! Salidas digitales, se reservan en orden de creación y no se liberan
+static struct digital_output_s outputs[DIGITAL_OUTPUTS_MAX];
+
+//! Cantidad de salidas digitales creadas
+static uint8_t outputs_count;
+
+//! Entradas digitales, contiguas para recorrerlas juntas al leer las teclas
+static struct digital_input_s inputs[DIGITAL_INPUTS_MAX];
+
+//! Cantidad de entradas digitales creadas
+static uint8_t inputs_count;
+
+#if DIGITAL_OUTPUT_STATS
+//! Contadores de escrituras de las salidas
+static digital_output_stats_t stats;
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void DigitalOutputWrite(digital_output_t self, bool state) {
+    DIGITAL_COUNT(requested);
+    if (self->estado != state) {
+        self->estado = state;
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, state == self->active_high);
+        DIGITAL_COUNT(written);
+    }
+}
+
 /* === Public function definitions ============================================================================== */
 
 digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin, bool active_high) {
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
-    if (self != NULL) {
-        self->port = port;
-        self->pin = pin;
-        self->active_high = active_high;
+    if (outputs_count >= DIGITAL_OUTPUTS_MAX) {
+        return NULL;
     }
+    digital_output_t self = &outputs[outputs_count++];
+    self->port = port;
+    self->pin = pin;
+    self->estado = false;
+    self->active_high = active_high;
 
-    if (active_high == 0) {
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, true);
-    } else {
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
-    }
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, !active_high);
     Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, true);
     return self;
 }
 
 void DigitalOutputActivate(digital_output_t self) {
-    if (self->active_high == 0) {
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
-    } else {
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, true);
-    }
+    DigitalOutputWrite(self, true);
 }
 
 void DigitalOutputDeactivate(digital_output_t self) {
-    if (self->active_high == 0) {
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, true);
-    } else {
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
-    }
+    DigitalOutputWrite(self, false);
 }
 
 void DigitalOutputToggle(digital_output_t self) {
+    self->estado = !self->estado;
     Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->port, self->pin);
+    DIGITAL_COUNT(requested);
+    DIGITAL_COUNT(written);
+}
+
+bool DigitalOutputGetState(digital_output_t self) {
+    return self->estado;
+}
+
+void DigitalOutputGroupWrite(const digital_output_t * group, uint8_t count, uint32_t mask, uint32_t states) {
+    uint32_t high[DIGITAL_GPIO_PORTS] = {0};
+    uint32_t low[DIGITAL_GPIO_PORTS] = {0};
+    uint8_t ports = 0;
+
+    for (uint8_t index = 0; index < count; index++) {
+        digital_output_t output = group[index];
+        bool state = (states >> index) & 1;
+
+        if (!((mask >> index) & 1) || !output) {
+            continue;
+        }
+        DIGITAL_COUNT(requested);
+        if (output->estado == state) {
+            continue;
+        }
+        output->estado = state;
+        if (state == output->active_high) {
+            high[output->port] |= 1UL << output->pin;
+        } else {
+            low[output->port] |= 1UL << output->pin;
+        }
+        ports |= 1 << output->port;
+    }
+
+    // Una escritura por puerto y nivel, sólo en los puertos con alguna salida que cambió
+    for (uint8_t port = 0; ports; port++, ports >>= 1) {
+        if (high[port]) {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, port, high[port]);
+            DIGITAL_COUNT(written);
+        }
+        if (low[port]) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, port, low[port]);
+            DIGITAL_COUNT(written);
+        }
+    }
+}
+
+void DigitalOutputGetStats(digital_output_stats_t * result) {
+#if DIGITAL_OUTPUT_STATS
+    *result = stats;
+#else
+    result->requested = 0;
+    result->written = 0;
+#endif
 }
 
 digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted) {
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
-    if (self != NULL) {
-        self->port = port;
-        self->pin = pin;
-        self->inverted = inverted;
-        self->last_state = DigitalInputGetState(self);
+    if (inputs_count >= DIGITAL_INPUTS_MAX) {
+        return NULL;
     }
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, self->inverted);
+    digital_input_t self = &inputs[inputs_count++];
+    self->port = port;
+    self->pin = pin;
+    self->inverted = inverted;
+
+    // La dirección se configura antes de tomar el estado inicial, que de otro modo se leería de un pin sin configurar
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, false);
+    self->last_state = DigitalInputGetState(self);
     return self;
 }
 
@@ -0,0 +1,135 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file idle.c
+ ** @brief Código fuente de las tareas de mantenimiento y del ahorro de energía de la tarea inactiva
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "idle.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Milésimas de un segundo
+#define IDLE_PERMILLE 1000
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura interna de la tarea inactiva
+struct idle_s {
+    idle_driver_t driver;           //!< Controlador del procesador
+    idle_job_t jobs[IDLE_JOBS_MAX]; //!< Trabajos diferidos registrados
+    uint8_t count;                  //!< Cantidad de trabajos registrados
+    uint8_t next;                   //!< Próximo trabajo a ejecutar
+    uint32_t window_start;          //!< Valor del contador al comenzar el segundo de medición en curso
+    uint32_t window_idle;           //!< Ciclos dormidos en el segundo de medición en curso
+    idle_stats_t stats;             //!< Estadísticas
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Suma el tiempo dormido y, si se completó un segundo, calcula su fracción de tiempo inactivo.
+ *
+ * @param self      La tarea inactiva.
+ * @param slept     Ciclos que durmió el procesador.
+ */
+static void IdleAccount(idle_t self, uint32_t slept);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void IdleAccount(idle_t self, uint32_t slept) {
+    uint32_t elapsed;
+    uint32_t permille;
+
+    self->window_idle += slept;
+    elapsed = self->driver->Now() - self->window_start; // La resta sin signo tolera el desborde del contador
+    if (elapsed < self->driver->cycles_per_second) {
+        return;
+    }
+
+    // Si no se pudo dormir durante más de un segundo la ventana es más larga, el promedio sigue siendo válido
+    permille = (uint32_t)((uint64_t)self->window_idle * IDLE_PERMILLE / elapsed);
+    if (permille > IDLE_PERMILLE) {
+        permille = IDLE_PERMILLE;
+    }
+    self->stats.idle_permille = (uint16_t)permille;
+    if ((self->stats.min_idle_permille == IDLE_UNKNOWN) || (permille < self->stats.min_idle_permille)) {
+        self->stats.min_idle_permille = (uint16_t)permille;
+    }
+    self->stats.seconds++;
+    self->window_start += elapsed;
+    self->window_idle = 0;
+}
+
+/* === Public function definitions ============================================================================== */
+
+idle_t IdleCreate(idle_driver_t driver) {
+    static struct idle_s self[1];
+
+    if (!driver || !driver->Now || !driver->Sleep || !driver->cycles_per_second) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct idle_s));
+    self->driver = driver;
+    self->window_start = driver->Now();
+    self->stats.idle_permille = IDLE_UNKNOWN;
+    self->stats.min_idle_permille = IDLE_UNKNOWN;
+    return self;
+}
+
+bool IdleAttachJob(idle_t self, idle_job_t job) {
+    if (!self || !job || (self->count >= IDLE_JOBS_MAX)) {
+        return false;
+    }
+    self->jobs[self->count] = job;
+    self->count++;
+    return true;
+}
+
+void IdleHook(idle_t self) {
+    if (!self) {
+        return;
+    }
+    if (self->count) {
+        self->jobs[self->next]();
+        self->next = (uint8_t)((self->next + 1) % self->count);
+    }
+    IdleAccount(self, self->driver->Sleep());
+    self->stats.sleeps++;
+}
+
+void IdleGetStats(idle_t self, idle_stats_t * stats) {
+    if (!self) {
+        memset(stats, 0, sizeof(idle_stats_t));
+        stats->idle_permille = IDLE_UNKNOWN;
+        stats->min_idle_permille = IDLE_UNKNOWN;
+        return;
+    }
+    *stats = self->stats;
+}
+
+/* === End of documentation ======================================================================================== */
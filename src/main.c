@@ -30,6 +30,15 @@ SPDX-License-Identifier: MIT
 #include "bsp.h"
 #include "clock.h"
 #include "screen.h"
+#include "app.h"
+#include "chrono.h"
+#include "repeat.h"
+#include "persist.h"
+#include "serial.h"
+#include "command.h"
+#include "timesync.h"
+#include "idle.h"
+#include "trace.h"
 
 #include "FreeRTOS.h"
 #include "task.h"
@@ -37,32 +46,15 @@ SPDX-License-Identifier: MIT
 
 /* === Macros definitions ====================================================================== */
 
-/* === Private data type declarations ========================================================== */
+//! Mensaje de MainTask que no es un evento de la aplicación: ejecutar el ajuste que pidió el enlace serie
+#define MSG_SERIAL_COMMAND ((message_type_t)MSG_COUNT)
 
-typedef enum {
-    CLOCK_MODE_UNSET_TIME,        // Modo para establecer la hora inicial
-    CLOCK_MODE_DISPLAY,           // Modo de visualización normal
-    CLOCK_MODE_SET_HOURS,         // Modo para establecer horas
-    CLOCK_MODE_SET_MINUTES,       // Modo para establecer minutos
-    CLOCK_MODE_SET_ALARM_HOURS,   // Modo para establecer horas de la alarma
-    CLOCK_MODE_SET_ALARM_MINUTES, // Modo para establecer minutos de la alarma
-} clock_mode_t;
-
-typedef enum {
-    MSG_BUTTON_SET_TIME_LONG,
-    MSG_BUTTON_SET_ALARM_LONG,
-    MSG_BUTTON_ACCEPT,
-    MSG_BUTTON_CANCEL,
-    MSG_BUTTON_INCREASE,
-    MSG_BUTTON_DECREASE,
-    MSG_CLOCK_TICK,
-    MSG_CONFIG_TIMEOUT,
-    MSG_UPDATE_DISPLAY
-} message_type_t;
+/* === Private data type declarations ========================================================== */
 
 typedef struct {
     message_type_t type;
     uint32_t data; // Datos adicionales si son necesarios
+    uint16_t steps; // Pasos acumulados de las repeticiones de una tecla, 0 en los demás mensajes
 } task_message_t;
 
 /* === Private variable declarations =========================================================== */
@@ -71,15 +63,9 @@ static board_t board;
 
 static clock_t clock;
 
-// static clock_time_t time;
-
-static clock_time_t time_to_display;
-
-static clock_mode_t clock_mode;
+static app_t app;
 
-static const uint8_t MINUTES_LIMIT[] = {5, 9};
-
-static const uint8_t HOURS_LIMIT[] = {2, 3};
+static recorder_t recorder; // Registro de eventos para reproducir en el host
 
 static uint32_t set_time_press_duration = 0;
 
@@ -89,81 +75,110 @@ static uint32_t set_alarm_press_duration = 0;
 
 static bool set_alarm_long_pressed = false;
 
-// static bool set_time_long_press_detected = false;
+//! Repetición acelerada de las teclas de incremento y decremento mantenidas
+static repeat_t increase_repeat;
 
-// static bool set_alarm_long_press_detected = false;
+static repeat_t decrease_repeat;
 
-static bool alarm_ringing = false;
+//! Ciclos del contador de ciclos por microsegundo
+static uint16_t cycles_per_us;
 
-static uint32_t timeout_count = 0;
+//! Microsegundos desde el comienzo de main hasta el primer refresco de la pantalla, 0 mientras no se midió
+static volatile uint32_t boot_time_us;
 
 static QueueHandle_t main_queue; // Cola para MainTask
 
-static QueueHandle_t display_queue; // Cola para DisplayTask
+static QueueHandle_t command_done; // Aviso de MainTask a SerialTask de que terminó el ajuste pedido
+
+//! Enlace serie de comandos y su intérprete, se crean en la inicialización diferida
+static serial_t serial;
+
+static command_t command;
+
+static timesync_t timesync;
 
-static QueueHandle_t clock_queue; // Cola para ClockTask
+//! Tarea que ejecuta los comandos, la interrupción de la UART le avisa cuando llegan bytes
+static TaskHandle_t serial_task;
+
+//! Trabajos diferidos y medición del tiempo inactivo en el gancho de la tarea inactiva
+static idle_t idle;
+
+//! Procesador para la tarea inactiva, los ciclos por segundo se completan al medir el reloj del núcleo
+static struct idle_driver_s idle_driver = {
+    .Now = CycleCounterRead,
+    .Sleep = CpuSleep,
+};
+
+//! Memoria del log de estado persistente: la EEPROM del microcontrolador
+static const struct persist_storage_s persist_storage = {
+    .Read = EepromRead,
+    .Write = EepromWrite,
+    .Erase = EepromErase,
+    .sector_size = PERSIST_SECTOR_SIZE,
+    .sectors = PERSIST_SECTORS,
+};
 
 /* === Private function declarations =========================================================== */
 
 /**
- * @brief Función para incrementar un número BCD (Binary-Coded Decimal) con límite.
+ * @brief Verifica si una entrada digital ha sido presionada durante un tiempo largo.
  *
- * @param numero Puntero al número BCD a incrementar.
- * @param limite Valor límite para el número BCD, representado como un arreglo de dos elementos:
- *              - limite[0]: decena (0-2 para horas, 0-5 para minutos/segundos)
- *              - limite[1]: unidad (0-3 para horas, 0-9 para minutos/segundos)
+ * @param input Entrada digital a verificar.
+ * @param press_duration Puntero al contador de duración de la presión.
+ * @param flag Puntero a un flag que indica si se ha detectado una presión larga.
+ * @return true Si se detectó una presión larga.
+ * @return false Si no se detectó una presión larga.
  */
-void IncreaseBCD(uint8_t * numero, const uint8_t limite[2]);
+bool IsLongPress(digital_input_t input, uint32_t * press_duration, bool * flag);
 
 /**
- * @brief Función para decrementar un número BCD (Binary-Coded Decimal) con límite.
+ * @brief Devuelve el instante actual para marcar los eventos registrados.
  *
- * @param numero Puntero al número BCD a decrementar.
- * @param limite Valor límite para el número BCD, representado como un arreglo de dos elementos:
- *              - limite[0]: decena (0-2 para horas, 0-5 para minutos/segundos)
- *              - limite[1]: unidad (0-3 para horas, 0-9 para minutos/segundos)
+ * @return Cantidad de ticks desde el arranque del scheduler.
  */
-void DecreaseBCD(uint8_t * numero, const uint8_t limite[2]);
+static uint32_t RecorderNow(void);
 
 /**
- * @brief Cambia el modo del reloj y actualiza la pantalla según el nuevo modo.
+ * @brief Envía a MainTask en un solo mensaje los pasos vencidos de la repetición de una tecla mantenida.
+ *
+ * Si la cola está llena los pasos se conservan y se suman a los del próximo envío, así no se pierden.
  *
- * @param mode Nuevo modo del reloj.
+ * @param repeat Repetición de la tecla.
+ * @param key Tecla a consultar.
+ * @param type Mensaje de repetición de la tecla.
+ * @param pending Pasos vencidos que todavía no se enviaron.
  */
-void ModeChange(clock_mode_t mode);
+static void SendRepeat(repeat_t repeat, digital_input_t key, message_type_t type, uint16_t * pending);
 
 /**
- * @brief Actualiza el contenido de la pantalla según el modo actual del reloj.
- *
- * Esta función escribe los valores BCD correspondientes en la pantalla según el modo actual.
+ * @brief Traslada a MainTask el ajuste de la aplicación pedido por el enlace serie y espera a que lo ejecute.
  */
-void UpdateDisplayContent(void);
+static void SerialDefer(void);
 
 /**
- * @brief Verifica si una entrada digital ha sido presionada durante un tiempo largo.
- *
- * @param input Entrada digital a verificar.
- * @param press_duration Puntero al contador de duración de la presión.
- * @param flag Puntero a un flag que indica si se ha detectado una presión larga.
- * @return true Si se detectó una presión larga.
- * @return false Si no se detectó una presión larga.
+ * @brief Impide que otra tarea interrumpa el ajuste o la lectura de la hora, ClockTask la actualiza con más prioridad.
  */
-bool IsLongPress(digital_input_t input, uint32_t * press_duration, bool * flag);
+static void ClockEnterCritical(void);
 
 /**
- * @brief Reinicia el contador de tiempo de configuración.
- *
- * Esta función se utiliza para reiniciar el contador que controla el tiempo de configuración del reloj.
+ * @brief Permite otra vez el cambio de tarea al terminar el ajuste o la lectura de la hora.
  */
-void ResetConfigTimeout(void);
+static void ClockExitCritical(void);
 
 /**
- * @brief Verifica si el reloj está en modo de configuración.
- *
- * @return true Si el reloj está en modo de configuración.
- * @return false Si el reloj no está en modo de configuración.
+ * @brief Registra el tiempo de arranque al mostrar el primer cuadro de la pantalla.
  */
-bool IsInConfigMode(void);
+static void BootFirstFrame(void);
+
+/**
+ * @brief Trabajo diferido de la tarea inactiva: guarda el estado pendiente de la aplicación.
+ */
+static void IdleFlushState(void);
+
+/**
+ * @brief Inicialización no crítica, se ejecuta en MainTask cuando la pantalla ya muestra la hora.
+ */
+static void BootDeferredInit(void);
 
 /**
  * @brief Tarea principal que maneja la lógica del reloj
@@ -189,152 +204,116 @@ static void ClockTask(void * pvParameters);
  */
 static void ButtonTask(void * pvParameters);
 
+/**
+ * @brief Recibe los bytes de la UART desde su interrupción y despierta a la tarea de comandos.
+ * @param data Bytes recibidos.
+ * @param size Cantidad de bytes.
+ */
+static void SerialUartReceive(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief Tarea que separa las tramas recibidas, ejecuta los comandos del enlace serie y sincroniza la hora
+ * @param pvParameters Parámetros de la tarea (no utilizados)
+ */
+static void SerialTask(void * pvParameters);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+//! Fuente de tiempo del reloj: contador de ticks de FreeRTOS, con el calendario del RTC si está habilitado
+static const struct clock_source_s clock_source = {
+    .GetTicks = xTaskGetTickCount,
+#if CLOCK_USE_RTC
+    .ReadSeconds = RtcReadSeconds,
+    .WriteSeconds = RtcWriteSeconds,
+#endif
+    .EnterCritical = ClockEnterCritical,
+    .ExitCritical = ClockExitCritical,
+};
+
 /* === Private function implementation ========================================================= */
 
-void IncreaseBCD(uint8_t * numero, const uint8_t limite[2]) {
-    bool is_hours = (limite[0] == 2 && limite[1] == 3);
+static uint32_t RecorderNow(void) {
+    return xTaskGetTickCount();
+}
 
-    numero[0]++; // Incrementar unidades
-    if (numero[0] > 9) {
-        numero[0] = 0;
-        numero[1]++; // Incrementar decenas
-    }
+static void SendRepeat(repeat_t repeat, digital_input_t key, message_type_t type, uint16_t * pending) {
+    uint32_t now = xTaskGetTickCount();
+    uint32_t steps = *pending + RepeatUpdate(repeat, DigitalInputGetState(key), now);
 
-    if (is_hours) {
-        // Para horas: 23 -> 00 (pero 24 nunca debe aparecer)
-        if ((numero[1] == 2) && (numero[0] == 4)) {
-            numero[0] = 0;
-            numero[1] = 0;
-        }
-    } else {
-        // Para minutos/segundos: cuando llega a 60 -> 00
-        if ((numero[1] == 6) && (numero[0] == 0)) {
-            numero[0] = 0;
-            numero[1] = 0;
-        }
+    *pending = (steps > UINT16_MAX) ? UINT16_MAX : (uint16_t)steps;
+    if (*pending == 0) {
+        return;
+    }
+    task_message_t message = {.type = type, .data = now, .steps = *pending};
+    if (xQueueSend(main_queue, &message, 0) == pdTRUE) {
+        *pending = 0;
     }
 }
 
-void DecreaseBCD(uint8_t * numero, const uint8_t limite[2]) {
-    // Detectar si son horas por el límite
-    bool is_hours = (limite[0] == 2 && limite[1] == 3);
+static void SerialDefer(void) {
+    task_message_t message = {.type = MSG_SERIAL_COMMAND};
+    uint8_t done;
 
-    if (numero[0] == 0) {     // Si unidades es 0 (ahora en posición [0])
-        if (numero[1] == 0) { // Si decenas es 0 (ahora en posición [1])
-            if (is_hours) {
-                // CASO ESPECIAL: 00:xx -> 23:xx
-                numero[1] = 2; // decenas = 2
-                numero[0] = 3; // unidades = 3
-            } else {
-                // Para minutos: 00 -> 59
-                numero[1] = 5; // decenas = 5
-                numero[0] = 9; // unidades = 9
-            }
-        } else {
-            // Decrementar decenas y poner unidades a 9
-            numero[1]--;
-            numero[0] = 9;
-        }
-    } else {
-        // Simplemente decrementar unidades
-        numero[0]--;
-    }
+    xQueueSend(main_queue, &message, portMAX_DELAY);
+    xQueueReceive(command_done, &done, portMAX_DELAY);
 }
 
-void ModeChange(clock_mode_t actual) {
-    clock_mode = actual;
-
-    switch (clock_mode) {
-    case CLOCK_MODE_UNSET_TIME:
-        ScreenFlashDigits(board->screen, 0, 3, 100);
-        ScreenFlashDots(board->screen, 1, 1, 100);
-        memset(&time_to_display, 0, sizeof(clock_time_t));
-        break;
-
-    case CLOCK_MODE_DISPLAY:
-        ScreenFlashDigits(board->screen, 0, 3, 0);
-        ScreenFlashDots(board->screen, 1, 1, 500);
-        ClockUpdateAlarmVisual(clock, board, alarm_ringing);
-        break;
-
-    case CLOCK_MODE_SET_HOURS:
-        ScreenFlashDigits(board->screen, 0, 1, 100);
-        ScreenSetDots(board->screen, 1, 1); // Mostrar separador
-        break;
-
-    case CLOCK_MODE_SET_MINUTES:
-        ScreenFlashDigits(board->screen, 2, 3, 100);
-        ScreenSetDots(board->screen, 1, 1); // Mostrar separador
-        break;
-
-    case CLOCK_MODE_SET_ALARM_HOURS:
-        ScreenFlashDots(board->screen, 0, 0, 0);
-        ScreenClearDots(board->screen);
-        ScreenSetDots(board->screen, 0, 3); // Todos los puntos para indicar modo alarma
-        ScreenFlashDigits(board->screen, 0, 1, 100);
-        break;
-
-    case CLOCK_MODE_SET_ALARM_MINUTES:
-        ScreenFlashDots(board->screen, 0, 0, 0);
-        ScreenClearDots(board->screen);
-        ScreenSetDots(board->screen, 0, 3); // Todos los puntos para indicar modo alarma
-        ScreenFlashDigits(board->screen, 2, 3, 100);
-        break;
-
-    default:
-        break;
-    }
+static void ClockEnterCritical(void) {
+    taskENTER_CRITICAL();
+}
 
-    // Actualizar el contenido de la pantalla
-    UpdateDisplayContent();
+static void ClockExitCritical(void) {
+    taskEXIT_CRITICAL();
 }
 
-void UpdateDisplayContent(void) {
-    uint8_t value[4] = {0, 0, 0, 0};
-
-    switch (clock_mode) {
-    case CLOCK_MODE_DISPLAY:
-        ClockGetTime(clock, &time_to_display);
-        ClockTimeToBCD(&time_to_display, value);
-        break;
-
-    case CLOCK_MODE_SET_HOURS:
-        // Mostrar el tiempo que se está editando
-        ClockTimeToBCD(&time_to_display, value);
-        break;
-
-    case CLOCK_MODE_SET_MINUTES:
-        // Mostrar el tiempo que se está editando
-        ClockTimeToBCD(&time_to_display, value);
-        break;
-
-    case CLOCK_MODE_SET_ALARM_HOURS:
-        // Mostrar el tiempo de alarma que se está editando
-        ClockTimeToBCD(&time_to_display, value);
-        break;
-
-    case CLOCK_MODE_SET_ALARM_MINUTES:
-        // Mostrar el tiempo de alarma que se está editando
-        ClockTimeToBCD(&time_to_display, value);
-        break;
-
-    case CLOCK_MODE_UNSET_TIME:
-        // Mostrar "--:--" o tiempo por defecto
-        value[0] = 0;
-        value[1] = 0;
-        value[2] = 0;
-        value[3] = 0;
-        break;
-
-    default:
-        break;
-    }
+static void BootFirstFrame(void) {
+    boot_time_us = CycleCounterRead() / cycles_per_us;
+    TRACE_EVENT(TRACE_BOOT_FIRST_FRAME, 0);
+    BOOT_TIME_HOOK(boot_time_us);
+}
 
-    ScreenWriteBCD(board->screen, value, 4);
+static void IdleFlushState(void) {
+    AppFlushState(app);
+}
+
+static void BootDeferredInit(void) {
+    TaskHandle_t task = NULL;
+
+    BoardCompleteInit(board);
+    EepromInit();
+    AppAttachPersist(app, PersistCreate(&persist_storage));
+    // Las escrituras en la EEPROM esperan el fin de la programación, se hacen en la tarea inactiva
+    AppDeferSave(app, true);
+    IdleAttachJob(idle, IdleFlushState);
+    recorder = RecorderCreate(RecorderNow);
+    AppAttachRecorder(app, recorder);
+
+    // La aplicación y la hora sólo se ajustan en MainTask: los ajustes por el enlace serie se trasladan por su cola
+    serial = SerialCreate(UartWrite);
+    command = CommandCreate(serial, app, clock);
+    CommandAttachDefer(command, SerialDefer);
+    // Después de recuperar el estado guardado, así la corrección restaurada es la base de la sincronización
+    timesync = TimeSyncCreate(serial, clock, TIMESYNC_INTERVAL_SECONDS);
+    TimeSyncAttachDefer(timesync, SerialDefer);
+    CommandAttachSync(command, timesync);
+    CommandAttachIdle(command, idle);
+    xTaskCreate(SerialTask, // Tarea de comandos
+                "Serial", 256, NULL,
+                1, // Prioridad baja
+                &serial_task);
+    vTaskSetTaskNumber(serial_task, TRACE_TASK_SERIAL);
+    UartInit(SERIAL_BAUD_RATE, SerialUartReceive);
+
+    // Las teclas recién están configuradas, la tarea de botones se crea al final
+    increase_repeat = RepeatCreate(REPEAT_INCREASE, TICKS_PER_SECOND);
+    decrease_repeat = RepeatCreate(REPEAT_DECREASE, TICKS_PER_SECOND);
+    xTaskCreate(ButtonTask, // Tarea de botones
+                "Buttons", 128, NULL,
+                2, // Prioridad media
+                &task);
+    vTaskSetTaskNumber(task, TRACE_TASK_BUTTON);
 }
 
 bool IsLongPress(digital_input_t input, uint32_t * press_duration, bool * flag) {
@@ -353,13 +332,12 @@ bool IsLongPress(digital_input_t input, uint32_t * press_duration, bool * flag)
     return false;
 }
 
-void ResetConfigTimeout(void) {
-    timeout_count = 0;
-}
+static void SerialUartReceive(const uint8_t * data, uint16_t size) {
+    BaseType_t woken = pdFALSE;
 
-bool IsInConfigMode(void) {
-    return (clock_mode == CLOCK_MODE_SET_HOURS || clock_mode == CLOCK_MODE_SET_MINUTES ||
-            clock_mode == CLOCK_MODE_SET_ALARM_HOURS || clock_mode == CLOCK_MODE_SET_ALARM_MINUTES);
+    SerialReceive(serial, data, size);
+    vTaskNotifyGiveFromISR(serial_task, &woken);
+    portYIELD_FROM_ISR(woken);
 }
 
 /* === Public function implementation ========================================================= */
@@ -370,45 +348,59 @@ bool IsInConfigMode(void) {
  * @return int
  */
 int main(void) {
+    TaskHandle_t task = NULL;
 
+    // Arranque en etapas: la pantalla y la hora primero, el resto en MainTask después del primer cuadro
+    cycles_per_us = CycleCounterInit(); // Mide el tiempo de arranque desde aquí
+    board = BoardCreate();
     SysTickInit(TICKS_PER_SECOND);
+    TraceInit(CycleCounterRead, cycles_per_us);
+    idle_driver.cycles_per_second = (uint32_t)cycles_per_us * 1000000;
+    idle = IdleCreate(&idle_driver);
     clock = ClockCreate(TICKS_PER_SECOND);
-    board = BoardCreate();
-    ModeChange(CLOCK_MODE_UNSET_TIME);
+    ClockSetTrim(clock, CLOCK_TRIM_PPM);
+    ClockSetZone(clock, &(const clock_zone_t)CLOCK_ZONE);
+#if CLOCK_USE_RTC
+    RtcInit();
+#endif
+    ClockAttachSource(clock, &clock_source);
+    app = AppCreate(clock, board); // Publica la hora para el primer cuadro
+    AppAttachChronos(app, ChronoCreate(CHRONO_TIMER, clock_source.GetTicks, TICKS_PER_SECOND),
+                     ChronoCreate(CHRONO_STOPWATCH, clock_source.GetTicks, TICKS_PER_SECOND));
 
     main_queue = xQueueCreate(10, sizeof(task_message_t));
-    display_queue = xQueueCreate(5, sizeof(task_message_t));
-    clock_queue = xQueueCreate(5, sizeof(task_message_t));
+    command_done = xQueueCreate(1, sizeof(uint8_t));
 
-    if (main_queue == NULL || display_queue == NULL || clock_queue == NULL) {
+    if (main_queue == NULL || command_done == NULL) {
         // Error: no se pudieron crear las colas
         while (1);
     }
 
+    // Numerar la cola y las tareas para identificarlas en las trazas
+    vQueueSetQueueNumber(main_queue, TRACE_QUEUE_MAIN);
+
     // Crear todas las tareas
     xTaskCreate(DisplayTask, // Tarea de display (alta prioridad)
                 "Display",
                 128, // Stack pequeño
                 NULL,
                 3, // Prioridad alta
-                NULL);
+                &task);
+    vTaskSetTaskNumber(task, TRACE_TASK_DISPLAY);
 
     xTaskCreate(ClockTask, // Tarea de reloj
                 "Clock", 256, NULL,
                 2, // Prioridad media
-                NULL);
-
-    xTaskCreate(ButtonTask, // Tarea de botones
-                "Buttons", 128, NULL,
-                2, // Prioridad media
-                NULL);
+                &task);
+    vTaskSetTaskNumber(task, TRACE_TASK_CLOCK);
 
     xTaskCreate(MainTask, // Tarea principal (lógica)
                 "MainTask",
                 512, // Stack más grande para lógica
                 NULL,
                 1, // Prioridad baja
-                NULL);
+                &task);
+    vTaskSetTaskNumber(task, TRACE_TASK_MAIN);
 
     // Iniciar el scheduler de FreeRTOS
     vTaskStartScheduler();
@@ -421,30 +413,25 @@ static void DisplayTask(void * pvParameters) {
     (void)pvParameters;
 
     TickType_t xLastWakeTime = xTaskGetTickCount();
-    task_message_t message;
+    TickType_t previous_wake = xLastWakeTime;
+    uint16_t period;
+
+    // Es la tarea de mayor prioridad, por lo que el primer cuadro se muestra apenas arranca el scheduler
+    AppUpdateDisplay(app, false);
+    ScreenRefresh(board->screen);
+    BootFirstFrame();
+    vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(1));
 
     while (true) {
         // Siempre refrescar pantalla para multiplexado
         ScreenRefresh(board->screen);
 
-        // Verificar si hay mensajes (sin esperar)
-        if (xQueueReceive(display_queue, &message, 0) == pdTRUE) {
-            switch (message.type) {
-            case MSG_UPDATE_DISPLAY:
-                // Actualizar contenido del display en modo normal
-                if (clock_mode == CLOCK_MODE_DISPLAY) {
-                    uint8_t value[4];
-                    clock_time_t current_time;
-                    ClockGetTime(clock, &current_time);
-                    ClockTimeToBCD(&current_time, value);
-                    ScreenWriteBCD(board->screen, value, 4);
-                }
-                break;
-
-            default:
-                break;
-            }
-        }
+        // Los modos que muestran un tiempo que avanza (hora, temporizador o cronómetro) se actualizan al cruzar un
+        // múltiplo de su período; el tiempo se calcula recién aquí, nada se cuenta en cada tick. Los cuadros que
+        // publican los eventos se escriben en el barrido siguiente, esta es la única tarea que escribe la pantalla
+        period = AppRefreshTicks(app);
+        AppUpdateDisplay(app, period && ((xLastWakeTime / period) != (previous_wake / period)));
+        previous_wake = xLastWakeTime;
 
         // Refrescar cada 1ms para multiplexado suave
         vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(1));
@@ -455,37 +442,22 @@ static void ClockTask(void * pvParameters) {
     (void)pvParameters;
 
     TickType_t xLastWakeTime = xTaskGetTickCount();
-    uint32_t count = 0;
-    task_message_t message;
+    uint32_t elapsed;
+    task_message_t message = {0};
 
     while (true) {
-        // Incrementar el reloj cada segundo (1000 ticks de 1ms)
-        ClockNewTick(clock);
-        count++;
+        // Actualizar el reloj desde su fuente, sin perder tiempo aunque la tarea se haya demorado
+        elapsed = ClockRefresh(clock);
 
         // Verificar timeout de configuración
-        if (IsInConfigMode()) {
-            timeout_count++;
-            if (timeout_count >= CONFIG_TIMEOUT_TICKS) {
-                timeout_count = 0;
-
-                // Enviar mensaje de timeout a MainTask
-                message.type = MSG_CONFIG_TIMEOUT;
-                message.data = 0;
-                xQueueSend(main_queue, &message, 0);
-            }
-        }
-
-        // Actualizar pantalla cada 100ms cuando estamos en modo DISPLAY
-        if (clock_mode == CLOCK_MODE_DISPLAY && (count % 100) == 0) {
-            // Enviar mensaje para actualizar display
-            message.type = MSG_UPDATE_DISPLAY;
+        if (AppConfigTimeoutTick(app, elapsed)) {
+            // Enviar mensaje de timeout a MainTask
+            message.type = MSG_CONFIG_TIMEOUT;
             message.data = 0;
-            xQueueSend(display_queue, &message, 0);
+            xQueueSend(main_queue, &message, 0);
         }
 
-        // Esperar 1ms
-        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(1));
+        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(CLOCK_TASK_PERIOD_TICKS));
     }
 }
 
@@ -493,20 +465,22 @@ static void ButtonTask(void * pvParameters) {
     (void)pvParameters;
 
     TickType_t xLastWakeTime = xTaskGetTickCount();
-    task_message_t message;
+    task_message_t message = {0};
+    uint16_t increase_pending = 0;
+    uint16_t decrease_pending = 0;
 
     while (true) {
         // Detectar presiones largas
         if (IsLongPress(board->set_time, &set_time_press_duration, &set_time_long_pressed)) {
             message.type = MSG_BUTTON_SET_TIME_LONG;
-            message.data = 0;
+            message.data = xTaskGetTickCount(); // Instante del flanco
             xQueueSend(main_queue, &message, 0); // Enviar sin esperar
                                                  
         }
 
         if (IsLongPress(board->set_alarm, &set_alarm_press_duration, &set_alarm_long_pressed)) {
             message.type = MSG_BUTTON_SET_ALARM_LONG;
-            message.data = 0;
+            message.data = xTaskGetTickCount(); // Instante del flanco
             xQueueSend(main_queue, &message, 0);
             
         }
@@ -514,32 +488,36 @@ static void ButtonTask(void * pvParameters) {
         // Detectar presiones normales de botones
         if (DigitalInputWasActivated(board->accept)) {
             message.type = MSG_BUTTON_ACCEPT;
-            message.data = 0;
+            message.data = xTaskGetTickCount(); // Instante del flanco
             xQueueSend(main_queue, &message, 0);
             
         }
 
         if (DigitalInputWasActivated(board->cancel)) {
             message.type = MSG_BUTTON_CANCEL;
-            message.data = 0;
+            message.data = xTaskGetTickCount(); // Instante del flanco
             xQueueSend(main_queue, &message, 0);
             
         }
 
         if (DigitalInputWasActivated(board->increase)) {
             message.type = MSG_BUTTON_INCREASE;
-            message.data = 0;
+            message.data = xTaskGetTickCount(); // Instante del flanco
             xQueueSend(main_queue, &message, 0);
             
         }
 
         if (DigitalInputWasActivated(board->decrease)) {
             message.type = MSG_BUTTON_DECREASE;
-            message.data = 0;
+            message.data = xTaskGetTickCount(); // Instante del flanco
             xQueueSend(main_queue, &message, 0);
             
         }
 
+        // Teclas mantenidas: un mensaje por repetición con todos los pasos vencidos, no un mensaje por paso
+        SendRepeat(increase_repeat, board->increase, MSG_BUTTON_INCREASE_REPEAT, &increase_pending);
+        SendRepeat(decrease_repeat, board->decrease, MSG_BUTTON_DECREASE_REPEAT, &decrease_pending);
+
         // Verificar botones cada 10ms para buena responsividad
         vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(1));
     }
@@ -550,159 +528,59 @@ static void MainTask(void * pvParameters) {
     (void)pvParameters;
 
     task_message_t message;
-    TickType_t timeout = pdMS_TO_TICKS(50); // Timeout de 50ms para recibir mensajes
+    const uint8_t done = 1;
+    TickType_t timeout;
+    uint32_t delay;
+
+    BootDeferredInit();
 
     while (true) {
-        // Recibir mensaje (esperar hasta 50ms)
-        if (xQueueReceive(main_queue, &message, timeout) == pdTRUE) {
-            // Procesar mensaje recibido
-            switch (message.type) {
-            case MSG_BUTTON_SET_TIME_LONG:
-                if (clock_mode == CLOCK_MODE_UNSET_TIME || clock_mode == CLOCK_MODE_DISPLAY) {
-                    ClockGetTime(clock, &time_to_display);
-                    ModeChange(CLOCK_MODE_SET_MINUTES);
-                }
-                break;
+        // Tarea periódica del modo actual (en modo DISPLAY, manejar alarma)
+        AppPoll(app);
 
-            case MSG_BUTTON_SET_ALARM_LONG:
-                if (clock_mode == CLOCK_MODE_UNSET_TIME || clock_mode == CLOCK_MODE_DISPLAY) {
-                    ClockGetAlarm(clock, &time_to_display);
-                    ModeChange(CLOCK_MODE_SET_ALARM_MINUTES);
-                }
-                break;
-
-            case MSG_BUTTON_ACCEPT:
-                switch (clock_mode) {
-                case CLOCK_MODE_DISPLAY:
-                    if (alarm_ringing) {
-                        ClockPostponeAlarm(clock, 5);
-                        alarm_ringing = ClockCheckAlarm(clock);
-                    } else {
-                        ClockEnableAlarm(clock, true);
-                    }
-                    break;
-                case CLOCK_MODE_SET_HOURS:
-                    ResetConfigTimeout();
-                    ClockSetTime(clock, &time_to_display);
-                    ModeChange(CLOCK_MODE_DISPLAY);
-                    break;
-                case CLOCK_MODE_SET_MINUTES:
-                    ResetConfigTimeout();
-                    ClockSetTime(clock, &time_to_display);
-                    ModeChange(CLOCK_MODE_SET_HOURS);
-                    break;
-                case CLOCK_MODE_SET_ALARM_HOURS:
-                    ResetConfigTimeout();
-                    ClockSetAlarm(clock, &time_to_display);
-                    ModeChange(CLOCK_MODE_DISPLAY);
-                    break;
-                case CLOCK_MODE_SET_ALARM_MINUTES:
-                    ResetConfigTimeout();
-                    ClockSetAlarm(clock, &time_to_display);
-                    ClockEnableAlarm(clock, true);
-                    ModeChange(CLOCK_MODE_SET_ALARM_HOURS);
-                    break;
-                default:
-                    break;
-                }
-                break;
-
-            case MSG_BUTTON_CANCEL:
-                switch (clock_mode) {
-                case CLOCK_MODE_DISPLAY:
-                    if (alarm_ringing) {
-                        ClockStopAlarm(clock);
-                        ClockEnableAlarm(clock, false);
-                        alarm_ringing = false;
-                    } else {
-                        ClockEnableAlarm(clock, false);
-                    }
-                    break;
-                case CLOCK_MODE_SET_HOURS:
-                case CLOCK_MODE_SET_MINUTES:
-                    ResetConfigTimeout();
-                    {
-                        clock_time_t current_time;
-                        if (ClockGetTime(clock, &current_time)) {
-                            ModeChange(CLOCK_MODE_DISPLAY);
-                        } else {
-                            ModeChange(CLOCK_MODE_UNSET_TIME);
-                        }
-                    }
-                    break;
-                case CLOCK_MODE_SET_ALARM_HOURS:
-                case CLOCK_MODE_SET_ALARM_MINUTES:
-                    ResetConfigTimeout();
-                    ModeChange(CLOCK_MODE_DISPLAY);
-                    break;
-                default:
-                    break;
-                }
-                break;
-
-            case MSG_BUTTON_INCREASE:
-                switch (clock_mode) {
-                case CLOCK_MODE_SET_HOURS:
-                case CLOCK_MODE_SET_ALARM_HOURS:
-                    ResetConfigTimeout();
-                    IncreaseBCD(time_to_display.time.hours, HOURS_LIMIT);
-                    UpdateDisplayContent();
-                    break;
-                case CLOCK_MODE_SET_MINUTES:
-                case CLOCK_MODE_SET_ALARM_MINUTES:
-                    ResetConfigTimeout();
-                    IncreaseBCD(time_to_display.time.minutes, MINUTES_LIMIT);
-                    UpdateDisplayContent();
-                    break;
-                default:
-                    break;
-                }
-                break;
-
-            case MSG_BUTTON_DECREASE:
-                switch (clock_mode) {
-                case CLOCK_MODE_SET_HOURS:
-                case CLOCK_MODE_SET_ALARM_HOURS:
-                    ResetConfigTimeout();
-                    DecreaseBCD(time_to_display.time.hours, HOURS_LIMIT);
-                    UpdateDisplayContent();
-                    break;
-                case CLOCK_MODE_SET_MINUTES:
-                case CLOCK_MODE_SET_ALARM_MINUTES:
-                    ResetConfigTimeout();
-                    DecreaseBCD(time_to_display.time.minutes, MINUTES_LIMIT);
-                    UpdateDisplayContent();
-                    break;
-                default:
-                    break;
-                }
-                break;
-
-            case MSG_CONFIG_TIMEOUT: {
-                clock_time_t current_time;
-                if (ClockGetTime(clock, &current_time)) {
-                    ModeChange(CLOCK_MODE_DISPLAY);
-                } else {
-                    ModeChange(CLOCK_MODE_UNSET_TIME);
-                }
-            } break;
+        // Sin mensajes sólo se despierta al vencer el temporizador o al cambiar la alarma, sin plazos espera sin límite
+        delay = AppPollDelay(app);
+        timeout = (delay == CLOCK_NO_DEADLINE) ? portMAX_DELAY : (delay ? (TickType_t)delay : 1);
 
-            default:
-                // Mensaje no reconocido
-                break;
+        // Recibir mensaje y despacharlo según la tabla de transiciones
+        if (xQueueReceive(main_queue, &message, timeout) == pdTRUE) {
+            if (message.type == MSG_SERIAL_COMMAND) {
+                // Ajuste o corrección de la hora pedidos por el enlace serie, SerialTask espera el aviso para seguir
+                CommandApply(command);
+                TimeSyncApply(timesync);
+                xQueueSend(command_done, &done, 0);
+            } else {
+                if ((message.type <= MSG_BUTTON_DECREASE) || (message.type == MSG_BUTTON_INCREASE_REPEAT) ||
+                    (message.type == MSG_BUTTON_DECREASE_REPEAT)) {
+                    RecorderLogAt(recorder, message.data, RECORD_BUTTON, message.type, message.steps);
+                }
+                AppDispatchSteps(app, message.type, message.steps);
             }
         }
-
-        // Si estamos en modo DISPLAY, manejar alarma
-        if (clock_mode == CLOCK_MODE_DISPLAY) {
-            alarm_ringing = ClockCheckAlarm(clock);
-            ClockUpdateAlarmVisual(clock, board, alarm_ringing);
-        }
     }
 
     vTaskDelete(NULL);
 }
 
+static void SerialTask(void * pvParameters) {
+    (void)pvParameters;
+
+    while (true) {
+        // Esperar a que la interrupción entregue bytes y ejecutar todas las tramas completas; sin bytes se despierta
+        // igual para terminar a tiempo la corrección transitoria del oscilador y enviar los pedidos de sincronización
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CLOCK_TASK_PERIOD_TICKS));
+        CommandProcess(command);
+        TimeSyncPoll(timesync);
+    }
+}
+
+/**
+ * @brief Gancho de la tarea inactiva de FreeRTOS: ejecuta un trabajo diferido y duerme hasta la próxima interrupción.
+ */
+void vApplicationIdleHook(void) {
+    IdleHook(idle);
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
@@ -0,0 +1,245 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file persist.c
+ ** @brief Código fuente del almacenamiento persistente del estado del reloj
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "persist.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Marca de un registro escrito ("PS" en little endian), un lugar borrado tiene 0xFFFF
+#define PERSIST_RECORD_MAGIC 0x5350
+
+//! Valor de la marca en un lugar borrado de la memoria
+#define PERSIST_ERASED 0xFFFF
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro del log tal como se guarda en la memoria, ocupa 16 bytes
+typedef struct {
+    uint16_t magic;        //!< PERSIST_RECORD_MAGIC si el lugar fue escrito
+    uint16_t check;        //!< Suma de verificación Fletcher-16 del registro, calculada con este campo en cero
+    uint32_t sequence;     //!< Número de secuencia, crece en uno con cada registro guardado
+    persist_state_t state; //!< Estado guardado
+} persist_record_t;
+
+//! Verifica en compilación que el registro no tenga relleno, porque se escribe tal cual en la memoria
+typedef char persist_record_size_check[(sizeof(persist_record_t) == 16) ? 1 : -1];
+
+//! Estructura interna del almacenamiento persistente
+struct persist_s {
+    persist_storage_t storage; //!< Controlador de la memoria no volátil
+    uint16_t slots;            //!< Cantidad de registros por sector
+    uint16_t next_slot;        //!< Próximo lugar libre del sector en uso, slots si está lleno
+    uint8_t sector;            //!< Sector en uso
+    uint32_t sequence;         //!< Secuencia del último registro guardado
+    persist_state_t state;     //!< Último estado guardado
+    bool valid;                //!< Indica si hay un estado guardado
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Calcula la suma de verificación de un registro.
+ *
+ * @param record    El registro.
+ * @return          Suma Fletcher-16 de todos los bytes del registro, con el campo check en cero.
+ */
+static uint16_t PersistChecksum(const persist_record_t * record);
+
+/**
+ * @brief           Calcula la dirección de un lugar del log.
+ *
+ * @param self      El almacenamiento.
+ * @param sector    Número de sector.
+ * @param slot      Número de lugar dentro del sector.
+ * @return          Dirección del lugar en la memoria.
+ */
+static uint32_t PersistAddress(persist_t self, uint8_t sector, uint16_t slot);
+
+/**
+ * @brief           Lee un registro y verifica que esté completo.
+ *
+ * @param self      El almacenamiento.
+ * @param sector    Número de sector.
+ * @param slot      Número de lugar dentro del sector.
+ * @param record    Registro leído.
+ * @return          true si el registro fue escrito completo, false si está borrado, incompleto o no se pudo leer.
+ */
+static bool PersistReadRecord(persist_t self, uint8_t sector, uint16_t slot, persist_record_t * record);
+
+/**
+ * @brief           Indica si un lugar del log fue escrito, leyendo sólo su marca.
+ *
+ * @param self      El almacenamiento.
+ * @param sector    Número de sector.
+ * @param slot      Número de lugar dentro del sector.
+ * @return          true si el lugar no está borrado, aunque el registro esté incompleto.
+ */
+static bool PersistSlotIsUsed(persist_t self, uint8_t sector, uint16_t slot);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t PersistChecksum(const persist_record_t * record) {
+    persist_record_t copy = *record;
+    const uint8_t * data = (const uint8_t *)&copy;
+    uint16_t sum = 0;
+    uint16_t sum_of_sums = 0;
+
+    copy.check = 0;
+    for (uint8_t index = 0; index < sizeof(persist_record_t); index++) {
+        sum = (sum + data[index]) % 255;
+        sum_of_sums = (sum_of_sums + sum) % 255;
+    }
+    return (uint16_t)((sum_of_sums << 8) | sum);
+}
+
+static uint32_t PersistAddress(persist_t self, uint8_t sector, uint16_t slot) {
+    return (uint32_t)sector * self->storage->sector_size + (uint32_t)slot * sizeof(persist_record_t);
+}
+
+static bool PersistReadRecord(persist_t self, uint8_t sector, uint16_t slot, persist_record_t * record) {
+    if (!self->storage->Read(PersistAddress(self, sector, slot), record, sizeof(persist_record_t))) {
+        return false;
+    }
+    return (record->magic == PERSIST_RECORD_MAGIC) && (record->check == PersistChecksum(record));
+}
+
+static bool PersistSlotIsUsed(persist_t self, uint8_t sector, uint16_t slot) {
+    uint16_t magic = PERSIST_ERASED;
+    self->storage->Read(PersistAddress(self, sector, slot), &magic, sizeof(magic));
+    return magic != PERSIST_ERASED;
+}
+
+/* === Public function definitions ============================================================================== */
+
+persist_t PersistCreate(persist_storage_t storage) {
+    static struct persist_s self[1];
+    persist_record_t record;
+
+    if (!storage || !storage->Read || !storage->Write || !storage->Erase || (storage->sectors < 2) ||
+        (storage->sector_size < sizeof(persist_record_t))) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct persist_s));
+    self->storage = storage;
+    self->slots = storage->sector_size / sizeof(persist_record_t);
+
+    // El sector en uso es el que comienza con la secuencia más alta, la resta con signo tolera el desborde
+    for (uint8_t sector = 0; sector < storage->sectors; sector++) {
+        if (PersistReadRecord(self, sector, 0, &record) &&
+            (!self->valid || ((int32_t)(record.sequence - self->sequence) > 0))) {
+            self->valid = true;
+            self->sector = sector;
+            self->sequence = record.sequence;
+        }
+    }
+    if (!self->valid) {
+        // Memoria sin registros: la primera escritura borra el sector 0
+        self->sector = storage->sectors - 1;
+        self->next_slot = self->slots;
+        return self;
+    }
+
+    // Los registros se escriben en orden desde el primer lugar, el último escrito se encuentra en forma binaria
+    uint16_t low = 0;
+    uint16_t high = self->slots - 1;
+    while (low < high) {
+        uint16_t middle = (uint16_t)((low + high + 1) / 2);
+        if (PersistSlotIsUsed(self, self->sector, middle)) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+    self->next_slot = low + 1;
+
+    // Si la última escritura se interrumpió se toma el registro anterior, el primero del sector ya fue verificado
+    while ((low > 0) && !PersistReadRecord(self, self->sector, low, &record)) {
+        low--;
+    }
+    if (low == 0) {
+        PersistReadRecord(self, self->sector, 0, &record);
+    }
+    self->sequence = record.sequence;
+    self->state = record.state;
+    return self;
+}
+
+bool PersistRestore(persist_t self, persist_state_t * state) {
+    if (!self || !self->valid) {
+        return false;
+    }
+    *state = self->state;
+    return true;
+}
+
+bool PersistSave(persist_t self, const persist_state_t * state) {
+    if (!self) {
+        return false;
+    }
+    if (self->valid && (memcmp(&self->state, state, sizeof(persist_state_t)) == 0)) {
+        return true; // El estado no cambió, no se gasta un registro
+    }
+
+    persist_record_t record = {
+        .magic = PERSIST_RECORD_MAGIC,
+        .sequence = self->sequence + 1,
+        .state = *state,
+    };
+    record.check = PersistChecksum(&record);
+
+    if (self->next_slot >= self->slots) {
+        // El sector en uso se conserva hasta que el primer registro del siguiente quede escrito
+        uint8_t sector = (uint8_t)((self->sector + 1) % self->storage->sectors);
+        if (!self->storage->Erase(sector)) {
+            return false;
+        }
+        self->sector = sector;
+        self->next_slot = 0;
+    }
+
+    uint32_t address = PersistAddress(self, self->sector, self->next_slot);
+    self->next_slot++; // Un lugar con una escritura fallida no se vuelve a usar
+    if (!self->storage->Write(address, &record, sizeof(persist_record_t))) {
+        if (self->next_slot == 1) {
+            // Sin un primer registro válido el sector nuevo no se reconoce, la próxima escritura lo vuelve a borrar
+            self->sector = (uint8_t)((self->sector + self->storage->sectors - 1) % self->storage->sectors);
+            self->next_slot = self->slots;
+        }
+        return false;
+    }
+    self->sequence = record.sequence;
+    self->state = *state;
+    self->valid = true;
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
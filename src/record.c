@@ -0,0 +1,103 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file record.c
+ ** @brief Código fuente del registrador de eventos de la aplicación
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "record.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#if (RECORD_BUFFER_SIZE & (RECORD_BUFFER_SIZE - 1)) != 0
+#error "RECORD_BUFFER_SIZE debe ser potencia de dos"
+#endif
+
+#define RECORD_MASK (RECORD_BUFFER_SIZE - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura interna del registrador
+struct recorder_s {
+    record_clock_t now;                         //!< Función que devuelve el instante actual
+    uint32_t head;                              //!< Cantidad total de eventos escritos
+    uint32_t tail;                              //!< Cantidad total de eventos leídos o descartados
+    uint32_t dropped;                           //!< Cantidad de eventos descartados por falta de espacio
+    record_event_t events[RECORD_BUFFER_SIZE];  //!< Buffer circular de eventos
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ============================================================================== */
+
+recorder_t RecorderCreate(record_clock_t now) {
+    static struct recorder_s self[1];
+    memset(self, 0, sizeof(struct recorder_s));
+    self->now = now;
+    return self;
+}
+
+void RecorderLog(recorder_t self, record_kind_t kind, uint8_t id, uint16_t value) {
+    if (self) {
+        RecorderLogAt(self, self->now ? self->now() : 0, kind, id, value);
+    }
+}
+
+void RecorderLogAt(recorder_t self, uint32_t timestamp, record_kind_t kind, uint8_t id, uint16_t value) {
+    if (!self) {
+        return;
+    }
+    if ((self->head - self->tail) == RECORD_BUFFER_SIZE) {
+        self->tail++; // Se descarta el evento más antiguo
+        self->dropped++;
+    }
+
+    record_event_t * event = &self->events[self->head & RECORD_MASK];
+    event->timestamp = timestamp;
+    event->kind = (uint8_t)kind;
+    event->id = id;
+    event->value = value;
+    self->head++;
+}
+
+uint16_t RecorderRead(recorder_t self, record_event_t * events, uint16_t size) {
+    uint16_t count = 0;
+    while ((count < size) && (self->tail != self->head)) {
+        events[count] = self->events[self->tail & RECORD_MASK];
+        self->tail++;
+        count++;
+    }
+    return count;
+}
+
+uint32_t RecorderDropped(recorder_t self) {
+    return self->dropped;
+}
+
+/* === End of documentation ======================================================================================== */
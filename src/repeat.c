@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file repeat.c
+ ** @brief Código fuente de la repetición acelerada de las teclas de incremento y decremento
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "repeat.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de tamaños de paso
+#define REPEAT_STAGES (sizeof(REPEAT_STEPS) / sizeof(REPEAT_STEPS[0]))
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura interna de la repetición de una tecla
+struct repeat_s {
+    uint32_t delay;  //!< Ticks hasta la primera repetición
+    uint32_t period; //!< Ticks entre dos repeticiones
+    uint32_t stage;  //!< Ticks de repetición con cada tamaño de paso
+    uint32_t start;  //!< Instante de la primera repetición
+    uint32_t next;   //!< Instante de la próxima repetición
+    bool held;       //!< Indica si la tecla estaba presionada en la consulta anterior
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Tamaño del paso en cada etapa de la repetición, el último se mantiene mientras la tecla siga presionada
+static const uint8_t REPEAT_STEPS[] = {1, 5, 10};
+
+//! Instancias, indexadas por repeat_key_t
+static struct repeat_s instances[REPEAT_COUNT];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ============================================================================== */
+
+repeat_t RepeatCreate(repeat_key_t key, uint16_t ticks_per_second) {
+    if ((key >= REPEAT_COUNT) || !ticks_per_second) {
+        return NULL;
+    }
+    repeat_t self = &instances[key];
+    memset(self, 0, sizeof(struct repeat_s));
+    self->delay = (uint32_t)REPEAT_DELAY_MS * ticks_per_second / 1000;
+    self->period = (uint32_t)REPEAT_PERIOD_MS * ticks_per_second / 1000;
+    self->stage = (uint32_t)REPEAT_STAGE_MS * ticks_per_second / 1000;
+    if (!self->period) {
+        self->period = 1;
+    }
+    if (!self->stage) {
+        self->stage = 1;
+    }
+    return self;
+}
+
+uint16_t RepeatUpdate(repeat_t self, bool pressed, uint32_t now) {
+    uint32_t steps = 0;
+
+    if (!self) {
+        return 0;
+    }
+    if (!pressed) {
+        self->held = false;
+        return 0;
+    }
+    if (!self->held) {
+        self->held = true;
+        self->start = now + self->delay;
+        self->next = self->start;
+        return 0;
+    }
+
+    // Se suman todas las repeticiones vencidas, la resta con signo tolera el desborde del contador
+    while ((int32_t)(now - self->next) >= 0) {
+        uint32_t stage = (self->next - self->start) / self->stage;
+        steps += REPEAT_STEPS[(stage < REPEAT_STAGES) ? stage : (REPEAT_STAGES - 1)];
+        self->next += self->period;
+    }
+    return (steps > UINT16_MAX) ? UINT16_MAX : (uint16_t)steps;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -24,8 +24,8 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "screen.h"
-#include "chip.h"
-#include "shield.h"
+#include "trace.h"
+#include <stdbool.h>
 #include <stdlib.h>
 
 /* === Macros definitions ========================================================================================== */
@@ -56,6 +56,9 @@ struct screen_s {
     // Driver
     screen_driver_t driver;            //!< Puntero a la estructura que contiene las funciones del driver de la pantalla
     uint8_t values[SCREEN_MAX_DIGITS]; //!< Valores de los segmentos para cada dígito
+    // Cuadro pendiente
+    uint8_t pending[SCREEN_MAX_DIGITS]; //!< Segmentos del último cuadro escrito, se copian a values al barrer
+    volatile bool pending_ready;        //!< Indica que pending tiene un cuadro completo que todavía no se mostró
 };
 
 static const uint8_t IMAGES[10] = {
@@ -73,18 +76,6 @@ static const uint8_t IMAGES[10] = {
 
 /* === Private function declarations =============================================================================== */
 
-/**
- * @brief Función para configurar los dígitos de la pantalla
- *
- */
-void DigitsInit(void);
-
-/**
- * @brief Función para configurar los segmentos de la pantalla
- *
- */
-void SegmentsInit(void);
-
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
@@ -110,27 +101,39 @@ screen_t ScreenCreate(uint8_t digits, screen_driver_t driver) {
         self->dots_to = 0;
         self->dots_flashing_frecuency = 0;
         self->dots_flashing_count = 0;
+
+        memset(self->values, 0, sizeof(self->values));
+        self->pending_ready = false;
     }
     return self;
 }
 
 void ScreenWriteBCD(screen_t self, uint8_t value[], uint8_t size) {
-    memset(self->values, 0, sizeof(self->values));
+    // Si el refresco interrumpe la escritura no toma el cuadro a medio escribir, lo toma en el barrido siguiente
+    self->pending_ready = false;
+    memset(self->pending, 0, sizeof(self->pending));
     if (size > self->digits) {
         size = self->digits;
     }
     for (uint8_t i = 0; i < size; i++) {
-        self->values[i] = IMAGES[value[i]];
+        self->pending[i] = IMAGES[value[i]];
     }
+    self->pending_ready = true;
 }
 
 void ScreenRefresh(screen_t self) {
     static uint32_t global_flash_counter = 0;  // Contador global
     uint8_t segments;
-    
+
+    TRACE_EVENT(TRACE_SCREEN_REFRESH_BEGIN, self->current_digit);
     self->driver->DigitsTurnOff();
     self->current_digit = (self->current_digit + 1) % self->digits;
 
+    // Un solo cuadro por barrido: el cuadro nuevo se toma completo antes de encender el primer dígito
+    if ((self->current_digit == 0) && self->pending_ready) {
+        memcpy(self->values, self->pending, sizeof(self->values));
+        self->pending_ready = false;
+    }
     segments = self->values[self->current_digit];
     
     // Incrementar contador global en cada llamada
@@ -175,6 +178,7 @@ void ScreenRefresh(screen_t self) {
     
     self->driver->SegmentsUpdate(segments);
     self->driver->DigitsTurnOn(self->current_digit);
+    TRACE_EVENT(TRACE_SCREEN_REFRESH_END, self->current_digit);
 }
 
 int ScreenFlashDigits(screen_t self, uint8_t from, uint8_t to, uint16_t frecuency) {
@@ -0,0 +1,225 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file serial.c
+ ** @brief Código fuente del enlace serie con tramas binarias
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "serial.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#if (SERIAL_BUFFER_SIZE & (SERIAL_BUFFER_SIZE - 1)) != 0
+#error "SERIAL_BUFFER_SIZE debe ser potencia de dos"
+#endif
+
+#define SERIAL_MASK (SERIAL_BUFFER_SIZE - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+//! Parte de la trama que espera el separador de tramas
+typedef enum {
+    SERIAL_WAIT_SYNC,
+    SERIAL_WAIT_COMMAND,
+    SERIAL_WAIT_LENGTH,
+    SERIAL_WAIT_PAYLOAD,
+    SERIAL_WAIT_CHECK_LOW,
+    SERIAL_WAIT_CHECK_HIGH,
+} serial_state_t;
+
+//! Estructura interna del enlace serie
+struct serial_s {
+    serial_write_t write;                       //!< Función que transmite los bytes
+    volatile uint8_t buffer[SERIAL_BUFFER_SIZE]; //!< Buffer circular de recepción
+    volatile uint32_t head;                     //!< Cantidad total de bytes guardados, lo escribe sólo el productor
+    volatile uint32_t tail;                     //!< Cantidad total de bytes leídos, lo escribe sólo el consumidor
+    volatile uint32_t overruns;                 //!< Bytes descartados por buffer lleno
+    uint32_t frames;                            //!< Tramas recibidas completas
+    uint32_t errors;                            //!< Tramas descartadas
+    serial_state_t state;                       //!< Parte de la trama que se espera
+    serial_frame_t frame;                       //!< Trama en recepción
+    uint8_t index;                              //!< Bytes de datos recibidos de la trama en recepción
+    uint8_t sum;                                //!< Primera suma Fletcher-16 de la trama en recepción
+    uint8_t sum_of_sums;                        //!< Segunda suma Fletcher-16 de la trama en recepción
+    uint8_t check_low;                          //!< Byte bajo de la suma recibida
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief               Agrega un byte a la suma de verificación Fletcher-16.
+ *
+ * @param sum           Primera suma.
+ * @param sum_of_sums   Segunda suma.
+ * @param value         Byte a agregar.
+ */
+static void SerialChecksumAdd(uint8_t * sum, uint8_t * sum_of_sums, uint8_t value);
+
+/**
+ * @brief           Procesa un byte recibido con el separador de tramas.
+ *
+ * @param self      El enlace.
+ * @param value     Byte recibido.
+ * @return          true si el byte completó una trama válida.
+ */
+static bool SerialParse(serial_t self, uint8_t value);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void SerialChecksumAdd(uint8_t * sum, uint8_t * sum_of_sums, uint8_t value) {
+    *sum = (uint8_t)((*sum + value) % 255);
+    *sum_of_sums = (uint8_t)((*sum_of_sums + *sum) % 255);
+}
+
+static bool SerialParse(serial_t self, uint8_t value) {
+    switch (self->state) {
+    case SERIAL_WAIT_SYNC:
+        if (value == SERIAL_SYNC) {
+            self->sum = 0;
+            self->sum_of_sums = 0;
+            self->state = SERIAL_WAIT_COMMAND;
+        }
+        return false;
+
+    case SERIAL_WAIT_COMMAND:
+        self->frame.command = value;
+        SerialChecksumAdd(&self->sum, &self->sum_of_sums, value);
+        self->state = SERIAL_WAIT_LENGTH;
+        return false;
+
+    case SERIAL_WAIT_LENGTH:
+        if (value > SERIAL_PAYLOAD_MAX) {
+            self->errors++;
+            self->state = SERIAL_WAIT_SYNC;
+            return false;
+        }
+        self->frame.length = value;
+        self->index = 0;
+        SerialChecksumAdd(&self->sum, &self->sum_of_sums, value);
+        self->state = value ? SERIAL_WAIT_PAYLOAD : SERIAL_WAIT_CHECK_LOW;
+        return false;
+
+    case SERIAL_WAIT_PAYLOAD:
+        self->frame.payload[self->index++] = value;
+        SerialChecksumAdd(&self->sum, &self->sum_of_sums, value);
+        if (self->index == self->frame.length) {
+            self->state = SERIAL_WAIT_CHECK_LOW;
+        }
+        return false;
+
+    case SERIAL_WAIT_CHECK_LOW:
+        self->check_low = value;
+        self->state = SERIAL_WAIT_CHECK_HIGH;
+        return false;
+
+    default:
+        self->state = SERIAL_WAIT_SYNC;
+        if ((self->check_low != self->sum) || (value != self->sum_of_sums)) {
+            self->errors++;
+            return false;
+        }
+        self->frames++;
+        return true;
+    }
+}
+
+/* === Public function definitions ============================================================================== */
+
+serial_t SerialCreate(serial_write_t write) {
+    static struct serial_s self[1];
+
+    if (!write) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct serial_s));
+    self->write = write;
+    self->state = SERIAL_WAIT_SYNC;
+    return self;
+}
+
+uint16_t SerialReceive(serial_t self, const uint8_t * data, uint16_t size) {
+    uint32_t head = self->head;
+    uint16_t stored = 0;
+
+    // Sólo el productor escribe head y sólo el consumidor escribe tail, así no hace falta deshabilitar interrupciones
+    while ((stored < size) && ((head - self->tail) < SERIAL_BUFFER_SIZE)) {
+        self->buffer[head & SERIAL_MASK] = data[stored++];
+        head++;
+    }
+    self->head = head; // Se publica al final, cuando los bytes ya están en el buffer
+    self->overruns += size - stored;
+    return stored;
+}
+
+bool SerialReadFrame(serial_t self, serial_frame_t * frame) {
+    uint32_t tail = self->tail;
+    bool complete = false;
+
+    while (!complete && (tail != self->head)) {
+        complete = SerialParse(self, self->buffer[tail & SERIAL_MASK]);
+        tail++;
+    }
+    self->tail = tail;
+    if (complete) {
+        memcpy(frame, &self->frame, sizeof(serial_frame_t));
+    }
+    return complete;
+}
+
+bool SerialSendFrame(serial_t self, uint8_t command, const void * payload, uint8_t length) {
+    uint8_t data[SERIAL_PAYLOAD_MAX + SERIAL_FRAME_OVERHEAD];
+    uint8_t sum = 0;
+    uint8_t sum_of_sums = 0;
+
+    if (length > SERIAL_PAYLOAD_MAX) {
+        return false;
+    }
+    data[0] = SERIAL_SYNC;
+    data[1] = command;
+    data[2] = length;
+    if (length) {
+        memcpy(&data[3], payload, length);
+    }
+    for (uint8_t index = 1; index < length + 3; index++) {
+        SerialChecksumAdd(&sum, &sum_of_sums, data[index]);
+    }
+    data[length + 3] = sum;
+    data[length + 4] = sum_of_sums;
+
+    // Una sola escritura por trama, así la UART la transmite sin pausas entre los campos
+    self->write(data, (uint16_t)(length + SERIAL_FRAME_OVERHEAD));
+    return true;
+}
+
+void SerialGetStats(serial_t self, serial_stats_t * stats) {
+    stats->received = self->head;
+    stats->overruns = self->overruns;
+    stats->frames = self->frames;
+    stats->errors = self->errors;
+}
+
+/* === End of documentation ======================================================================================== */
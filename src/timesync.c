@@ -0,0 +1,271 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file timesync.c
+ ** @brief Código fuente del cliente de sincronización de la hora por el enlace serie
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "timesync.h"
+#include "command.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Partes por millón de la unidad
+#define TIMESYNC_PPM 1000000
+
+//! Longitud de los datos de la respuesta: t1, t2 y t3 de 8 bytes cada uno
+#define TIMESYNC_REPLY_LENGTH 24
+
+//! Fracción del error de frecuencia medido que se suma a la corrección base en cada muestra, filtra el ruido
+#define TIMESYNC_FREQUENCY_GAIN 2
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura interna del cliente de sincronización
+struct timesync_s {
+    serial_t serial;           //!< Enlace serie con la PC
+    clock_t clock;             //!< Reloj a sincronizar
+    uint16_t interval;         //!< Segundos entre pedidos periódicos, 0 si no se envían
+    uint64_t next_request;     //!< Instante del reloj en que se envía el próximo pedido periódico
+    uint64_t pending;          //!< Instante t1 del último pedido
+    bool waiting;              //!< Indica si el último pedido todavía no tiene respuesta
+    uint64_t last_sample;      //!< Instante t4 de la muestra anterior, para medir el error de frecuencia
+    bool has_last;             //!< Indica si hay una muestra anterior desde el último salto
+    bool slewing;              //!< Indica si se está recuperando una diferencia
+    int32_t slew_ppm;          //!< Corrección transitoria que se suma a la base mientras se recupera la diferencia
+    uint64_t slew_end;         //!< Instante del reloj en que se termina de recuperar la diferencia
+    timesync_defer_t defer;    //!< Traslada las correcciones a la tarea que ajusta el reloj, NULL si no hace falta
+    bool apply;                //!< Indica que hay correcciones que esperan a TimeSyncApply
+    bool stepping;             //!< Indica que la corrección que espera es un salto
+    int64_t step_ms;           //!< Diferencia que se suma al reloj en el salto que espera
+    bool step_result;          //!< Resultado del último salto ejecutado por TimeSyncApply
+    timesync_status_t status;  //!< Contadores y última muestra
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Lee un número de 64 bits con el byte bajo primero.
+ *
+ * @param data      Bytes del número.
+ * @return          El número.
+ */
+static uint64_t TimeSyncGetStamp(const uint8_t * data);
+
+/**
+ * @brief           Aplica al reloj las correcciones calculadas, en esta tarea o en la que lo ajusta.
+ *
+ * @param self      El cliente.
+ */
+static void TimeSyncCommit(timesync_t self);
+
+/**
+ * @brief           Salta a la hora de la PC y descarta la historia de la frecuencia.
+ *
+ * @param self      El cliente.
+ * @param offset    Diferencia con la PC en milisegundos, positiva si el reloj atrasa.
+ * @param now       Instante t4 de la muestra.
+ * @return          true si se ajustó el reloj, false si el instante está fuera de rango.
+ */
+static bool TimeSyncStep(timesync_t self, int64_t offset, uint64_t now);
+
+/**
+ * @brief           Estima el error de frecuencia con la diferencia que queda y comienza a recuperarla de a poco.
+ *
+ * @param self      El cliente.
+ * @param offset    Diferencia con la PC en milisegundos, positiva si el reloj atrasa.
+ * @param now       Instante t4 de la muestra.
+ */
+static void TimeSyncSlew(timesync_t self, int64_t offset, uint64_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint64_t TimeSyncGetStamp(const uint8_t * data) {
+    uint64_t value = 0;
+    for (uint8_t index = 8; index > 0; index--) {
+        value = (value << 8) | data[index - 1];
+    }
+    return value;
+}
+
+static void TimeSyncCommit(timesync_t self) {
+    self->apply = true;
+    if (self->defer) {
+        self->defer();
+    } else {
+        TimeSyncApply(self);
+    }
+}
+
+static bool TimeSyncStep(timesync_t self, int64_t offset, uint64_t now) {
+    // La diferencia se suma en el instante en que se aplica, no importa cuánto espere a la otra tarea
+    self->stepping = true;
+    self->step_ms = offset;
+    TimeSyncCommit(self);
+    if (!self->step_result) {
+        return false;
+    }
+    self->has_last = false;
+    self->next_request = (uint64_t)((int64_t)now + offset) + (uint64_t)self->interval * 1000;
+    self->status.steps++;
+    return true;
+}
+
+static void TimeSyncSlew(timesync_t self, int64_t offset, uint64_t now) {
+    if (self->has_last && (now > self->last_sample)) {
+        // Lo que no se recupera de la diferencia anterior no es error de frecuencia
+        int64_t remaining = 0;
+        if (self->slewing && (self->slew_end > now)) {
+            remaining = (int64_t)(self->slew_end - now) * self->slew_ppm / TIMESYNC_PPM;
+        }
+        int64_t error = (offset - remaining) * TIMESYNC_PPM / (int64_t)(now - self->last_sample);
+        int64_t base = self->status.base_ppm + error / TIMESYNC_FREQUENCY_GAIN;
+
+        if (base > TIMESYNC_FREQUENCY_LIMIT_PPM) {
+            base = TIMESYNC_FREQUENCY_LIMIT_PPM;
+        } else if (base < -TIMESYNC_FREQUENCY_LIMIT_PPM) {
+            base = -TIMESYNC_FREQUENCY_LIMIT_PPM;
+        }
+        self->status.base_ppm = (int32_t)base;
+    }
+    self->has_last = true;
+    self->last_sample = now;
+
+    // A TIMESYNC_SLEW_PPM se recupera un milisegundo cada TIMESYNC_PPM / TIMESYNC_SLEW_PPM milisegundos
+    self->slewing = (offset != 0);
+    self->slew_ppm = (offset > 0) ? TIMESYNC_SLEW_PPM : -TIMESYNC_SLEW_PPM;
+    self->slew_end = now + (uint64_t)((offset > 0) ? offset : -offset) * TIMESYNC_PPM / TIMESYNC_SLEW_PPM;
+    TimeSyncCommit(self);
+}
+
+/* === Public function definitions ============================================================================== */
+
+timesync_t TimeSyncCreate(serial_t serial, clock_t clock, uint16_t interval) {
+    static struct timesync_s self[1];
+
+    memset(self, 0, sizeof(struct timesync_s));
+    self->serial = serial;
+    self->clock = clock;
+    self->interval = interval;
+    self->status.base_ppm = ClockGetTrim(clock);
+    return self;
+}
+
+void TimeSyncAttachDefer(timesync_t self, timesync_defer_t defer) {
+    self->defer = defer;
+}
+
+void TimeSyncApply(timesync_t self) {
+    if (!self->apply) {
+        return;
+    }
+    self->apply = false;
+    if (self->stepping) {
+        self->stepping = false;
+        self->step_result = ClockSetUtcMillis(self->clock, ClockGetUtcMillis(self->clock) + self->step_ms);
+        self->slewing = self->slewing && !self->step_result; // El salto descarta la diferencia que se recuperaba
+    }
+    ClockSetTrim(self->clock, self->status.base_ppm);
+    ClockSetSlew(self->clock, self->slewing ? self->slew_ppm : 0);
+}
+
+bool TimeSyncRequest(timesync_t self) {
+    uint64_t now = ClockGetUtcMillis(self->clock);
+    uint8_t payload[8];
+
+    for (uint8_t index = 0; index < sizeof(payload); index++) {
+        payload[index] = (uint8_t)(now >> (8 * index));
+    }
+    self->next_request = now + (uint64_t)self->interval * 1000;
+    self->pending = now;
+    self->waiting = true;
+    self->status.requests++;
+    return SerialSendFrame(self->serial, COMMAND_SYNC, payload, sizeof(payload));
+}
+
+bool TimeSyncReceive(timesync_t self, const serial_frame_t * reply) {
+    uint64_t t4 = ClockGetUtcMillis(self->clock);
+    uint64_t t1;
+    uint64_t t2;
+    uint64_t t3;
+    int64_t offset;
+    int64_t delay;
+    int64_t limit;
+
+    if (reply->length != TIMESYNC_REPLY_LENGTH) {
+        self->status.rejected++;
+        return false;
+    }
+    t1 = TimeSyncGetStamp(&reply->payload[0]);
+    t2 = TimeSyncGetStamp(&reply->payload[8]);
+    t3 = TimeSyncGetStamp(&reply->payload[16]);
+
+    // Una respuesta repetida o a un pedido anterior no corresponde a t4
+    if (!self->waiting || (t1 != self->pending)) {
+        self->status.rejected++;
+        return false;
+    }
+    self->waiting = false;
+
+    offset = ((int64_t)(t2 - t1) + (int64_t)(t3 - t4)) / 2;
+    delay = (int64_t)(t4 - t1) - (int64_t)(t3 - t2);
+    if (delay > TIMESYNC_MAX_DELAY_MS) {
+        self->status.rejected++;
+        return false;
+    }
+    self->status.samples++;
+    self->status.offset_ms = (offset > INT32_MAX) ? INT32_MAX : (offset < INT32_MIN) ? INT32_MIN : (int32_t)offset;
+    self->status.delay_ms = (delay > 0) ? (uint32_t)delay : 0;
+
+    // Con el calendario del RTC la corrección del oscilador no se aplica, sólo se puede saltar
+    limit = ClockHasCalendar(self->clock) ? TIMESYNC_CALENDAR_STEP_MS : TIMESYNC_STEP_MS;
+    if (!ClockGetTime(self->clock, &(clock_time_t){0}) || (offset > limit) || (offset < -limit)) {
+        return TimeSyncStep(self, offset, t4);
+    }
+    if (!ClockHasCalendar(self->clock)) {
+        TimeSyncSlew(self, offset, t4);
+    }
+    return true;
+}
+
+void TimeSyncPoll(timesync_t self) {
+    uint64_t now = ClockGetUtcMillis(self->clock);
+
+    if (self->slewing && (now >= self->slew_end)) {
+        self->slewing = false;
+        TimeSyncCommit(self);
+    }
+    if (self->interval && (now >= self->next_request)) {
+        TimeSyncRequest(self);
+    }
+}
+
+void TimeSyncGetStatus(timesync_t self, timesync_status_t * status) {
+    *status = self->status;
+}
+
+/* === End of documentation ======================================================================================== */
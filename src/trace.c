@@ -0,0 +1,161 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace.c
+ ** @brief Código fuente del buffer de trazas binarias
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include <stddef.h>
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#include "chip.h"
+#define TRACE_USE_EXCLUSIVE 1
+#else
+#define TRACE_USE_EXCLUSIVE 0
+#endif
+
+/* === Macros definitions ========================================================================================== */
+
+#if (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0
+#error "TRACE_BUFFER_SIZE debe ser potencia de dos"
+#endif
+
+#define TRACE_MASK (TRACE_BUFFER_SIZE - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+//! Buffer de trazas, el encabezado va primero para que un volcado de memoria se pueda decodificar en el host
+struct trace_s {
+    trace_header_t header;                    //!< Encabezado con los índices del buffer
+    trace_record_t records[TRACE_BUFFER_SIZE]; //!< Buffer circular de trazas
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Marca incompleto el siguiente lugar del buffer, lo reserva y toma el instante de la traza.
+ *
+ * @param timestamp Instante de la traza.
+ * @return          Índice absoluto del lugar reservado.
+ */
+static uint32_t TraceReserve(uint32_t * timestamp);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Único buffer de trazas, se puede volcar desde el depurador con: dump binary value trace.bin trace
+static struct trace_s trace;
+
+//! Fuente de tiempo de las trazas
+static trace_clock_t trace_now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+#if TRACE_USE_EXCLUSIVE
+
+/* El instante se toma dentro del acceso exclusivo: si una interrupción registra una traza entre la lectura y la
+ * escritura del índice, el acceso exclusivo se pierde y se reintenta, así las trazas quedan ordenadas por instante.
+ * El lugar se marca incompleto antes de reservarlo, así nunca se ve la traza vieja con un índice nuevo; si el intento
+ * falla la interrupción ya completó su traza en ese lugar, que no se vuelve a tocar. */
+static uint32_t TraceReserve(uint32_t * timestamp) {
+    uint32_t head;
+    do {
+        head = __LDREXW(&trace.header.head);
+        ((volatile trace_record_t *)&trace.records[head & TRACE_MASK])->event = TRACE_NONE;
+        *timestamp = trace_now ? trace_now() : 0;
+    } while (__STREXW(head + 1, &trace.header.head));
+    return head;
+}
+
+#else
+
+// En el host hay un único contexto de ejecución, por lo que no hace falta el acceso exclusivo
+static uint32_t TraceReserve(uint32_t * timestamp) {
+    uint32_t head = trace.header.head;
+    trace.records[head & TRACE_MASK].event = TRACE_NONE;
+    *timestamp = trace_now ? trace_now() : 0;
+    trace.header.head = head + 1;
+    return head;
+}
+
+#endif
+
+/* === Public function definitions ============================================================================== */
+
+void TraceInit(trace_clock_t now, uint16_t ticks_per_us) {
+    trace_now = NULL;
+    for (uint32_t index = 0; index < TRACE_BUFFER_SIZE; index++) {
+        trace.records[index].event = TRACE_NONE;
+    }
+    trace.header.ticks_per_us = ticks_per_us;
+    trace.header.size = TRACE_BUFFER_SIZE;
+    trace.header.head = 0;
+    trace.header.tail = 0;
+    trace.header.dropped = 0;
+    trace.header.magic = TRACE_MAGIC;
+    trace_now = now;
+}
+
+void TraceWrite(trace_event_t event, uint16_t arg) {
+    uint32_t timestamp;
+    uint32_t index = TraceReserve(&timestamp);
+
+    volatile trace_record_t * record = &trace.records[index & TRACE_MASK];
+    record->timestamp = timestamp;
+    record->arg = arg;
+    record->event = (uint16_t)event; // Se escribe al final para marcar la traza como completa
+}
+
+uint16_t TraceRead(trace_record_t * records, uint16_t size) {
+    uint16_t count = 0;
+    while (count < size) {
+        uint32_t tail = trace.header.tail;
+        if ((trace.header.head - tail) > TRACE_BUFFER_SIZE) {
+            // Los escritores dieron la vuelta: las trazas más antiguas ya se sobrescribieron
+            uint32_t overwritten = trace.header.head - tail - TRACE_BUFFER_SIZE;
+            trace.header.dropped += overwritten;
+            trace.header.tail = tail + overwritten;
+            continue;
+        }
+        volatile trace_record_t * record = &trace.records[tail & TRACE_MASK];
+        if ((tail == trace.header.head) || (record->event == TRACE_NONE)) {
+            break; // Buffer vacío, o el productor reservó el lugar pero todavía no terminó de escribirlo
+        }
+        records[count].timestamp = record->timestamp;
+        records[count].event = record->event;
+        records[count].arg = record->arg;
+        if ((trace.header.head - tail) > TRACE_BUFFER_SIZE) {
+            continue; // El lugar se sobrescribió durante la copia, se cuenta como perdido en la próxima vuelta
+        }
+        trace.header.tail = tail + 1;
+        count++;
+    }
+    return count;
+}
+
+uint32_t TraceDropped(void) {
+    uint32_t pending = trace.header.head - trace.header.tail;
+    return trace.header.dropped + ((pending > TRACE_BUFFER_SIZE) ? pending - TRACE_BUFFER_SIZE : 0);
+}
+
+/* === End of documentation ======================================================================================== */
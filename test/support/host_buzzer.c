@@ -0,0 +1,135 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file host_buzzer.c
+ ** @brief Código fuente del controlador del zumbador que registra la forma de onda en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "host_buzzer.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Registra un tono en el instante simulado actual.
+ *
+ * @param frequency Frecuencia del tono en Hz.
+ * @param volume    Volumen del tono.
+ */
+static void HostBuzzerTone(uint16_t frequency, uint8_t volume);
+
+/**
+ * @brief           Programa el vencimiento del temporizador de notas.
+ *
+ * @param duration  Milisegundos simulados hasta el vencimiento.
+ */
+static void HostBuzzerSchedule(uint16_t duration);
+
+/**
+ * @brief   Descarta el vencimiento pendiente del temporizador de notas.
+ */
+static void HostBuzzerCancel(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct buzzer_driver_s host_driver = {
+    .Tone = HostBuzzerTone,
+    .Schedule = HostBuzzerSchedule,
+    .Cancel = HostBuzzerCancel,
+};
+
+//! Generador de tonos que recibe los vencimientos del temporizador
+static buzzer_t buzzer;
+
+//! Tiempo simulado en milisegundos
+static uint32_t now;
+
+//! Instante del próximo vencimiento del temporizador
+static uint32_t deadline;
+
+//! Indica si el temporizador está programado
+static bool scheduled;
+
+//! Tonos registrados
+static host_buzzer_tone_t tones[HOST_BUZZER_MAX_TONES];
+
+//! Cantidad de tonos registrados
+static uint16_t count;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void HostBuzzerTone(uint16_t frequency, uint8_t volume) {
+    if (count < HOST_BUZZER_MAX_TONES) {
+        tones[count].start = now;
+        tones[count].frequency = frequency;
+        tones[count].volume = volume;
+        count++;
+    }
+}
+
+static void HostBuzzerSchedule(uint16_t duration) {
+    deadline = now + duration;
+    scheduled = true;
+}
+
+static void HostBuzzerCancel(void) {
+    scheduled = false;
+}
+
+/* === Public function definitions ============================================================================== */
+
+buzzer_t HostBuzzerCreate(void) {
+    now = 0;
+    count = 0;
+    scheduled = false;
+    buzzer = BuzzerCreate(&host_driver);
+    count = 0; // El silencio inicial de la creación no forma parte de la forma de onda
+    return buzzer;
+}
+
+void HostBuzzerAdvance(uint32_t milliseconds) {
+    uint32_t end = now + milliseconds;
+
+    while (scheduled && (deadline <= end)) {
+        now = deadline;
+        scheduled = false;
+        BuzzerStepElapsed(buzzer);
+    }
+    now = end;
+}
+
+uint16_t HostBuzzerTones(const host_buzzer_tone_t ** result) {
+    *result = tones;
+    return count;
+}
+
+bool HostBuzzerIsScheduled(void) {
+    return scheduled;
+}
+
+/* === End of documentation ======================================================================================== */
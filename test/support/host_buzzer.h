@@ -0,0 +1,94 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_BUZZER_H_
+#define HOST_BUZZER_H_
+
+/** @file host_buzzer.h
+ ** @brief Declaraciones del controlador del zumbador que registra la forma de onda en el host
+ **
+ ** Cada tono pedido por el generador se guarda con el instante en que comienza, medido en un tiempo simulado que
+ ** avanza la prueba. Al avanzar el tiempo se llama a BuzzerStepElapsed cada vez que vence el temporizador de notas,
+ ** como lo haría su interrupción, por lo que la prueba obtiene la secuencia completa de tonos y duraciones.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "buzzer.h"
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad máxima de tonos que se registran, los siguientes se descartan
+#define HOST_BUZZER_MAX_TONES 256
+
+/* === Public data type declarations ============================================================================== */
+
+//! Tono registrado, dura hasta el comienzo del siguiente
+typedef struct {
+    uint32_t start;     //!< Instante de comienzo en milisegundos simulados
+    uint16_t frequency; //!< Frecuencia en Hz, cero si es un silencio
+    uint8_t volume;     //!< Volumen, cero si es un silencio
+} host_buzzer_tone_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief   Crea el generador de tonos con el controlador del host, con el tiempo simulado y el registro en cero.
+ *
+ * @return  El generador de tonos.
+ */
+buzzer_t HostBuzzerCreate(void);
+
+/**
+ * @brief               Avanza el tiempo simulado, llamando a BuzzerStepElapsed en cada vencimiento del temporizador.
+ *
+ * @param milliseconds  Milisegundos a avanzar.
+ */
+void HostBuzzerAdvance(uint32_t milliseconds);
+
+/**
+ * @brief           Obtiene los tonos registrados desde la creación.
+ *
+ * @param tones     Puntero donde se devuelve el arreglo de tonos.
+ * @return          Cantidad de tonos registrados.
+ */
+uint16_t HostBuzzerTones(const host_buzzer_tone_t ** tones);
+
+/**
+ * @brief   Indica si el temporizador de notas está programado.
+ *
+ * @return  true si hay un vencimiento pendiente, false en caso contrario.
+ */
+bool HostBuzzerIsScheduled(void);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_BUZZER_H_ */
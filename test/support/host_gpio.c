@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file host_gpio.c
+ ** @brief Código fuente del GPIO del microcontrolador simulado en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "host_gpio.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Nivel de los pines de cada puerto
+static uint32_t levels[HOST_GPIO_PORTS];
+
+//! Dirección de los pines de cada puerto, uno para salida
+static uint32_t outputs[HOST_GPIO_PORTS];
+
+//! Escrituras en los registros de salida
+static uint32_t writes;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ============================================================================== */
+
+void HostGpioReset(void) {
+    memset(levels, 0, sizeof(levels));
+    memset(outputs, 0, sizeof(outputs));
+    writes = 0;
+}
+
+uint32_t HostGpioLevels(uint8_t port) {
+    return levels[port];
+}
+
+uint32_t HostGpioOutputs(uint8_t port) {
+    return outputs[port];
+}
+
+uint32_t HostGpioWrites(void) {
+    return writes;
+}
+
+void HostGpioClearWrites(void) {
+    writes = 0;
+}
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting) {
+    (void)gpio;
+    if (setting) {
+        levels[port] |= 1UL << pin;
+    } else {
+        levels[port] &= ~(1UL << pin);
+    }
+    writes++;
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output) {
+    (void)gpio;
+    if (output) {
+        outputs[port] |= 1UL << pin;
+    } else {
+        outputs[port] &= ~(1UL << pin);
+    }
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    (void)gpio;
+    levels[port] ^= 1UL << pin;
+    writes++;
+}
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits) {
+    (void)gpio;
+    levels[port] |= bits;
+    writes++;
+}
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits) {
+    (void)gpio;
+    levels[port] &= ~bits;
+    writes++;
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin) {
+    (void)gpio;
+    return (levels[port] >> pin) & 1;
+}
+
+/* === End of documentation ======================================================================================== */
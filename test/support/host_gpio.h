@@ -0,0 +1,155 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_GPIO_H_
+#define HOST_GPIO_H_
+
+/** @file host_gpio.h
+ ** @brief Declaraciones del GPIO del microcontrolador simulado en el host
+ **
+ ** Reemplaza en el host a las funciones del GPIO de la biblioteca del fabricante que usa digital.c, con los mismos
+ ** nombres y parámetros. Guarda el nivel y la dirección de cada pin y cuenta las escrituras en los registros de
+ ** salida, así las pruebas verifican las escrituras que se hacen y las que se evitan.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad de puertos GPIO simulados
+#define HOST_GPIO_PORTS 8
+
+//! Bloque de registros del GPIO, el simulado no usa la dirección
+#define LPC_GPIO_PORT ((LPC_GPIO_T *)0)
+
+/* === Public data type declarations ============================================================================== */
+
+//! Bloque de registros del GPIO, sólo se usa como puntero
+typedef struct lpc_gpio_s LPC_GPIO_T;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief   Pone en cero los niveles, las direcciones y el contador de escrituras de todos los puertos.
+ */
+void HostGpioReset(void);
+
+/**
+ * @brief       Obtiene los niveles de los pines de un puerto.
+ *
+ * @param port  Número de puerto.
+ * @return      Nivel de cada pin, el bit n corresponde al pin n.
+ */
+uint32_t HostGpioLevels(uint8_t port);
+
+/**
+ * @brief       Obtiene las direcciones de los pines de un puerto.
+ *
+ * @param port  Número de puerto.
+ * @return      Dirección de cada pin, el bit n en uno si el pin n es una salida.
+ */
+uint32_t HostGpioOutputs(uint8_t port);
+
+/**
+ * @brief   Obtiene la cantidad de escrituras en los registros de salida desde la última puesta en cero.
+ *
+ * @return  Cantidad de escrituras, una por llamada que cambia el nivel de uno o más pines.
+ */
+uint32_t HostGpioWrites(void);
+
+/**
+ * @brief   Pone en cero el contador de escrituras, sin cambiar los niveles.
+ */
+void HostGpioClearWrites(void);
+
+/**
+ * @brief         Escribe el nivel de un pin.
+ *
+ * @param gpio    Bloque de registros del GPIO.
+ * @param port    Número de puerto.
+ * @param pin     Número de pin.
+ * @param setting true para el nivel alto.
+ */
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting);
+
+/**
+ * @brief         Configura la dirección de un pin.
+ *
+ * @param gpio    Bloque de registros del GPIO.
+ * @param port    Número de puerto.
+ * @param pin     Número de pin.
+ * @param output  true para configurarlo como salida.
+ */
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output);
+
+/**
+ * @brief         Invierte el nivel de un pin.
+ *
+ * @param gpio    Bloque de registros del GPIO.
+ * @param port    Número de puerto.
+ * @param pin     Número de pin.
+ */
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+/**
+ * @brief         Pone en alto los pines de un puerto, con una escritura.
+ *
+ * @param gpio    Bloque de registros del GPIO.
+ * @param port    Número de puerto.
+ * @param bits    Pines a poner en alto, el bit n corresponde al pin n.
+ */
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits);
+
+/**
+ * @brief         Pone en bajo los pines de un puerto, con una escritura.
+ *
+ * @param gpio    Bloque de registros del GPIO.
+ * @param port    Número de puerto.
+ * @param bits    Pines a poner en bajo, el bit n corresponde al pin n.
+ */
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bits);
+
+/**
+ * @brief         Lee el nivel de un pin.
+ *
+ * @param gpio    Bloque de registros del GPIO.
+ * @param port    Número de puerto.
+ * @param pin     Número de pin.
+ * @return        true si el pin está en alto.
+ */
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_GPIO_H_ */
@@ -0,0 +1,110 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file host_screen.c
+ ** @brief Código fuente del controlador de la pantalla multiplexada que registra los dígitos encendidos en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "host_screen.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief   Apaga todos los dígitos, no se registra.
+ */
+static void HostDigitsTurnOff(void);
+
+/**
+ * @brief           Guarda los segmentos que se encienden con el próximo dígito.
+ *
+ * @param value     Segmentos a mostrar.
+ */
+static void HostSegmentsUpdate(uint8_t value);
+
+/**
+ * @brief           Acumula en el dígito los segmentos guardados, sin el punto.
+ *
+ * @param digit     Dígito encendido.
+ */
+static void HostDigitsTurnOn(uint8_t digit);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s host_driver = {
+    .DigitsTurnOff = HostDigitsTurnOff,
+    .SegmentsUpdate = HostSegmentsUpdate,
+    .DigitsTurnOn = HostDigitsTurnOn,
+};
+
+//! Segmentos pedidos para el próximo dígito
+static uint8_t segments;
+
+//! Segmentos encendidos en cada dígito desde la última vez que se borraron
+static uint8_t shown[HOST_SCREEN_DIGITS];
+
+//! Último dígito encendido
+static uint8_t last_digit;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void HostDigitsTurnOff(void) {
+}
+
+static void HostSegmentsUpdate(uint8_t value) {
+    segments = value;
+}
+
+static void HostDigitsTurnOn(uint8_t digit) {
+    if (digit < HOST_SCREEN_DIGITS) {
+        shown[digit] |= segments & ~SEGMENT_P;
+        last_digit = digit;
+    }
+}
+
+/* === Public function definitions ============================================================================== */
+
+screen_t HostScreenCreate(uint8_t digits) {
+    segments = 0;
+    last_digit = 0;
+    HostScreenClear();
+    return ScreenCreate(digits, &host_driver);
+}
+
+void HostScreenClear(void) {
+    memset(shown, 0, sizeof(shown));
+}
+
+const uint8_t * HostScreenShown(void) {
+    return shown;
+}
+
+uint8_t HostScreenLastDigit(void) {
+    return last_digit;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,85 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_SCREEN_H_
+#define HOST_SCREEN_H_
+
+/** @file host_screen.h
+ ** @brief Declaraciones del controlador de la pantalla multiplexada que registra los dígitos encendidos en el host
+ **
+ ** Reemplaza a los pines de la pantalla en las pruebas: guarda los segmentos pedidos y, cada vez que se enciende un
+ ** dígito, los acumula en ese dígito sin el punto. Las pruebas que no miran la pantalla sólo la crean.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "screen.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad máxima de dígitos que se registran
+#define HOST_SCREEN_DIGITS 8
+
+/* === Public data type declarations ============================================================================== */
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Crea una pantalla con el controlador del host y borra los dígitos registrados.
+ *
+ * @param digits    Cantidad de dígitos de la pantalla, hasta HOST_SCREEN_DIGITS.
+ * @return          La pantalla creada.
+ */
+screen_t HostScreenCreate(uint8_t digits);
+
+/**
+ * @brief   Borra los segmentos registrados en todos los dígitos.
+ */
+void HostScreenClear(void);
+
+/**
+ * @brief   Obtiene los segmentos encendidos en cada dígito desde la última vez que se borraron, sin el punto.
+ *
+ * @return  Arreglo de HOST_SCREEN_DIGITS elementos, el elemento n corresponde al dígito n.
+ */
+const uint8_t * HostScreenShown(void);
+
+/**
+ * @brief   Obtiene el último dígito encendido.
+ *
+ * @return  Número del dígito.
+ */
+uint8_t HostScreenLastDigit(void);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SCREEN_H_ */
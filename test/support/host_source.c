@@ -0,0 +1,181 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file host_source.c
+ ** @brief Código fuente de la fuente de tiempo del reloj basada en el reloj monotónico del host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 199309L
+
+// time.h declara su propio clock_t, se renombra para que no choque con el del reloj
+#define clock_t host_clock_t
+#include <time.h>
+#undef clock_t
+
+#include "host_source.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief   Lee el reloj monotónico del host.
+ *
+ * @return  Milisegundos transcurridos desde la primera lectura.
+ */
+static uint32_t HostMonotonicTicks(void);
+
+/**
+ * @brief   Contador libre de la fuente simulada.
+ *
+ * @return  Ticks simulados.
+ */
+static uint32_t HostFakeTicks(void);
+
+/**
+ * @brief           Lectura del calendario de la fuente simulada.
+ *
+ * @param seconds   Segundos del calendario simulado.
+ * @return          true si el calendario simulado tiene hora válida.
+ */
+static bool HostFakeReadSeconds(uint32_t * seconds);
+
+/**
+ * @brief           Escritura del calendario de la fuente simulada, el segundo escrito comienza en ese momento.
+ *
+ * @param seconds   Segundos a escribir.
+ */
+static void HostFakeWriteSeconds(uint32_t seconds);
+
+/**
+ * @brief   Entrada a la sección crítica de la fuente simulada, cuenta las secciones abiertas.
+ */
+static void HostFakeEnterCritical(void);
+
+/**
+ * @brief   Salida de la sección crítica de la fuente simulada.
+ */
+static void HostFakeExitCritical(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Fuente de tiempo del host, sin calendario
+static const struct clock_source_s host_monotonic = {
+    .GetTicks = HostMonotonicTicks,
+    .ReadSeconds = NULL,
+    .WriteSeconds = NULL,
+};
+
+//! Fuente simulada con calendario
+static const struct clock_source_s host_fake_calendar = {
+    .GetTicks = HostFakeTicks,
+    .ReadSeconds = HostFakeReadSeconds,
+    .WriteSeconds = HostFakeWriteSeconds,
+    .EnterCritical = HostFakeEnterCritical,
+    .ExitCritical = HostFakeExitCritical,
+};
+
+//! Fuente simulada sin calendario
+static const struct clock_source_s host_fake_counter = {
+    .GetTicks = HostFakeTicks,
+    .ReadSeconds = NULL,
+    .WriteSeconds = NULL,
+    .EnterCritical = HostFakeEnterCritical,
+    .ExitCritical = HostFakeExitCritical,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+host_fake_source_t host_fake;
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t HostMonotonicTicks(void) {
+    static struct timespec start;
+    static int started = 0;
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (!started) {
+        start = now;
+        started = 1;
+    }
+    return (uint32_t)((now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000);
+}
+
+static uint32_t HostFakeTicks(void) {
+    return host_fake.ticks;
+}
+
+static bool HostFakeReadSeconds(uint32_t * seconds) {
+    *seconds = host_fake.seconds;
+    if (host_fake.ticks_per_second) {
+        *seconds += (host_fake.ticks - host_fake.edge) / host_fake.ticks_per_second;
+    }
+    return host_fake.valid;
+}
+
+static void HostFakeWriteSeconds(uint32_t seconds) {
+    host_fake.seconds = seconds;
+    host_fake.edge = host_fake.ticks;
+    host_fake.valid = true;
+}
+
+static void HostFakeEnterCritical(void) {
+    host_fake.critical++;
+    host_fake.critical_entries++;
+}
+
+static void HostFakeExitCritical(void) {
+    host_fake.critical--;
+}
+
+/* === Public function definitions ============================================================================== */
+
+clock_source_t HostSourceMonotonic(void) {
+    return &host_monotonic;
+}
+
+void HostSourceFakeReset(uint16_t ticks_per_second) {
+    memset(&host_fake, 0, sizeof(host_fake));
+    host_fake.ticks_per_second = ticks_per_second;
+}
+
+clock_source_t HostSourceFakeCalendar(void) {
+    return &host_fake_calendar;
+}
+
+clock_source_t HostSourceFakeCounter(void) {
+    return &host_fake_counter;
+}
+
+void HostSourceSleep(uint32_t ms) {
+    struct timespec delay = {.tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L};
+
+    while (nanosleep(&delay, &delay) != 0) {
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,110 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_SOURCE_H_
+#define HOST_SOURCE_H_
+
+/** @file host_source.h
+ ** @brief Declaraciones de la fuente de tiempo del reloj basada en el reloj monotónico del host
+ **
+ ** Permite ejecutar el reloj en Linux con tiempo real: el contador libre son los milisegundos de CLOCK_MONOTONIC
+ ** desde la primera lectura, por lo que el reloj debe crearse con 1000 ticks por segundo.
+ **
+ ** También ofrece una fuente simulada, con y sin calendario, cuyo contador y calendario avanzan las pruebas.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "clock.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Ticks por segundo del contador de la fuente del host
+#define HOST_SOURCE_TICKS_PER_SECOND 1000
+
+/* === Public data type declarations ============================================================================== */
+
+//! Estado de la fuente de tiempo simulada, lo modifican y lo consultan las pruebas
+typedef struct {
+    uint32_t ticks;            //!< Contador libre
+    uint32_t seconds;          //!< Segundos del calendario desde la época al comenzar el segundo en curso
+    uint32_t edge;             //!< Valor del contador al comenzar el segundo en curso del calendario
+    uint16_t ticks_per_second; //!< Ticks por segundo con que avanza el calendario, 0 si sólo cambia al escribirlo
+    bool valid;                //!< Indica si el calendario tiene hora válida
+    uint8_t critical;          //!< Secciones críticas abiertas, 0 fuera de ellas
+    uint32_t critical_entries; //!< Veces que el reloj entró a la sección crítica
+} host_fake_source_t;
+
+/* === Public variable declarations =============================================================================== */
+
+//! Estado de la fuente de tiempo simulada
+extern host_fake_source_t host_fake;
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief   Obtiene la fuente de tiempo basada en el reloj monotónico del host, sin calendario.
+ *
+ * @return  La fuente de tiempo.
+ */
+clock_source_t HostSourceMonotonic(void);
+
+/**
+ * @brief                   Borra el estado de la fuente simulada, con el calendario sin hora válida.
+ *
+ * @param ticks_per_second  Ticks por segundo con que avanza el calendario, 0 para que sólo cambie al escribirlo.
+ */
+void HostSourceFakeReset(uint16_t ticks_per_second);
+
+/**
+ * @brief   Obtiene la fuente simulada con calendario, como el RTC; al escribirlo el segundo comienza en ese momento.
+ *
+ * @return  La fuente de tiempo.
+ */
+clock_source_t HostSourceFakeCalendar(void);
+
+/**
+ * @brief   Obtiene la fuente simulada sin calendario, como el contador de ticks del sistema.
+ *
+ * @return  La fuente de tiempo.
+ */
+clock_source_t HostSourceFakeCounter(void);
+
+/**
+ * @brief       Espera una cantidad de milisegundos reales.
+ *
+ * @param ms    Milisegundos a esperar.
+ */
+void HostSourceSleep(uint32_t ms);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SOURCE_H_ */
@@ -0,0 +1,194 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file host_storage.c
+ ** @brief Código fuente de la memoria no volátil del almacenamiento persistente basada en un archivo del host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "host_storage.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Valor de un byte borrado
+#define HOST_STORAGE_ERASED 0xFF
+
+//! Valor que indica que no hay un corte de alimentación pendiente
+#define HOST_STORAGE_NO_FAIL 0xFFFFFFFFUL
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Lee de la memoria emulada.
+ *
+ * @param address   Dirección desde el comienzo del archivo.
+ * @param data      Buffer donde se copian los datos leídos.
+ * @param size      Cantidad de bytes a leer.
+ * @return          true si se pudo leer, false en caso contrario.
+ */
+static bool HostStorageRead(uint32_t address, void * data, uint16_t size);
+
+/**
+ * @brief           Escribe en la memoria emulada bajando bits a cero, como una memoria flash.
+ *
+ * @param address   Dirección desde el comienzo del archivo.
+ * @param data      Datos a escribir.
+ * @param size      Cantidad de bytes a escribir.
+ * @return          true si los datos quedaron escritos, false si la zona no estaba borrada o hubo un corte.
+ */
+static bool HostStorageWrite(uint32_t address, const void * data, uint16_t size);
+
+/**
+ * @brief           Borra un sector de la memoria emulada.
+ *
+ * @param sector    Número de sector.
+ * @return          true si se pudo borrar, false en caso contrario.
+ */
+static bool HostStorageErase(uint8_t sector);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Controlador de la memoria emulada, la geometría se completa al abrir el archivo
+static struct persist_storage_s host_storage = {
+    .Read = HostStorageRead,
+    .Write = HostStorageWrite,
+    .Erase = HostStorageErase,
+};
+
+//! Archivo con el contenido de la memoria emulada
+static FILE * host_file;
+
+//! Cantidad de borrados de cada sector
+static uint32_t host_erases[HOST_STORAGE_MAX_SECTORS];
+
+//! Cantidad de lecturas
+static uint32_t host_reads;
+
+//! Bytes que se escriben antes del corte de alimentación simulado, HOST_STORAGE_NO_FAIL si no hay un corte pendiente
+static uint32_t host_fail_after;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool HostStorageRead(uint32_t address, void * data, uint16_t size) {
+    host_reads++;
+    if (!host_file || (fseek(host_file, (long)address, SEEK_SET) != 0)) {
+        return false;
+    }
+    return fread(data, 1, size, host_file) == size;
+}
+
+static bool HostStorageWrite(uint32_t address, const void * data, uint16_t size) {
+    const uint8_t * bytes = data;
+    bool result = true;
+
+    if (!host_file) {
+        return false;
+    }
+    for (uint16_t index = 0; index < size; index++) {
+        if (index >= host_fail_after) {
+            host_fail_after = HOST_STORAGE_NO_FAIL;
+            return false;
+        }
+        fseek(host_file, (long)(address + index), SEEK_SET);
+        int old = fgetc(host_file);
+        if (old == EOF) {
+            return false;
+        }
+        fseek(host_file, (long)(address + index), SEEK_SET);
+        fputc(old & bytes[index], host_file);
+        result = result && ((old & bytes[index]) == bytes[index]);
+    }
+    fflush(host_file);
+    host_fail_after = HOST_STORAGE_NO_FAIL;
+    return result;
+}
+
+static bool HostStorageErase(uint8_t sector) {
+    if (!host_file || (sector >= host_storage.sectors) ||
+        (fseek(host_file, (long)sector * host_storage.sector_size, SEEK_SET) != 0)) {
+        return false;
+    }
+    for (uint16_t index = 0; index < host_storage.sector_size; index++) {
+        fputc(HOST_STORAGE_ERASED, host_file);
+    }
+    fflush(host_file);
+    host_erases[sector]++;
+    return true;
+}
+
+/* === Public function definitions ============================================================================== */
+
+persist_storage_t HostStorageOpen(const char * path, uint16_t sector_size, uint8_t sectors) {
+    HostStorageClose();
+    if (sectors > HOST_STORAGE_MAX_SECTORS) {
+        return NULL;
+    }
+    host_file = fopen(path, "r+b");
+    if (!host_file) {
+        host_file = fopen(path, "w+b");
+    }
+    if (!host_file) {
+        return NULL;
+    }
+
+    // Un archivo nuevo o más corto se completa con bytes borrados
+    uint32_t size = (uint32_t)sector_size * sectors;
+    fseek(host_file, 0, SEEK_END);
+    for (long length = ftell(host_file); length < (long)size; length++) {
+        fputc(HOST_STORAGE_ERASED, host_file);
+    }
+    fflush(host_file);
+
+    host_storage.sector_size = sector_size;
+    host_storage.sectors = sectors;
+    memset(host_erases, 0, sizeof(host_erases));
+    host_reads = 0;
+    host_fail_after = HOST_STORAGE_NO_FAIL;
+    return &host_storage;
+}
+
+void HostStorageClose(void) {
+    if (host_file) {
+        fclose(host_file);
+        host_file = NULL;
+    }
+}
+
+uint32_t HostStorageErases(uint8_t sector) {
+    return (sector < HOST_STORAGE_MAX_SECTORS) ? host_erases[sector] : 0;
+}
+
+uint32_t HostStorageReads(void) {
+    return host_reads;
+}
+
+void HostStoragePowerFail(uint16_t bytes) {
+    host_fail_after = bytes;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,95 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_STORAGE_H_
+#define HOST_STORAGE_H_
+
+/** @file host_storage.h
+ ** @brief Declaraciones de la memoria no volátil del almacenamiento persistente basada en un archivo del host
+ **
+ ** Emula una memoria flash dentro de un archivo: borrar un sector deja sus bytes en 0xFF y escribir sólo puede
+ ** bajar bits a cero, por lo que escribir sobre una zona no borrada falla igual que en el hardware. Cuenta los
+ ** borrados de cada sector y las lecturas, y permite simular un corte de alimentación durante una escritura.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "persist.h"
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Cantidad máxima de sectores de la memoria emulada
+#define HOST_STORAGE_MAX_SECTORS 16
+
+/* === Public data type declarations ============================================================================== */
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief               Abre el archivo de la memoria emulada, creándolo borrado si no existe, y reinicia los contadores.
+ *
+ * @param path          Ruta del archivo.
+ * @param sector_size   Tamaño de cada sector en bytes.
+ * @param sectors       Cantidad de sectores, hasta HOST_STORAGE_MAX_SECTORS.
+ * @return              El controlador de la memoria, NULL si no se pudo abrir el archivo.
+ */
+persist_storage_t HostStorageOpen(const char * path, uint16_t sector_size, uint8_t sectors);
+
+/**
+ * @brief   Cierra el archivo de la memoria emulada, su contenido se conserva para la próxima apertura.
+ */
+void HostStorageClose(void);
+
+/**
+ * @brief           Obtiene la cantidad de veces que se borró un sector desde la apertura.
+ *
+ * @param sector    Número de sector.
+ * @return          Cantidad de borrados.
+ */
+uint32_t HostStorageErases(uint8_t sector);
+
+/**
+ * @brief   Obtiene la cantidad de lecturas realizadas desde la apertura.
+ *
+ * @return  Cantidad de lecturas.
+ */
+uint32_t HostStorageReads(void);
+
+/**
+ * @brief       Simula un corte de alimentación en la próxima escritura, que queda incompleta y falla.
+ *
+ * @param bytes Cantidad de bytes que se llegan a escribir antes del corte.
+ */
+void HostStoragePowerFail(uint16_t bytes);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STORAGE_H_ */
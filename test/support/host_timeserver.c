@@ -0,0 +1,147 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file host_timeserver.c
+ ** @brief Código fuente del servidor de hora que reemplaza a la PC en las pruebas de la sincronización
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _DEFAULT_SOURCE
+
+// sys/types.h, que incluyen estos y stdlib.h, declara su propio clock_t: se renombra para que no choque con el del reloj
+#define clock_t host_clock_t
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#undef clock_t
+
+#include "host_timeserver.h"
+#include "host_uart.h"
+#include "command.h"
+#include "serial.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Milisegundos que el servidor espera cada byte antes de revisar si tiene que terminar
+#define HOST_TIMESERVER_WAIT_MS 20
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief           Agrega un instante de 64 bits a los datos de la respuesta, con el byte bajo primero.
+ *
+ * @param payload   Datos de la respuesta.
+ * @param stamp     Instante a agregar.
+ */
+static void HostTimeServerPutStamp(uint8_t * payload, uint64_t stamp);
+
+/**
+ * @brief   Atiende los pedidos hasta que la prueba pide terminar, se ejecuta en el proceso del servidor.
+ */
+static void HostTimeServerRun(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado compartido con el proceso del servidor
+static host_time_t * shared;
+
+//! Proceso del servidor
+static pid_t server = -1;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void HostTimeServerPutStamp(uint8_t * payload, uint64_t stamp) {
+    for (uint8_t index = 0; index < 8; index++) {
+        payload[index] = (uint8_t)(stamp >> (8 * index));
+    }
+}
+
+static void HostTimeServerRun(void) {
+    // El proceso tiene su propia copia del enlace, la del reloj queda en el proceso de la prueba
+    serial_t serial = SerialCreate(HostUartPeerWrite);
+    serial_frame_t frame;
+    uint8_t payload[24];
+    uint8_t data;
+
+    while (!shared->stop) {
+        if (HostUartPeerRead(&data, 1, HOST_TIMESERVER_WAIT_MS) == 1) {
+            SerialReceive(serial, &data, 1);
+        }
+        while (SerialReadFrame(serial, &frame)) {
+            if ((frame.command != COMMAND_SYNC) || (frame.length != 8)) {
+                continue;
+            }
+            uint64_t received = shared->now_ms + shared->uplink_ms;
+            memcpy(payload, frame.payload, 8);
+            HostTimeServerPutStamp(&payload[8], received);
+            HostTimeServerPutStamp(&payload[16], received + shared->turnaround_ms);
+            shared->served++; // Antes de responder, así la prueba lo ve actualizado al recibir la respuesta
+            SerialSendFrame(serial, COMMAND_SYNC | COMMAND_REPLY, payload, sizeof(payload));
+        }
+    }
+}
+
+/* === Public function definitions ============================================================================== */
+
+host_time_t * HostTimeServerStart(uint64_t now_ms) {
+    HostTimeServerStop();
+    shared = mmap(NULL, sizeof(host_time_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        shared = NULL;
+        return NULL;
+    }
+    shared->now_ms = now_ms;
+    shared->uplink_ms = 0;
+    shared->turnaround_ms = 0;
+    shared->served = 0;
+    shared->stop = false;
+
+    server = fork();
+    if (server == 0) {
+        HostTimeServerRun();
+        _exit(0);
+    } else if (server < 0) {
+        HostTimeServerStop();
+        return NULL;
+    }
+    return shared;
+}
+
+void HostTimeServerStop(void) {
+    if (server > 0) {
+        shared->stop = true;
+        waitpid(server, NULL, 0);
+    }
+    server = -1;
+    if (shared) {
+        munmap(shared, sizeof(host_time_t));
+    }
+    shared = NULL;
+}
+
+/* === End of documentation ======================================================================================== */
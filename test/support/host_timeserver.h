@@ -0,0 +1,78 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_TIMESERVER_H_
+#define HOST_TIMESERVER_H_
+
+/** @file host_timeserver.h
+ ** @brief Declaraciones del servidor de hora que reemplaza a la PC en las pruebas de la sincronización
+ **
+ ** El servidor corre en un proceso aparte, conectado al lado de la PC de la pseudoterminal de host_uart.h, y responde
+ ** los pedidos COMMAND_SYNC como lo haría la PC. Su hora no es la del host sino la que fija la prueba en la memoria
+ ** compartida, junto con las demoras del enlace, así las pruebas son deterministas y no dependen del tiempo real.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+/* === Public data type declarations ============================================================================== */
+
+//! Estado compartido con el proceso del servidor
+typedef struct {
+    volatile uint64_t now_ms;        //!< Hora de la PC en milisegundos UTC, la avanza la prueba
+    volatile uint32_t uplink_ms;     //!< Demora del pedido hasta la PC, se suma a la hora para marcar la recepción
+    volatile uint32_t turnaround_ms; //!< Demora de la PC en responder, se suma para marcar la transmisión
+    volatile uint32_t served;        //!< Cantidad de pedidos respondidos
+    volatile bool stop;              //!< Pide al proceso que termine
+} host_time_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief           Inicia el proceso del servidor sobre la pseudoterminal abierta con HostUartOpen.
+ *
+ * @param now_ms    Hora inicial de la PC en milisegundos UTC.
+ * @return          Estado compartido con el servidor, NULL si no se pudo iniciar.
+ */
+host_time_t * HostTimeServerStart(uint64_t now_ms);
+
+/**
+ * @brief   Detiene el proceso del servidor y libera el estado compartido.
+ */
+void HostTimeServerStop(void);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_TIMESERVER_H_ */
@@ -0,0 +1,151 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file host_uart.c
+ ** @brief Código fuente de la UART del enlace serie basada en una pseudoterminal del host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include "host_uart.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Bytes que se leen por vez del lado maestro, como la FIFO de la UART
+#define HOST_UART_CHUNK 16
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Lado maestro, la UART del reloj
+static int master = -1;
+
+//! Lado esclavo, el puerto de la PC
+static int peer = -1;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ============================================================================== */
+
+bool HostUartOpen(void) {
+    struct termios settings;
+
+    HostUartClose();
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0)) {
+        HostUartClose();
+        return false;
+    }
+    peer = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if ((peer < 0) || (tcgetattr(peer, &settings) != 0)) {
+        HostUartClose();
+        return false;
+    }
+
+    // Sin eco ni conversión de finales de línea, los bytes pasan tal cual como por una UART
+    cfmakeraw(&settings);
+    tcsetattr(peer, TCSANOW, &settings);
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+void HostUartClose(void) {
+    if (peer >= 0) {
+        close(peer);
+    }
+    if (master >= 0) {
+        close(master);
+    }
+    peer = -1;
+    master = -1;
+}
+
+const char * HostUartPath(void) {
+    return (master >= 0) ? ptsname(master) : NULL;
+}
+
+void HostUartWrite(const uint8_t * data, uint16_t size) {
+    while (size) {
+        ssize_t written = write(master, data, size);
+        if (written <= 0) {
+            return;
+        }
+        data += written;
+        size -= (uint16_t)written;
+    }
+}
+
+uint16_t HostUartPoll(serial_t serial, uint16_t ms) {
+    struct pollfd waiting = {.fd = master, .events = POLLIN};
+    uint8_t data[HOST_UART_CHUNK];
+    uint16_t total = 0;
+    ssize_t size;
+
+    if (poll(&waiting, 1, ms) <= 0) {
+        return 0;
+    }
+    while ((size = read(master, data, sizeof(data))) > 0) {
+        SerialReceive(serial, data, (uint16_t)size);
+        total += (uint16_t)size;
+    }
+    return total;
+}
+
+void HostUartPeerWrite(const uint8_t * data, uint16_t size) {
+    while (size) {
+        ssize_t written = write(peer, data, size);
+        if (written <= 0) {
+            return;
+        }
+        data += written;
+        size -= (uint16_t)written;
+    }
+    tcdrain(peer);
+}
+
+uint16_t HostUartPeerRead(uint8_t * data, uint16_t size, uint16_t ms) {
+    struct pollfd waiting = {.fd = peer, .events = POLLIN};
+    uint16_t total = 0;
+
+    while ((total < size) && (poll(&waiting, 1, ms) > 0)) {
+        ssize_t received = read(peer, data + total, size - total);
+        if (received <= 0) {
+            break;
+        }
+        total += (uint16_t)received;
+    }
+    return total;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,111 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HOST_UART_H_
+#define HOST_UART_H_
+
+/** @file host_uart.h
+ ** @brief Declaraciones de la UART del enlace serie basada en una pseudoterminal del host
+ **
+ ** Reemplaza a la UART de la placa en el host: el lado maestro de la pseudoterminal hace de UART del reloj y el lado
+ ** esclavo es el puerto de la PC, al que se conectan las pruebas o cualquier programa que abra su ruta (por ejemplo
+ ** tools/clockctl.c). HostUartPoll cumple el papel de la interrupción de recepción.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "serial.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+/* === Public data type declarations ============================================================================== */
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief   Crea la pseudoterminal y abre su lado esclavo en modo crudo, como lo abriría la PC.
+ *
+ * @return  true si se creó la pseudoterminal, false en caso contrario.
+ */
+bool HostUartOpen(void);
+
+/**
+ * @brief   Cierra los dos lados de la pseudoterminal.
+ */
+void HostUartClose(void);
+
+/**
+ * @brief   Obtiene la ruta del lado esclavo, para conectar otro programa.
+ *
+ * @return  Ruta del dispositivo, NULL si la pseudoterminal no está abierta.
+ */
+const char * HostUartPath(void);
+
+/**
+ * @brief       Transmite bytes desde el reloj hacia la PC, tiene la forma de serial_write_t.
+ *
+ * @param data  Bytes a transmitir.
+ * @param size  Cantidad de bytes.
+ */
+void HostUartWrite(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief           Entrega al enlace serie los bytes que la PC envió, como la interrupción de recepción.
+ *
+ * @param serial    Enlace que recibe los bytes.
+ * @param ms        Tiempo límite en milisegundos para esperar el primer byte, 0 para no esperar.
+ * @return          Cantidad de bytes entregados.
+ */
+uint16_t HostUartPoll(serial_t serial, uint16_t ms);
+
+/**
+ * @brief       Envía bytes desde el lado de la PC.
+ *
+ * @param data  Bytes a enviar.
+ * @param size  Cantidad de bytes.
+ */
+void HostUartPeerWrite(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief       Recibe del lado de la PC los bytes que transmitió el reloj, esperando hasta un tiempo límite.
+ *
+ * @param data  Buffer donde se copian los bytes.
+ * @param size  Cantidad de bytes a recibir.
+ * @param ms    Tiempo límite en milisegundos para recibir todos los bytes.
+ * @return      Cantidad de bytes recibidos.
+ */
+uint16_t HostUartPeerRead(uint8_t * data, uint16_t size, uint16_t ms);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_UART_H_ */
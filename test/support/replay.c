@@ -0,0 +1,195 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file replay.c
+ ** @brief Código fuente del reproductor en el host de las trazas del registrador de eventos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "replay.h"
+#include "config.h"
+#include "app.h"
+#include "clock.h"
+#include "screen.h"
+#include "host_screen.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de una reproducción en curso
+struct replay_s {
+    const record_event_t * trace; //!< Traza grabada
+    uint16_t count;               //!< Cantidad de eventos de la traza
+    uint16_t expected;            //!< Índice del próximo cambio grabado a comparar
+    uint32_t last_poll;           //!< Instante de la última verificación de la alarma
+    clock_t clock;                //!< Reloj reproducido
+    app_t app;                    //!< Aplicación reproducida
+    recorder_t recorder;          //!< Registrador de los cambios reproducidos
+    replay_result_t * result;     //!< Resultado de la reproducción
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el instante simulado de la reproducción.
+ * @return Ticks simulados desde el arranque.
+ */
+static uint32_t ReplayNow(void);
+
+/**
+ * @brief      Indica si un evento es un cambio producido por la lógica (modo o salida).
+ * @param kind Tipo del evento.
+ * @return     true si es un cambio de modo o de salida.
+ */
+static bool IsOutput(uint8_t kind);
+
+/**
+ * @brief      Compara los cambios reproducidos desde la última llamada con los grabados.
+ * @param self Reproducción en curso.
+ */
+static void Compare(struct replay_s * self);
+
+/**
+ * @brief       Avanza el reloj simulado tick a tick hasta un instante, verificando la alarma como MainTask.
+ * @param self  Reproducción en curso.
+ * @param until Instante hasta el cual avanzar.
+ */
+static void Advance(struct replay_s * self, uint32_t until);
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t replay_now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t ReplayNow(void) {
+    return replay_now;
+}
+
+static bool IsOutput(uint8_t kind) {
+    return (kind == RECORD_MODE) || (kind == RECORD_OUTPUT);
+}
+
+static void Compare(struct replay_s * self) {
+    record_event_t produced;
+
+    while (RecorderRead(self->recorder, &produced, 1)) {
+        if (!IsOutput(produced.kind)) {
+            continue;
+        }
+        while ((self->expected < self->count) && !IsOutput(self->trace[self->expected].kind)) {
+            self->expected++;
+        }
+
+        replay_result_t * result = self->result;
+        if (self->expected >= self->count) {
+            // La reproducción produjo un cambio que no estaba grabado
+            if (result->mismatches++ == 0) {
+                result->first_mismatch = self->count;
+            }
+            continue;
+        }
+
+        const record_event_t * recorded = &self->trace[self->expected];
+        if ((recorded->kind != produced.kind) || (recorded->id != produced.id) || (recorded->value != produced.value)) {
+            if (result->mismatches++ == 0) {
+                result->first_mismatch = self->expected;
+            }
+        } else {
+            uint32_t skew = (produced.timestamp > recorded->timestamp) ? produced.timestamp - recorded->timestamp
+                                                                       : recorded->timestamp - produced.timestamp;
+            if (skew > result->max_skew) {
+                result->max_skew = skew;
+            }
+        }
+        result->outputs++;
+        self->expected++;
+    }
+}
+
+static void Advance(struct replay_s * self, uint32_t until) {
+    while (replay_now < until) {
+        replay_now++;
+        ClockNewTick(self->clock);
+        if ((replay_now - self->last_poll) >= REPLAY_POLL_PERIOD) {
+            self->last_poll = replay_now;
+            AppPoll(self->app);
+            Compare(self);
+        }
+    }
+}
+
+/* === Public function definitions ============================================================================== */
+
+bool ReplayRun(const record_event_t * trace, uint16_t count, replay_result_t * result) {
+    static struct board_s board;
+    struct replay_s self = {
+        .trace = trace,
+        .count = count,
+        .result = result,
+    };
+
+    memset(result, 0, sizeof(replay_result_t));
+    result->first_mismatch = count;
+    if (board.screen == NULL) {
+        board.screen = HostScreenCreate(4);
+    }
+
+    replay_now = 0;
+    self.clock = ClockCreate(TICKS_PER_SECOND);
+    self.app = AppCreate(self.clock, &board);
+    self.recorder = RecorderCreate(ReplayNow);
+    AppAttachRecorder(self.app, self.recorder);
+
+    for (uint16_t index = 0; index < count; index++) {
+        if (trace[index].kind == RECORD_MESSAGE) {
+            Advance(&self, trace[index].timestamp);
+            AppDispatchSteps(self.app, (message_type_t)trace[index].id, trace[index].value);
+            self.last_poll = replay_now;
+            AppPoll(self.app);
+            Compare(&self);
+            result->messages++;
+        }
+    }
+    if (count) {
+        Advance(&self, trace[count - 1].timestamp);
+        result->duration = trace[count - 1].timestamp - trace[0].timestamp;
+    }
+    Compare(&self);
+
+    // Los cambios grabados que no se reprodujeron también son diferencias
+    for (; self.expected < count; self.expected++) {
+        if (IsOutput(trace[self.expected].kind)) {
+            if (result->mismatches++ == 0) {
+                result->first_mismatch = self.expected;
+            }
+        }
+    }
+
+    AppAttachRecorder(self.app, NULL);
+    return result->mismatches == 0;
+}
+
+/* === End of documentation ======================================================================================== */
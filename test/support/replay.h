@@ -0,0 +1,81 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+/** @file replay.h
+ ** @brief Declaraciones del reproductor en el host de las trazas del registrador de eventos
+ **
+ ** El reproductor crea un reloj y una aplicación nuevos, avanza el reloj tick a tick hasta el instante de cada
+ ** mensaje grabado y lo despacha, imitando a MainTask (que verifica la alarma después de cada mensaje y como máximo
+ ** cada REPLAY_POLL_PERIOD ticks). Los cambios de modo y de salidas que produce se comparan, en orden, con los de la
+ ** traza grabada. La traza debe comenzar en el arranque, es decir que el registrador no debe haber descartado eventos.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "record.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+//! Período máximo, en ticks, entre dos verificaciones de la alarma (tiempo de espera de la cola de MainTask)
+#define REPLAY_POLL_PERIOD 50
+
+/* === Public data type declarations ============================================================================== */
+
+//! Resultado de la reproducción de una traza
+typedef struct {
+    uint16_t messages;       //!< Cantidad de mensajes reproducidos
+    uint16_t outputs;        //!< Cantidad de cambios de modo y de salidas comparados
+    uint16_t mismatches;     //!< Cantidad de cambios distintos de los grabados
+    uint16_t first_mismatch; //!< Índice en la traza del primer cambio distinto, count si no hubo diferencias
+    uint32_t max_skew;       //!< Máxima diferencia, en ticks, entre un cambio grabado y el reproducido
+    uint32_t duration;       //!< Duración de la traza en ticks
+} replay_result_t;
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief        Reproduce una traza grabada y verifica que la lógica produzca las mismas salidas.
+ *
+ * @param trace  Eventos grabados, del más antiguo al más reciente.
+ * @param count  Cantidad de eventos de la traza.
+ * @param result Resultado de la reproducción.
+ * @return       true si la traza se reprodujo sin diferencias, false en caso contrario.
+ */
+bool ReplayRun(const record_event_t * trace, uint16_t count, replay_result_t * result);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REPLAY_H_ */
@@ -0,0 +1,226 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace_json.c
+ ** @brief Código fuente del decodificador en el host de las trazas binarias al formato JSON de Chrome
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace_json.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Identificador de proceso de todos los eventos JSON
+#define TRACE_JSON_PID 1
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de la decodificación en curso
+typedef struct {
+    FILE * output;                            //!< Archivo de salida
+    uint32_t written;                         //!< Cantidad de eventos JSON escritos
+    uint16_t ticks_per_us;                    //!< Ciclos de la fuente de tiempo por microsegundo
+    uint64_t elapsed;                         //!< Ciclos transcurridos desde la primera traza
+    uint16_t current;                         //!< Tarea en ejecución
+    bool task_open[TRACE_TASK_COUNT];         //!< Tareas con una franja de ejecución abierta
+    bool refresh_open[TRACE_TASK_COUNT];      //!< Tareas con una franja de ScreenRefresh abierta
+    bool tick_open[TRACE_TASK_COUNT];         //!< Tareas con una franja de ClockNewTick abierta
+} trace_json_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief       Escribe un evento JSON con el instante actual de la decodificación.
+ *
+ * @param self  Estado de la decodificación.
+ * @param name  Nombre del evento.
+ * @param phase Fase del evento ("B" comienzo, "E" fin, "i" instantáneo).
+ * @param tid   Tarea a la que pertenece el evento.
+ * @param args  Argumentos del evento en formato JSON, o NULL si no tiene.
+ */
+static void WriteEvent(trace_json_t * self, const char * name, const char * phase, uint16_t tid, const char * args);
+
+/**
+ * @brief       Abre o cierra una franja de la tarea actual, ignorando los cierres sin apertura.
+ *
+ * @param self  Estado de la decodificación.
+ * @param open  Franjas abiertas por tarea.
+ * @param name  Nombre de la franja.
+ * @param begin true para abrir la franja, false para cerrarla.
+ */
+static void WriteSlice(trace_json_t * self, bool open[TRACE_TASK_COUNT], const char * name, bool begin);
+
+/**
+ * @brief       Limita un número de traza de tarea a los valores conocidos.
+ *
+ * @param arg   Número de traza de la tarea.
+ * @return      El número de traza, o TRACE_TASK_SYSTEM si no es conocido.
+ */
+static uint16_t TaskId(uint16_t arg);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Nombres de las tareas según su número de traza, coinciden con los usados en xTaskCreate
+static const char * const TASK_NAMES[TRACE_TASK_COUNT] = {
+    [TRACE_TASK_SYSTEM] = "Sistema",   [TRACE_TASK_MAIN] = "MainTask", [TRACE_TASK_DISPLAY] = "Display",
+    [TRACE_TASK_CLOCK] = "Clock",      [TRACE_TASK_BUTTON] = "Buttons",
+};
+
+//! Nombres de las colas según su número de traza
+static const char * const QUEUE_NAMES[TRACE_QUEUE_COUNT] = {
+    [TRACE_QUEUE_OTHER] = "otra",
+    [TRACE_QUEUE_MAIN] = "main",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void WriteEvent(trace_json_t * self, const char * name, const char * phase, uint16_t tid, const char * args) {
+    unsigned long long us = self->elapsed / self->ticks_per_us;
+    unsigned int ns = (unsigned int)((self->elapsed % self->ticks_per_us) * 1000 / self->ticks_per_us);
+
+    fprintf(self->output, "%s{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%llu.%03u,\"pid\":%d,\"tid\":%u",
+            self->written ? ",\n" : "", name, phase, us, ns, TRACE_JSON_PID, (unsigned int)tid);
+    if (phase[0] == 'i') {
+        fprintf(self->output, ",\"s\":\"t\"");
+    }
+    if (args) {
+        fprintf(self->output, ",\"args\":%s", args);
+    }
+    fprintf(self->output, "}");
+    self->written++;
+}
+
+static void WriteSlice(trace_json_t * self, bool open[TRACE_TASK_COUNT], const char * name, bool begin) {
+    if (begin) {
+        open[self->current] = true;
+        WriteEvent(self, name, "B", self->current, NULL);
+    } else if (open[self->current]) {
+        open[self->current] = false;
+        WriteEvent(self, name, "E", self->current, NULL);
+    }
+}
+
+static uint16_t TaskId(uint16_t arg) {
+    return (arg < TRACE_TASK_COUNT) ? arg : TRACE_TASK_SYSTEM;
+}
+
+/* === Public function definitions ============================================================================== */
+
+uint32_t TraceJsonWrite(FILE * output, const trace_record_t * records, uint32_t count, uint16_t ticks_per_us) {
+    trace_json_t self[1];
+    char args[48];
+
+    memset(self, 0, sizeof(self));
+    self->output = output;
+    self->ticks_per_us = ticks_per_us ? ticks_per_us : 1;
+
+    fprintf(output, "{\"traceEvents\":[\n");
+    for (uint16_t tid = 0; tid < TRACE_TASK_COUNT; tid++) {
+        fprintf(output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}},\n",
+                TRACE_JSON_PID, (unsigned int)tid, TASK_NAMES[tid]);
+    }
+
+    for (uint32_t index = 0; index < count; index++) {
+        const trace_record_t * record = &records[index];
+        if (index > 0) {
+            self->elapsed += (uint32_t)(record->timestamp - records[index - 1].timestamp);
+        }
+
+        switch (record->event) {
+        case TRACE_TASK_SWITCHED_IN:
+            self->current = TaskId(record->arg);
+            WriteSlice(self, self->task_open, TASK_NAMES[self->current], true);
+            break;
+        case TRACE_TASK_SWITCHED_OUT:
+            self->current = TaskId(record->arg);
+            WriteSlice(self, self->task_open, TASK_NAMES[self->current], false);
+            break;
+        case TRACE_SCREEN_REFRESH_BEGIN:
+        case TRACE_SCREEN_REFRESH_END:
+            WriteSlice(self, self->refresh_open, "ScreenRefresh", record->event == TRACE_SCREEN_REFRESH_BEGIN);
+            break;
+        case TRACE_CLOCK_TICK_BEGIN:
+        case TRACE_CLOCK_TICK_END:
+            WriteSlice(self, self->tick_open, "ClockNewTick", record->event == TRACE_CLOCK_TICK_BEGIN);
+            break;
+        case TRACE_QUEUE_SEND:
+        case TRACE_QUEUE_SEND_FAILED:
+            snprintf(args, sizeof(args), "{\"queue\":\"%s\"}",
+                     (record->arg < TRACE_QUEUE_COUNT) ? QUEUE_NAMES[record->arg] : QUEUE_NAMES[TRACE_QUEUE_OTHER]);
+            WriteEvent(self, (record->event == TRACE_QUEUE_SEND) ? "QueueSend" : "QueueSendFailed", "i",
+                       self->current, args);
+            break;
+        case TRACE_ALARM:
+            WriteEvent(self, record->arg ? "AlarmOn" : "AlarmOff", "i", self->current, NULL);
+            break;
+        case TRACE_BOOT_FIRST_FRAME:
+            WriteEvent(self, "FirstFrame", "i", self->current, NULL);
+            break;
+        default:
+            break;
+        }
+    }
+    fprintf(output, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+    return self->written;
+}
+
+int32_t TraceJsonWriteDump(FILE * output, const uint8_t * dump, size_t length) {
+    trace_header_t header;
+
+    if (length < sizeof(header)) {
+        return -1;
+    }
+    memcpy(&header, dump, sizeof(header));
+    if ((header.magic != TRACE_MAGIC) || (header.size == 0) || ((header.size & (header.size - 1)) != 0) ||
+        (length < sizeof(header) + (size_t)header.size * sizeof(trace_record_t))) {
+        return -1;
+    }
+
+    // Si los escritores dieron la vuelta sólo quedan las últimas trazas, las anteriores se sobrescribieron
+    uint32_t pending = header.head - header.tail;
+    if (pending > header.size) {
+        pending = header.size;
+    }
+    trace_record_t * records = malloc((pending ? pending : 1) * sizeof(trace_record_t));
+    if (!records) {
+        return -1;
+    }
+
+    uint32_t count = 0;
+    for (uint32_t index = header.head - pending; index != header.head; index++) {
+        memcpy(&records[count], dump + sizeof(header) + (index & (header.size - 1u)) * sizeof(trace_record_t),
+               sizeof(trace_record_t));
+        if (records[count].event != TRACE_NONE) {
+            count++; // Las trazas reservadas pero no completadas al momento del volcado se omiten
+        }
+    }
+
+    int32_t written = (int32_t)TraceJsonWrite(output, records, count, header.ticks_per_us);
+    free(records);
+    return written;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,83 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_JSON_H_
+#define TRACE_JSON_H_
+
+/** @file trace_json.h
+ ** @brief Declaraciones del decodificador en el host de las trazas binarias al formato JSON de Chrome
+ **
+ ** El resultado se abre con chrome://tracing o con https://ui.perfetto.dev. Cada tarea es un hilo: los cambios de
+ ** contexto abren y cierran una franja con el nombre de la tarea, ScreenRefresh y ClockNewTick se anidan dentro de la
+ ** tarea que los ejecuta, y los envíos a colas y los cambios de la alarma son eventos instantáneos. Los instantes se
+ ** cuentan desde la primera traza y se corrige el desborde del contador de 32 bits, suponiendo que entre dos trazas
+ ** consecutivas no pasa un período completo del contador.
+ **/
+
+/* === Headers files inclusions =================================================================================== */
+
+#include "trace.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* === Header for C++ compatibility =============================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions ================================================================================== */
+
+/* === Public data type declarations ============================================================================== */
+
+/* === Public variable declarations =============================================================================== */
+
+/* === Public function declarations =============================================================================== */
+
+/**
+ * @brief              Escribe una secuencia de trazas en formato JSON de Chrome.
+ *
+ * @param output       Archivo de salida.
+ * @param records      Trazas, de la más antigua a la más reciente.
+ * @param count        Cantidad de trazas.
+ * @param ticks_per_us Ciclos de la fuente de tiempo por microsegundo.
+ * @return             Cantidad de eventos JSON escritos, sin contar los nombres de las tareas.
+ */
+uint32_t TraceJsonWrite(FILE * output, const trace_record_t * records, uint32_t count, uint16_t ticks_per_us);
+
+/**
+ * @brief        Escribe en formato JSON de Chrome las trazas pendientes de un volcado de memoria del buffer.
+ *
+ * Si el buffer dio la vuelta se escriben las últimas trazas, tantas como lugares tiene el buffer.
+ *
+ * @param output Archivo de salida.
+ * @param dump   Volcado del buffer, comienza con trace_header_t seguido de los lugares del buffer.
+ * @param length Cantidad de bytes del volcado.
+ * @return       Cantidad de eventos JSON escritos, o -1 si el volcado no es válido.
+ */
+int32_t TraceJsonWriteDump(FILE * output, const uint8_t * dump, size_t length);
+
+/* === End of conditional blocks ================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_JSON_H_ */
@@ -0,0 +1,608 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_app.c
+ ** @brief Código fuente de las pruebas de la máquina de estados de la aplicación
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "config.h"
+#include "app.h"
+#include "clock.h"
+#include "buzzer.h"
+#include "chrono.h"
+#include "screen.h"
+#include "persist.h"
+#include "host_storage.h"
+#include "host_screen.h"
+#include "mock_digital.h"
+#include <stdio.h>
+
+/**
+ - Al crear la aplicación queda en modo de hora sin ajustar y muestra 00:00.
+ - Para cada par modo × evento la aplicación pasa al modo esperado, con hora inválida y con hora válida.
+ - Sólo los modos de ajuste son modos de configuración y vencen por tiempo.
+ - Los modos que muestran un tiempo que avanza piden actualizar la pantalla, el cronómetro cada centésima.
+ - Una demora mayor al tiempo de configuración lo agota en una sola llamada.
+ - Ajustar la hora completa desde los botones deja el reloj en hora y la muestra.
+ - Los botones de incremento y decremento recorren los límites de minutos y horas.
+ - Las repeticiones de las teclas mantenidas suman todos sus pasos de una vez y recorren los límites.
+ - Los eventos sólo publican el cuadro, que se muestra recién cuando lo escribe la tarea de la pantalla.
+ - Cancelar el ajuste de la hora no modifica el reloj.
+ - Ajustar la alarma desde los botones la habilita y suena al llegar la hora.
+ - Aceptar con la alarma sonando la pospone y cancelar la detiene y deshabilita.
+ - Aceptar la alarma más veces que el límite de aplazamientos la detiene sin deshabilitarla.
+ - La alarma desatendida suena ALARM_RING_SECONDS cada vez y se apaga sola al agotar los aplazamientos.
+ - La alarma ajustada desde los botones se recupera del almacenamiento persistente después de un reinicio.
+ - Con las escrituras diferidas el estado se guarda recién al pedirlo la tarea inactiva.
+ - El temporizador ajustado desde los botones cuenta hacia atrás, al vencer pasa a su modo y aceptar lo silencia.
+ - El temporizador vence aunque se esté mostrando la hora, y la alarma tiene prioridad sobre él.
+ - El cronómetro se pone en marcha, se detiene y vuelve a cero desde los botones y muestra las centésimas.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define CLOCK_TICKS_PER_SECOND 1000
+
+//! Modo esperado que indica que el evento no cambia el modo
+#define KEEP CLOCK_MODE_COUNT
+
+//! Archivo de la memoria emulada del almacenamiento persistente
+#define STORAGE_PATH "build/test_app_persist.bin"
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief   Contador libre falso del temporizador y del cronómetro.
+ * @return  Valor actual del contador.
+ */
+static uint32_t FakeTicks(void);
+
+/**
+ * @brief       Refresca la pantalla durante un período completo de parpadeo y verifica los dígitos mostrados.
+ * @param value Dígitos esperados, de izquierda a derecha.
+ */
+static void AssertScreen(const uint8_t value[4]);
+
+/* === Private variable declarations =========================================================== */
+
+static const uint8_t IMAGES[10] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,
+    SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+};
+
+//! Modo esperado después de cada evento partiendo de cada modo, con el reloj sin hora válida
+static const clock_mode_t EXPECTED_WITHOUT_TIME[CLOCK_MODE_COUNT][MSG_COUNT] = {
+    [CLOCK_MODE_UNSET_TIME] = {CLOCK_MODE_SET_MINUTES, CLOCK_MODE_SET_ALARM_MINUTES, KEEP, KEEP, KEEP, KEEP, KEEP, KEEP,
+                               KEEP, KEEP},
+    [CLOCK_MODE_DISPLAY] = {CLOCK_MODE_SET_MINUTES, CLOCK_MODE_SET_ALARM_MINUTES, KEEP, KEEP, CLOCK_MODE_TIMER,
+                            CLOCK_MODE_STOPWATCH, KEEP, KEEP, KEEP, KEEP},
+    [CLOCK_MODE_SET_HOURS] = {KEEP, KEEP, CLOCK_MODE_DISPLAY, CLOCK_MODE_UNSET_TIME, KEEP, KEEP, KEEP,
+                              CLOCK_MODE_UNSET_TIME, KEEP, KEEP},
+    [CLOCK_MODE_SET_MINUTES] = {KEEP, KEEP, CLOCK_MODE_SET_HOURS, CLOCK_MODE_UNSET_TIME, KEEP, KEEP, KEEP,
+                                CLOCK_MODE_UNSET_TIME, KEEP, KEEP},
+    [CLOCK_MODE_SET_ALARM_HOURS] = {KEEP, KEEP, CLOCK_MODE_DISPLAY, CLOCK_MODE_DISPLAY, KEEP, KEEP, KEEP,
+                                    CLOCK_MODE_UNSET_TIME, KEEP, KEEP},
+    [CLOCK_MODE_SET_ALARM_MINUTES] = {KEEP, KEEP, CLOCK_MODE_SET_ALARM_HOURS, CLOCK_MODE_DISPLAY, KEEP, KEEP, KEEP,
+                                      CLOCK_MODE_UNSET_TIME, KEEP, KEEP},
+    [CLOCK_MODE_TIMER] = {CLOCK_MODE_SET_TIMER_MINUTES, KEEP, KEEP, KEEP, CLOCK_MODE_STOPWATCH, CLOCK_MODE_UNSET_TIME,
+                          KEEP, KEEP, KEEP, KEEP},
+    [CLOCK_MODE_SET_TIMER_HOURS] = {KEEP, KEEP, CLOCK_MODE_TIMER, CLOCK_MODE_TIMER, KEEP, KEEP, KEEP, CLOCK_MODE_TIMER,
+                                    KEEP, KEEP},
+    [CLOCK_MODE_SET_TIMER_MINUTES] = {KEEP, KEEP, CLOCK_MODE_SET_TIMER_HOURS, CLOCK_MODE_TIMER, KEEP, KEEP, KEEP,
+                                      CLOCK_MODE_TIMER, KEEP, KEEP},
+    [CLOCK_MODE_STOPWATCH] = {KEEP, KEEP, KEEP, KEEP, CLOCK_MODE_UNSET_TIME, CLOCK_MODE_TIMER, KEEP, KEEP, KEEP, KEEP},
+};
+
+static uint32_t ticks;
+
+/* === Private function declarations =========================================================== */
+
+static uint32_t FakeTicks(void) {
+    return ticks;
+}
+
+/* === Public variable definitions ============================================================= */
+
+//!< Variables globales para la aplicación bajo prueba
+clock_t clock;
+struct board_s board;
+app_t app;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void AssertScreen(const uint8_t value[4]) {
+    // Como la tarea de la pantalla, se escribe el cuadro publicado y se muestra recién desde el barrido siguiente
+    AppUpdateDisplay(app, false);
+    for (uint8_t i = 0; i < 4; i++) {
+        ScreenRefresh(board.screen);
+    }
+    HostScreenClear();
+    for (uint16_t i = 0; i < 4 * 200; i++) {
+        ScreenRefresh(board.screen);
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_HEX8(IMAGES[value[i]], HostScreenShown()[i]);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    DigitalOutputGroupWrite_Ignore();
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    if (board.screen == NULL) {
+        board.screen = HostScreenCreate(4);
+    }
+    app = AppCreate(clock, &board);
+    ticks = 0;
+    AppAttachChronos(app, ChronoCreate(CHRONO_TIMER, FakeTicks, CLOCK_TICKS_PER_SECOND),
+                     ChronoCreate(CHRONO_STOPWATCH, FakeTicks, CLOCK_TICKS_PER_SECOND));
+}
+
+// Al crear la aplicación queda en modo de hora sin ajustar y muestra 00:00.
+void test_start_in_unset_time_mode(void) {
+    TEST_ASSERT_EQUAL(CLOCK_MODE_UNSET_TIME, AppGetMode(app));
+    AssertScreen((const uint8_t[]){0, 0, 0, 0});
+}
+
+// Para cada par modo × evento la aplicación pasa al modo esperado, con el reloj sin hora válida.
+void test_every_transition_without_valid_time(void) {
+    for (uint8_t mode = 0; mode < CLOCK_MODE_COUNT; mode++) {
+        for (uint8_t event = 0; event < MSG_COUNT; event++) {
+            clock_mode_t expected = EXPECTED_WITHOUT_TIME[mode][event];
+
+            clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+            app = AppCreate(clock, &board);
+            AppModeChange(app, mode);
+            AppDispatch(app, event);
+            TEST_ASSERT_EQUAL_MESSAGE(expected == KEEP ? mode : expected, AppGetMode(app), "Unexpected transition");
+        }
+    }
+}
+
+// Para cada par modo × evento la aplicación pasa al modo esperado, con el reloj en hora.
+void test_every_transition_with_valid_time(void) {
+    for (uint8_t mode = 0; mode < CLOCK_MODE_COUNT; mode++) {
+        for (uint8_t event = 0; event < MSG_COUNT; event++) {
+            clock_mode_t expected = EXPECTED_WITHOUT_TIME[mode][event];
+            if (expected == CLOCK_MODE_UNSET_TIME) {
+                expected = CLOCK_MODE_DISPLAY;
+            }
+
+            clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+            ClockSetTime(clock, &(clock_time_t){0});
+            app = AppCreate(clock, &board);
+            AppModeChange(app, mode);
+            AppDispatch(app, event);
+            TEST_ASSERT_EQUAL_MESSAGE(expected == KEEP ? mode : expected, AppGetMode(app), "Unexpected transition");
+        }
+    }
+}
+
+// Sólo los modos de ajuste son modos de configuración y vencen por tiempo.
+void test_only_set_modes_time_out(void) {
+    for (uint8_t mode = 0; mode < CLOCK_MODE_COUNT; mode++) {
+        bool config = (mode != CLOCK_MODE_UNSET_TIME) && (mode != CLOCK_MODE_DISPLAY) && (mode != CLOCK_MODE_TIMER) &&
+                      (mode != CLOCK_MODE_STOPWATCH);
+        bool elapsed = false;
+
+        AppModeChange(app, mode);
+        TEST_ASSERT_EQUAL(config, AppIsInConfigMode(app));
+        for (uint32_t tick = 0; tick < CONFIG_TIMEOUT_TICKS; tick++) {
+            elapsed = AppConfigTimeoutTick(app, 1);
+        }
+        TEST_ASSERT_EQUAL(config, elapsed);
+    }
+}
+
+// Los modos que muestran un tiempo que avanza piden actualizar la pantalla, el cronómetro cada centésima.
+void test_live_modes_refresh_display(void) {
+    for (uint8_t mode = 0; mode < CLOCK_MODE_COUNT; mode++) {
+        uint16_t expected = 0;
+        if ((mode == CLOCK_MODE_DISPLAY) || (mode == CLOCK_MODE_TIMER)) {
+            expected = DISPLAY_UPDATE_TICKS;
+        } else if (mode == CLOCK_MODE_STOPWATCH) {
+            expected = CLOCK_TICKS_PER_SECOND / 100;
+        }
+        AppModeChange(app, mode);
+        AppUpdateDisplay(app, false);
+        TEST_ASSERT_EQUAL_UINT16(expected, AppRefreshTicks(app));
+    }
+}
+
+// Una demora mayor al tiempo de configuración lo agota en una sola llamada.
+void test_config_timeout_after_stall(void) {
+    AppModeChange(app, CLOCK_MODE_SET_MINUTES);
+    TEST_ASSERT_FALSE(AppConfigTimeoutTick(app, CONFIG_TIMEOUT_TICKS - 1));
+    TEST_ASSERT_TRUE(AppConfigTimeoutTick(app, 5 * TICKS_PER_SECOND));
+}
+
+// Ajustar la hora completa desde los botones deja el reloj en hora y la muestra.
+void test_set_time_from_buttons(void) {
+    clock_time_t current_time;
+
+    AppDispatch(app, MSG_BUTTON_SET_TIME_LONG);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_SET_MINUTES, AppGetMode(app));
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_SET_HOURS, AppGetMode(app));
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 2, 0, 2, 2}), current_time.bcd, 6);
+    AssertScreen((const uint8_t[]){2, 2, 0, 2});
+}
+
+// Los botones de incremento y decremento recorren los límites de minutos y horas.
+void test_increase_and_decrease_wrap_around(void) {
+    AppDispatch(app, MSG_BUTTON_SET_TIME_LONG);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AssertScreen((const uint8_t[]){0, 0, 5, 9});
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AssertScreen((const uint8_t[]){0, 0, 0, 0});
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AssertScreen((const uint8_t[]){2, 3, 0, 0});
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AssertScreen((const uint8_t[]){0, 0, 0, 0});
+}
+
+// Las repeticiones de las teclas mantenidas suman todos sus pasos de una vez y recorren los límites.
+void test_repeat_applies_batched_steps(void) {
+    AppDispatch(app, MSG_BUTTON_SET_TIME_LONG);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatchSteps(app, MSG_BUTTON_INCREASE_REPEAT, 44);
+    AssertScreen((const uint8_t[]){0, 0, 4, 5});
+    AppDispatchSteps(app, MSG_BUTTON_INCREASE_REPEAT, 20);
+    AssertScreen((const uint8_t[]){0, 0, 0, 5});
+    AppDispatchSteps(app, MSG_BUTTON_DECREASE_REPEAT, 10);
+    AssertScreen((const uint8_t[]){0, 0, 5, 5});
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppDispatchSteps(app, MSG_BUTTON_DECREASE_REPEAT, 25);
+    AssertScreen((const uint8_t[]){2, 3, 5, 5});
+    AppDispatchSteps(app, MSG_BUTTON_INCREASE_REPEAT, 0); // Sin pasos acumulados vale un paso, como el flanco
+    AssertScreen((const uint8_t[]){0, 0, 5, 5});
+
+    // Los pasos saturados por una demora larga no cambian el sentido de la tecla: 65535 % 24 = 15
+    AppDispatchSteps(app, MSG_BUTTON_INCREASE_REPEAT, UINT16_MAX);
+    AssertScreen((const uint8_t[]){1, 5, 5, 5});
+    AppDispatchSteps(app, MSG_BUTTON_DECREASE_REPEAT, UINT16_MAX);
+    AssertScreen((const uint8_t[]){0, 0, 5, 5});
+}
+
+// Los eventos sólo publican el cuadro, que se muestra recién cuando lo escribe la tarea de la pantalla.
+void test_events_only_publish_the_frame(void) {
+    AssertScreen((const uint8_t[]){0, 0, 0, 0});
+    AppDispatch(app, MSG_BUTTON_SET_TIME_LONG);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+
+    HostScreenClear();
+    for (uint16_t i = 0; i < 4 * 200; i++) {
+        ScreenRefresh(board.screen);
+    }
+    TEST_ASSERT_EQUAL_HEX8(IMAGES[0], HostScreenShown()[3]);
+
+    // De la ráfaga de eventos se escribe sólo el último cuadro
+    AssertScreen((const uint8_t[]){0, 0, 0, 2});
+}
+
+// Cancelar el ajuste de la hora no modifica el reloj.
+void test_cancel_set_time_keeps_clock(void) {
+    clock_time_t current_time;
+
+    AppDispatch(app, MSG_BUTTON_SET_TIME_LONG);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatch(app, MSG_BUTTON_CANCEL);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_UNSET_TIME, AppGetMode(app));
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
+}
+
+// Ajustar la alarma desde los botones la habilita y suena al llegar la hora.
+void test_set_alarm_from_buttons(void) {
+    clock_time_t alarm_time;
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    AppDispatch(app, MSG_BUTTON_SET_ALARM_LONG);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_SET_ALARM_MINUTES, AppGetMode(app));
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+
+    TEST_ASSERT_TRUE(ClockGetAlarm(clock, &alarm_time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 1, 0, 1, 0}), alarm_time.bcd, 6);
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+
+    AppPoll(app);
+    TEST_ASSERT_FALSE(AppAlarmIsRinging(app));
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    AppPoll(app);
+    TEST_ASSERT_TRUE(AppAlarmIsRinging(app));
+}
+
+// Aceptar con la alarma sonando la pospone y cancelar la detiene y deshabilita.
+void test_accept_postpones_and_cancel_stops_alarm(void) {
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    ClockEnableAlarm(clock, true);
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    AppPoll(app);
+    TEST_ASSERT_TRUE(AppAlarmIsRinging(app));
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppPoll(app);
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+
+    AppDispatch(app, MSG_BUTTON_CANCEL);
+    TEST_ASSERT_FALSE(AppAlarmIsRinging(app));
+    TEST_ASSERT_FALSE(ClockAlarmIsEnabled(clock));
+    AppPoll(app);
+    TEST_ASSERT_FALSE(AppAlarmIsRinging(app));
+}
+
+// Aceptar la alarma más veces que el límite de aplazamientos la detiene sin deshabilitarla.
+void test_snooze_limit_stops_alarm(void) {
+    uint16_t minutes = ALARM_SNOOZE_MINUTES;
+
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    ClockEnableAlarm(clock, true);
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    AppPoll(app);
+
+    for (uint8_t snooze = 0; snooze < ALARM_SNOOZE_LIMIT; snooze++) {
+        TEST_ASSERT_TRUE(AppAlarmIsRinging(app));
+        AppDispatch(app, MSG_BUTTON_ACCEPT);
+        TEST_ASSERT_FALSE(AppAlarmIsRinging(app));
+        ClockAdvance(clock, minutes * 60UL * CLOCK_TICKS_PER_SECOND);
+        AppPoll(app);
+        if (minutes - ALARM_SNOOZE_STEP_MINUTES >= ALARM_SNOOZE_MIN_MINUTES) {
+            minutes -= ALARM_SNOOZE_STEP_MINUTES;
+        }
+    }
+    TEST_ASSERT_TRUE(AppAlarmIsRinging(app));
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppPoll(app);
+    TEST_ASSERT_FALSE(AppAlarmIsRinging(app));
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+}
+
+// La alarma desatendida suena ALARM_RING_SECONDS cada vez y se apaga sola al agotar los aplazamientos.
+void test_unattended_alarm_turns_off(void) {
+    uint32_t ringing_seconds = 0;
+    uint8_t rings = 0;
+
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 1, 0, 1, 0}});
+    ClockEnableAlarm(clock, true);
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+
+    // Dos horas de a un segundo, mucho más que todos los aplazamientos
+    for (uint32_t second = 0; second < 2 * 3600; second++) {
+        bool was_ringing = AppAlarmIsRinging(app);
+        AppPoll(app);
+        if (AppAlarmIsRinging(app)) {
+            rings += !was_ringing;
+            ringing_seconds++;
+        }
+        ClockAdvance(clock, CLOCK_TICKS_PER_SECOND);
+    }
+    TEST_ASSERT_FALSE(AppAlarmIsRinging(app));
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+    TEST_ASSERT_EQUAL_UINT8(ALARM_SNOOZE_LIMIT + 1, rings);
+    TEST_ASSERT_EQUAL_UINT32((ALARM_SNOOZE_LIMIT + 1) * ALARM_RING_SECONDS, ringing_seconds);
+}
+
+// La alarma ajustada desde los botones se recupera del almacenamiento persistente después de un reinicio.
+void test_alarm_survives_reset(void) {
+    clock_time_t alarm_time;
+
+    remove(STORAGE_PATH);
+    ClockSetTrim(clock, -25);
+    ClockSetSlew(clock, 500); // La corrección transitoria de la sincronización no se guarda
+    AppAttachPersist(app, PersistCreate(HostStorageOpen(STORAGE_PATH, 256, 2)));
+    AppDispatch(app, MSG_BUTTON_SET_ALARM_LONG);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    HostStorageClose();
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    app = AppCreate(clock, &board);
+    TEST_ASSERT_FALSE(ClockAlarmIsEnabled(clock));
+    AppAttachPersist(app, PersistCreate(HostStorageOpen(STORAGE_PATH, 256, 2)));
+    HostStorageClose();
+    remove(STORAGE_PATH);
+
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+    TEST_ASSERT_EQUAL_INT32(-25, ClockGetTrim(clock));
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetSlew(clock));
+    ClockGetAlarm(clock, &alarm_time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 9, 5, 3, 2}), alarm_time.bcd, 6);
+}
+
+// Con las escrituras diferidas el estado se guarda recién al pedirlo la tarea inactiva.
+void test_deferred_save_waits_for_flush(void) {
+    const clock_time_t alarm = {.time = {.hours = {7, 0}, .minutes = {0, 3}}}; // 07:30
+    clock_time_t alarm_time;
+
+    remove(STORAGE_PATH);
+    AppAttachPersist(app, PersistCreate(HostStorageOpen(STORAGE_PATH, 256, 2)));
+    AppDeferSave(app, true);
+    TEST_ASSERT_TRUE(AppSetAlarm(app, &alarm, CLOCK_ALARM_EVERY_DAY, true));
+    HostStorageClose();
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    app = AppCreate(clock, &board);
+    AppAttachPersist(app, PersistCreate(HostStorageOpen(STORAGE_PATH, 256, 2)));
+    TEST_ASSERT_FALSE(ClockAlarmIsEnabled(clock));
+    AppDeferSave(app, true);
+    TEST_ASSERT_TRUE(AppSetAlarm(app, &alarm, CLOCK_ALARM_EVERY_DAY, true));
+    AppFlushState(app);
+    HostStorageClose();
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    app = AppCreate(clock, &board);
+    AppAttachPersist(app, PersistCreate(HostStorageOpen(STORAGE_PATH, 256, 2)));
+    HostStorageClose();
+    remove(STORAGE_PATH);
+
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+    ClockGetAlarm(clock, &alarm_time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 0, 3, 7, 0}), alarm_time.bcd, 6);
+}
+
+// El temporizador ajustado desde los botones cuenta hacia atrás, al vencer pasa a su modo y aceptar lo silencia.
+void test_timer_from_buttons(void) {
+    ClockSetTime(clock, &(clock_time_t){0});
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_TIMER, AppGetMode(app));
+    AssertScreen((const uint8_t[]){0, 5, 0, 0});
+
+    // Ajustar 0 horas y 2 minutos
+    AppDispatch(app, MSG_BUTTON_SET_TIME_LONG);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_SET_TIMER_MINUTES, AppGetMode(app));
+    AssertScreen((const uint8_t[]){0, 0, 0, 5});
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_TIMER, AppGetMode(app));
+    AssertScreen((const uint8_t[]){0, 2, 0, 0});
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    ticks += 30 * CLOCK_TICKS_PER_SECOND;
+    AppUpdateDisplay(app, true);
+    AssertScreen((const uint8_t[]){0, 1, 3, 0});
+
+    // Al vencer pasa al modo del temporizador aunque se esté mostrando la hora
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+    ticks += 90 * CLOCK_TICKS_PER_SECOND;
+    AppPoll(app);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_TIMER, AppGetMode(app));
+    AssertScreen((const uint8_t[]){0, 0, 0, 0});
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppPoll(app);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_TIMER, AppGetMode(app));
+    AssertScreen((const uint8_t[]){0, 2, 0, 0});
+}
+
+// El temporizador vence aunque se esté mostrando la hora, y la alarma tiene prioridad sobre él.
+void test_alarm_has_priority_over_timer(void) {
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 9, 5, 0, 1}});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 1, 1}});
+    ClockEnableAlarm(clock, true);
+    AppModeChange(app, CLOCK_MODE_STOPWATCH);
+
+    ClockAdvance(clock, 60UL * CLOCK_TICKS_PER_SECOND);
+    AppPoll(app);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+    TEST_ASSERT_TRUE(AppAlarmIsRinging(app));
+
+    // Con la alarma sonando el temporizador vencido espera a que se atienda
+    AppModeChange(app, CLOCK_MODE_TIMER);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    ticks += TIMER_DEFAULT_MINUTES * 60UL * CLOCK_TICKS_PER_SECOND;
+    AppPoll(app);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+    AppDispatch(app, MSG_BUTTON_CANCEL);
+    AppPoll(app);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_TIMER, AppGetMode(app));
+}
+
+// La tarea periódica sólo hace falta al vencer el temporizador o al cambiar la alarma, y seguido mientras suena.
+void test_poll_delay_follows_deadlines(void) {
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 9, 5, 0, 1}});
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_DEADLINE, AppPollDelay(app));
+
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 1, 1}});
+    ClockEnableAlarm(clock, true);
+    TEST_ASSERT_EQUAL_UINT32(60UL * CLOCK_TICKS_PER_SECOND, AppPollDelay(app));
+
+    // El temporizador en marcha vence antes que la alarma
+    AppModeChange(app, CLOCK_MODE_TIMER);
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    ticks += (TIMER_DEFAULT_MINUTES * 60UL - 30) * CLOCK_TICKS_PER_SECOND;
+    TEST_ASSERT_EQUAL_UINT32(30UL * CLOCK_TICKS_PER_SECOND, AppPollDelay(app));
+
+    ClockAdvance(clock, 60UL * CLOCK_TICKS_PER_SECOND);
+    AppPoll(app);
+    TEST_ASSERT_TRUE(AppAlarmIsRinging(app));
+    TEST_ASSERT_EQUAL_UINT32(APP_POLL_TICKS, AppPollDelay(app));
+}
+
+// El cronómetro se pone en marcha, se detiene y vuelve a cero desde los botones y muestra las centésimas.
+void test_stopwatch_from_buttons(void) {
+    ClockSetTime(clock, &(clock_time_t){0});
+    AppModeChange(app, CLOCK_MODE_DISPLAY);
+    AppDispatch(app, MSG_BUTTON_DECREASE);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_STOPWATCH, AppGetMode(app));
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    ticks += 12340;
+    AppUpdateDisplay(app, true);
+    AssertScreen((const uint8_t[]){1, 2, 3, 4});
+
+    AppDispatch(app, MSG_BUTTON_ACCEPT);
+    ticks += 5000;
+    AppUpdateDisplay(app, true);
+    AssertScreen((const uint8_t[]){1, 2, 3, 4});
+
+    AppDispatch(app, MSG_BUTTON_CANCEL);
+    AssertScreen((const uint8_t[]){0, 0, 0, 0});
+    AppDispatch(app, MSG_BUTTON_INCREASE);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
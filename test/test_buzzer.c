@@ -0,0 +1,207 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_buzzer.c
+ ** @brief Código fuente de las pruebas del generador de tonos del zumbador
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "buzzer.h"
+#include "host_buzzer.h"
+
+/**
+ - Al crear el generador el zumbador queda en silencio y sin temporizador programado.
+ - Una melodía sin repetición reproduce cada nota con su duración y termina en silencio.
+ - Una melodía con repetición vuelve a la nota indicada al terminar.
+ - Detener la melodía silencia el zumbador y cancela el temporizador.
+ - Reproducir una melodía nueva la comienza desde su primera nota.
+ - La melodía creciente sube el volumen hasta el máximo y se repite con el volumen máximo.
+ - Las funciones aceptan un generador nulo sin hacer nada.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief           Verifica un tono registrado.
+ * @param tone      Tono registrado.
+ * @param start     Instante de comienzo esperado.
+ * @param frequency Frecuencia esperada.
+ * @param volume    Volumen esperado.
+ */
+static void AssertTone(const host_buzzer_tone_t * tone, uint32_t start, uint16_t frequency, uint8_t volume);
+
+/* === Private variable declarations =========================================================== */
+
+static const buzzer_note_t SHORT_NOTES[] = {
+    {1000, 50, 20},
+    {0, 0, 30},
+    {2000, 100, 40},
+};
+
+//! Melodía de tres notas que se reproduce una vez
+static const struct buzzer_melody_s SHORT = {
+    .notes = SHORT_NOTES,
+    .count = 3,
+    .repeat_from = BUZZER_NO_REPEAT,
+};
+
+//! Melodía de tres notas que repite las dos últimas
+static const struct buzzer_melody_s LOOP = {
+    .notes = SHORT_NOTES,
+    .count = 3,
+    .repeat_from = 1,
+};
+
+/* === Private function declarations =========================================================== */
+
+static void AssertTone(const host_buzzer_tone_t * tone, uint32_t start, uint16_t frequency, uint8_t volume) {
+    TEST_ASSERT_EQUAL_UINT32(start, tone->start);
+    TEST_ASSERT_EQUAL_UINT16(frequency, tone->frequency);
+    TEST_ASSERT_EQUAL_UINT8(volume, tone->volume);
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+buzzer_t buzzer;
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    buzzer = HostBuzzerCreate();
+    TEST_ASSERT_NOT_NULL(buzzer);
+}
+
+// Al crear el generador el zumbador queda en silencio y sin temporizador programado.
+void test_buzzer_starts_silent(void) {
+    const host_buzzer_tone_t * tones;
+
+    TEST_ASSERT_FALSE(BuzzerIsPlaying(buzzer));
+    TEST_ASSERT_FALSE(HostBuzzerIsScheduled());
+    HostBuzzerAdvance(1000);
+    TEST_ASSERT_EQUAL_UINT16(0, HostBuzzerTones(&tones));
+}
+
+// Una melodía sin repetición reproduce cada nota con su duración y termina en silencio.
+void test_buzzer_plays_melody_once(void) {
+    const host_buzzer_tone_t * tones;
+
+    BuzzerPlay(buzzer, &SHORT);
+    TEST_ASSERT_TRUE(BuzzerIsPlaying(buzzer));
+    HostBuzzerAdvance(1000);
+
+    TEST_ASSERT_EQUAL_UINT16(4, HostBuzzerTones(&tones));
+    AssertTone(&tones[0], 0, 1000, 50);
+    AssertTone(&tones[1], 20, 0, 0);
+    AssertTone(&tones[2], 50, 2000, 100);
+    AssertTone(&tones[3], 90, 0, 0);
+    TEST_ASSERT_FALSE(BuzzerIsPlaying(buzzer));
+    TEST_ASSERT_FALSE(HostBuzzerIsScheduled());
+}
+
+// Una melodía con repetición vuelve a la nota indicada al terminar.
+void test_buzzer_repeats_melody(void) {
+    const host_buzzer_tone_t * tones;
+
+    BuzzerPlay(buzzer, &LOOP);
+    HostBuzzerAdvance(20 + 2 * (30 + 40));
+
+    TEST_ASSERT_EQUAL_UINT16(6, HostBuzzerTones(&tones));
+    AssertTone(&tones[3], 90, 0, 0);
+    AssertTone(&tones[4], 120, 2000, 100);
+    AssertTone(&tones[5], 160, 0, 0);
+    TEST_ASSERT_TRUE(BuzzerIsPlaying(buzzer));
+}
+
+// Detener la melodía silencia el zumbador y cancela el temporizador.
+void test_buzzer_stop_silences(void) {
+    const host_buzzer_tone_t * tones;
+
+    BuzzerPlay(buzzer, &LOOP);
+    HostBuzzerAdvance(10);
+    BuzzerStop(buzzer);
+    TEST_ASSERT_FALSE(BuzzerIsPlaying(buzzer));
+    TEST_ASSERT_FALSE(HostBuzzerIsScheduled());
+    HostBuzzerAdvance(1000);
+
+    TEST_ASSERT_EQUAL_UINT16(2, HostBuzzerTones(&tones));
+    AssertTone(&tones[1], 10, 0, 0);
+
+    BuzzerStop(buzzer);
+    TEST_ASSERT_EQUAL_UINT16(2, HostBuzzerTones(&tones));
+}
+
+// Reproducir una melodía nueva la comienza desde su primera nota.
+void test_buzzer_play_restarts(void) {
+    const host_buzzer_tone_t * tones;
+
+    BuzzerPlay(buzzer, &SHORT);
+    HostBuzzerAdvance(60);
+    BuzzerPlay(buzzer, &LOOP);
+    HostBuzzerAdvance(10);
+
+    TEST_ASSERT_EQUAL_UINT16(4, HostBuzzerTones(&tones));
+    AssertTone(&tones[3], 60, 1000, 50);
+    HostBuzzerAdvance(10);
+    TEST_ASSERT_EQUAL_UINT16(5, HostBuzzerTones(&tones));
+    AssertTone(&tones[4], 80, 0, 0);
+}
+
+// La melodía creciente sube el volumen hasta el máximo y se repite con el volumen máximo.
+void test_buzzer_escalating_volume(void) {
+    const host_buzzer_tone_t * tones;
+    uint8_t volume = 0;
+    uint32_t period = 0;
+
+    for (uint8_t index = 0; index < BUZZER_MELODY_ESCALATING.count; index++) {
+        period += BUZZER_MELODY_ESCALATING.notes[index].duration;
+    }
+    BuzzerPlay(buzzer, &BUZZER_MELODY_ESCALATING);
+    HostBuzzerAdvance(period + 150);
+
+    uint16_t count = HostBuzzerTones(&tones);
+    TEST_ASSERT_EQUAL_UINT16(BUZZER_MELODY_ESCALATING.count + 2, count);
+    for (uint16_t index = 0; index < BUZZER_MELODY_ESCALATING.count; index++) {
+        if (tones[index].volume) {
+            TEST_ASSERT_TRUE(tones[index].volume >= volume);
+            volume = tones[index].volume;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(BUZZER_VOLUME_MAX, volume);
+    AssertTone(&tones[count - 2], period, tones[0].frequency, BUZZER_VOLUME_MAX);
+}
+
+// Las funciones aceptan un generador nulo sin hacer nada.
+void test_buzzer_null(void) {
+    TEST_ASSERT_NULL(BuzzerCreate(NULL));
+    BuzzerPlay(NULL, &SHORT);
+    BuzzerStop(NULL);
+    BuzzerStepElapsed(NULL);
+    TEST_ASSERT_FALSE(BuzzerIsPlaying(NULL));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
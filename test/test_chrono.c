@@ -0,0 +1,226 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_chrono.c
+ ** @brief Código fuente de las pruebas del temporizador de cuenta regresiva y del cronómetro
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "chrono.h"
+
+/**
+ - Al crear el cronómetro está detenido, en cero, y no avanza aunque pase el tiempo.
+ - El cronómetro en marcha cuenta el tiempo del contador y al detenerlo lo conserva y no cuenta el tiempo detenido.
+ - El cronómetro sólo lee el contador al consultarlo, y tolera el desborde del contador.
+ - La pantalla del cronómetro muestra segundos y centésimas, después minutos y segundos y después horas y minutos.
+ - El temporizador cuenta hacia atrás desde su duración, vence al llegar a cero y no baja de cero.
+ - El temporizador vencido no se vuelve a poner en marcha hasta volverlo al comienzo.
+ - La pantalla del temporizador redondea hacia arriba y muestra horas y minutos si falta más de una hora.
+ - Los parámetros inválidos y una instancia nula se rechazan sin fallar.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define TICKS_PER_SECOND 1000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief   Contador libre falso, cuenta las lecturas.
+ * @return  Valor actual del contador.
+ */
+static uint32_t FakeTicks(void);
+
+/**
+ * @brief       Verifica los dígitos que se muestran en la pantalla.
+ * @param self  El temporizador o cronómetro.
+ * @param value Dígitos esperados.
+ */
+static void AssertDigits(chrono_t self, const uint8_t value[4]);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static uint32_t ticks;
+
+static uint32_t reads;
+
+chrono_t chrono;
+
+/* === Private function implementation ========================================================= */
+
+static uint32_t FakeTicks(void) {
+    reads++;
+    return ticks;
+}
+
+static void AssertDigits(chrono_t self, const uint8_t value[4]) {
+    uint8_t digits[4];
+    ChronoToBCD(self, digits);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(value, digits, 4);
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    ticks = 12345;
+    reads = 0;
+    chrono = ChronoCreate(CHRONO_STOPWATCH, FakeTicks, TICKS_PER_SECOND);
+    TEST_ASSERT_NOT_NULL(chrono);
+}
+
+// Al crear el cronómetro está detenido, en cero, y no avanza aunque pase el tiempo.
+void test_stopwatch_starts_stopped(void) {
+    TEST_ASSERT_FALSE(ChronoIsRunning(chrono));
+    ticks += 5000;
+    TEST_ASSERT_EQUAL_UINT32(0, ChronoRead(chrono));
+    TEST_ASSERT_FALSE(ChronoExpired(chrono));
+    AssertDigits(chrono, (const uint8_t[]){0, 0, 0, 0});
+}
+
+// El cronómetro en marcha cuenta el tiempo del contador y al detenerlo lo conserva y no cuenta el tiempo detenido.
+void test_stopwatch_counts_running_time(void) {
+    ChronoStart(chrono);
+    TEST_ASSERT_TRUE(ChronoIsRunning(chrono));
+    ticks += 1234;
+    TEST_ASSERT_EQUAL_UINT32(123, ChronoRead(chrono));
+
+    ChronoStop(chrono);
+    ticks += 10000;
+    TEST_ASSERT_EQUAL_UINT32(123, ChronoRead(chrono));
+
+    ChronoStart(chrono);
+    ticks += 766;
+    TEST_ASSERT_EQUAL_UINT32(200, ChronoRead(chrono));
+
+    ChronoReset(chrono);
+    TEST_ASSERT_FALSE(ChronoIsRunning(chrono));
+    TEST_ASSERT_EQUAL_UINT32(0, ChronoRead(chrono));
+}
+
+// El cronómetro sólo lee el contador al consultarlo, y tolera el desborde del contador.
+void test_stopwatch_reads_counter_lazily(void) {
+    ticks = 0xFFFFFF00;
+    ChronoStart(chrono);
+    reads = 0;
+    ticks += 3 * TICKS_PER_SECOND; // El contador desborda mientras la cuenta está en marcha
+    TEST_ASSERT_EQUAL_UINT32(0, reads);
+    TEST_ASSERT_EQUAL_UINT32(300, ChronoRead(chrono));
+    TEST_ASSERT_EQUAL_UINT32(1, reads);
+}
+
+// La pantalla del cronómetro muestra segundos y centésimas, después minutos y segundos y después horas y minutos.
+void test_stopwatch_display_ranges(void) {
+    ChronoStart(chrono);
+    ticks += 59990;
+    AssertDigits(chrono, (const uint8_t[]){5, 9, 9, 9});
+    ticks += 10;
+    AssertDigits(chrono, (const uint8_t[]){0, 1, 0, 0});
+    ticks += 58 * 60000UL + 59000;
+    AssertDigits(chrono, (const uint8_t[]){5, 9, 5, 9});
+    ticks += 1000 + 12 * 60000UL;
+    AssertDigits(chrono, (const uint8_t[]){0, 1, 1, 2});
+}
+
+// El temporizador cuenta hacia atrás desde su duración, vence al llegar a cero y no baja de cero.
+void test_timer_counts_down_and_expires(void) {
+    chrono_t timer = ChronoCreate(CHRONO_TIMER, FakeTicks, TICKS_PER_SECOND);
+
+    ChronoSetCountdown(timer, 90);
+    TEST_ASSERT_EQUAL_UINT32(90, ChronoGetCountdown(timer));
+    TEST_ASSERT_EQUAL_UINT32(9000, ChronoRead(timer));
+    ChronoStart(timer);
+    ticks += 89990;
+    TEST_ASSERT_EQUAL_UINT32(1, ChronoRead(timer));
+    TEST_ASSERT_FALSE(ChronoExpired(timer));
+    ticks += 10;
+    TEST_ASSERT_TRUE(ChronoExpired(timer));
+    ticks += 5000;
+    TEST_ASSERT_EQUAL_UINT32(0, ChronoRead(timer));
+    AssertDigits(timer, (const uint8_t[]){0, 0, 0, 0});
+
+    // El cronómetro es una instancia distinta y no se ve afectado
+    TEST_ASSERT_EQUAL_UINT32(0, ChronoRead(chrono));
+}
+
+// El temporizador vencido no se vuelve a poner en marcha hasta volverlo al comienzo.
+void test_timer_restart_after_expire(void) {
+    chrono_t timer = ChronoCreate(CHRONO_TIMER, FakeTicks, TICKS_PER_SECOND);
+
+    ChronoSetCountdown(timer, 1);
+    ChronoStart(timer);
+    ticks += 2000;
+    ChronoStop(timer);
+    ChronoStart(timer);
+    TEST_ASSERT_FALSE(ChronoIsRunning(timer));
+
+    ChronoReset(timer);
+    TEST_ASSERT_EQUAL_UINT32(100, ChronoRead(timer));
+    ChronoStart(timer);
+    TEST_ASSERT_TRUE(ChronoIsRunning(timer));
+}
+
+// La pantalla del temporizador redondea hacia arriba y muestra horas y minutos si falta más de una hora.
+void test_timer_display_rounds_up(void) {
+    chrono_t timer = ChronoCreate(CHRONO_TIMER, FakeTicks, TICKS_PER_SECOND);
+
+    ChronoSetCountdown(timer, 2 * 3600 + 30);
+    AssertDigits(timer, (const uint8_t[]){0, 2, 0, 1});
+    ChronoStart(timer);
+    ticks += 30000;
+    AssertDigits(timer, (const uint8_t[]){0, 2, 0, 0});
+    ticks += 3601000UL;
+    AssertDigits(timer, (const uint8_t[]){5, 9, 5, 9});
+    ticks += 3598990UL;
+    AssertDigits(timer, (const uint8_t[]){0, 0, 0, 1});
+}
+
+// Los parámetros inválidos y una instancia nula se rechazan sin fallar.
+void test_invalid_parameters(void) {
+    uint8_t digits[4];
+
+    TEST_ASSERT_NULL(ChronoCreate(CHRONO_COUNT, FakeTicks, TICKS_PER_SECOND));
+    TEST_ASSERT_NULL(ChronoCreate(CHRONO_TIMER, NULL, TICKS_PER_SECOND));
+    TEST_ASSERT_NULL(ChronoCreate(CHRONO_TIMER, FakeTicks, 0));
+
+    ChronoSetCountdown(chrono, 10); // El cronómetro no tiene cuenta regresiva
+    TEST_ASSERT_EQUAL_UINT32(0, ChronoGetCountdown(chrono));
+
+    ChronoSetCountdown(NULL, 10);
+    ChronoStart(NULL);
+    ChronoStop(NULL);
+    ChronoReset(NULL);
+    ChronoToBCD(NULL, digits);
+    TEST_ASSERT_FALSE(ChronoIsRunning(NULL));
+    TEST_ASSERT_FALSE(ChronoExpired(NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, ChronoRead(NULL));
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, digits, 4);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -25,22 +25,68 @@ SPDX-License-Identifier: MIT
 
 #include "unity.h"
 #include "clock.h"
+#include "buzzer.h"
+#include "host_source.h"
 
 /**
  - Al inicializar el reloj está en 00:00 y con hora invalida.
  - Al ajustar la hora el reloj queda en hora y es válida.
+ - Una hora inválida se rechaza y el reloj conserva la hora anterior.
+ - La verificación de un arreglo de tiempos indica el primero inválido.
  - Después de n ciclos de reloj la hora avanza un segundo, diez segundos, un minutos, diez minutos,
   una hora, diez horas y un día completo.
  - Fijar la hora de la alarma y consultarla.
  - Fijar la alarma y avanzar el reloj para que suene.
  - Fijar la alarma, deshabilitarla y avanzar el reloj para no suene.
- - Hacer sonar la alarma y posponerla.
+ - Hacer sonar la alarma y posponerla, sin cambiar la hora de la alarma.
  - Hacer sonar la alarma y cancelarla hasta el otro dia.
+ - Avanzar en bloque da la misma hora que avanzar tick a tick, con y sin corrección del oscilador.
+ - Una corrección fuera de rango se rechaza.
+ - La corrección transitoria se suma a la del oscilador dentro del límite y no cambia la del oscilador.
+ - Calibrar con la medición de un día deja un error menor a un segundo en un mes, con cristal rápido o lento.
+ - Sincronizar con un contador libre no pierde tiempo aunque haya demoras largas entre llamadas.
+ - Sincronizar tolera el desborde del contador libre.
+ - Con una fuente con calendario el reloj toma la hora del hardware y no cuenta ticks.
+ - Si el calendario del hardware no tiene hora válida el reloj tampoco, y al ajustarla se escribe en el hardware.
+ - La fracción del segundo se interpola con el contador desde el último cambio de segundo del calendario.
+ - Con una fuente sin calendario el reloj avanza con los ticks de su contador.
+ - El instante UTC en milisegundos incluye los ticks pendientes y al ajustarlo el calendario conserva la fracción.
+ - Con la fuente del host el reloj avanza con el tiempo real.
+ - Cada día entre 1970 y CLOCK_MAX_YEAR se convierte a fecha y de vuelta igual que contando día por día.
+ - Los años bisiestos y los días de la semana de fechas conocidas son correctos.
+ - Al pasar la medianoche avanza la fecha, incluso el cambio de año.
+ - Avanzar en bloque varios años da la fecha exacta.
+ - La alarma suena sólo en los días de la semana habilitados.
+ - Con una fuente con calendario la fecha se lee y se escribe en el hardware.
+ - Un aplazamiento que cruza la medianoche suena a la hora exacta y al día siguiente la alarma suena a su hora.
+ - Un aplazamiento largo vence exactamente a los minutos pedidos.
+ - Los aplazamientos se acortan hasta el mínimo y se rechazan al llegar al límite.
+ - La alarma detenida no vuelve a sonar dentro del mismo minuto.
+ - La alarma desatendida se aplaza sola al vencer el tiempo de sonido y se detiene al agotar los aplazamientos.
+ - Sin tiempo de sonido la alarma suena hasta que se atiende.
+ - Con una zona horaria la hora, la fecha y el ajuste son locales y el calendario del hardware guarda UTC.
+ - Una zona con la diferencia o las reglas fuera de rango se rechaza y se conserva la anterior.
+ - Avanzando en bloque durante años la hora local cambia en el instante exacto de cada cambio de horario, en ambos
+  hemisferios.
+ - La alarma suena a la hora local después del cambio de horario y una sola vez en la hora que se repite.
  **/
 
 /* === Macros definitions ====================================================================== */
 
 #define CLOCK_TICKS_PER_SECOND 5
+
+//! Ticks por segundo de las simulaciones largas, como en el firmware
+#define MONTH_TICKS_PER_SECOND 1000
+
+//! Duración de las simulaciones largas en milisegundos reales
+#define MONTH_MS (30ULL * 24 * 60 * 60 * 1000)
+
+//! Duración de cada avance en bloque de las simulaciones largas en milisegundos reales
+#define MONTH_STEP_MS (60ULL * 60 * 1000)
+
+//! Años recorridos por las pruebas de los cambios de horario
+#define ZONE_FIRST_YEAR 2024
+#define ZONE_LAST_YEAR  2044
 #define TEST_ASSERT_TIME(hours_tens, hours_units, minutes_tens, minutes_units, seconds_tens, seconds_units, current_time) \
     clock_time_t current_time = {0}; \
     TEST_ASSERT_TRUE_MESSAGE(ClockGetTime(clock, &current_time), "Clock has invalid time"); \
@@ -61,7 +107,7 @@ SPDX-License-Identifier: MIT
  * @param clock     Reloj a simular.
  * @param seconds   Segundos a simular.
  */
-static void SimulateSeconds(clock_t clock, uint8_t seconds);
+static void SimulateSeconds(clock_t clock, uint32_t seconds);
 
 /**
  * @brief           Función para simular el avance del reloj en minutos.
@@ -69,7 +115,7 @@ static void SimulateSeconds(clock_t clock, uint8_t seconds);
  * @param clock     Reloj a simular.
  * @param minutes   Minutos a simular.
  */
-static void SimulateMinutes(clock_t clock, uint8_t minutes);
+static void SimulateMinutes(clock_t clock, uint32_t minutes);
 
 /**
  * @brief           Función para simular el avance del reloj en horas.
@@ -77,28 +123,78 @@ static void SimulateMinutes(clock_t clock, uint8_t minutes);
  * @param clock     Reloj a simular.
  * @param hours     Horas a simular.
  */
-static void SimulateHours(clock_t clock, uint8_t hours);
+static void SimulateHours(clock_t clock, uint32_t hours);
+
+/**
+ * @brief           Obtiene la hora actual del reloj en segundos desde el comienzo del día.
+ *
+ * @return          Segundos desde las 00:00:00.
+ */
+static uint32_t SecondsOfDay(void);
+
+/**
+ * @brief           Ticks generados por un oscilador con error hasta un instante real.
+ *
+ * @param ms        Milisegundos reales transcurridos.
+ * @param error_ppb Error del oscilador en partes por mil millones, positivo si adelanta.
+ * @return          Ticks generados por el oscilador.
+ */
+static uint64_t OscillatorTicks(uint64_t ms, int32_t error_ppb);
+
+/**
+ * @brief           Simula un mes avanzando el reloj en bloques de una hora real, desde las 00:00:00.
+ *
+ * @param error_ppb Error del oscilador en partes por mil millones, positivo si adelanta.
+ * @return          Error de la hora del reloj al final del mes, en segundos, positivo si adelanta.
+ */
+static int32_t SimulateMonth(int32_t error_ppb);
+
+/**
+ * @brief           Busca el día de un cambio de horario recorriendo el mes, como referencia para las pruebas.
+ *
+ * @param year      El año.
+ * @param change    La regla del cambio.
+ * @return          Días desde la época del día del cambio.
+ */
+static uint32_t ReferenceChangeDay(uint16_t year, const clock_dst_change_t * change);
+
+/**
+ * @brief           Avanza el reloj en bloque hasta un segundo UTC y verifica la hora local y la diferencia con UTC.
+ *
+ * @param now       Segundo UTC actual del reloj, se actualiza al avanzar.
+ * @param target    Segundo UTC al que se avanza.
+ * @param local     Segundos desde las 00:00:00 esperados en la hora local.
+ * @param offset    Diferencia esperada con UTC en minutos.
+ */
+static void AdvanceAndCheckLocal(uint32_t * now, uint32_t target, uint32_t local, int16_t offset);
+
+/**
+ * @brief           Recorre años de cambios de horario de una zona avanzando el reloj en bloque.
+ *
+ * @param zone      La zona horaria, el horario de verano debe comenzar y terminar en meses distintos.
+ */
+static void SweepZone(const clock_zone_t * zone);
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
-static void SimulateSeconds(clock_t clock, uint8_t seconds) {
-    for (uint8_t i = 0; i < CLOCK_TICKS_PER_SECOND * seconds; i++)
+static void SimulateSeconds(clock_t clock, uint32_t seconds) {
+    for (uint32_t i = 0; i < CLOCK_TICKS_PER_SECOND * seconds; i++)
     {
         ClockNewTick(clock);
     }
 }
 
-static void SimulateMinutes(clock_t clock, uint8_t minutes) {
-    for (uint8_t i = 0; i < CLOCK_TICKS_PER_SECOND * 60 * minutes; i++)
+static void SimulateMinutes(clock_t clock, uint32_t minutes) {
+    for (uint32_t i = 0; i < CLOCK_TICKS_PER_SECOND * 60 * minutes; i++)
     {
         ClockNewTick(clock);
     }
 }
 
-static void SimulateHours(clock_t clock, uint8_t hours) {
-    for (uint8_t i = 0; i < CLOCK_TICKS_PER_SECOND * 60 * 60 * hours; i++)
+static void SimulateHours(clock_t clock, uint32_t hours) {
+    for (uint32_t i = 0; i < CLOCK_TICKS_PER_SECOND * 60 * 60 * hours; i++)
     {
         ClockNewTick(clock);
     }
@@ -113,9 +209,90 @@ clock_t clock;
 
 /* === Private function implementation ========================================================= */
 
+static uint32_t SecondsOfDay(void) {
+    clock_time_t current_time = {0};
+
+    ClockGetTime(clock, &current_time);
+    return ((current_time.bcd[5] * 10 + current_time.bcd[4]) * 60 + current_time.bcd[3] * 10 + current_time.bcd[2]) *
+               60 +
+           current_time.bcd[1] * 10 + current_time.bcd[0];
+}
+
+static uint32_t ReferenceChangeDay(uint16_t year, const clock_dst_change_t * change) {
+    uint32_t found[5];
+    uint8_t count = 0;
+
+    for (uint8_t day = 1; day <= ClockDaysInMonth(year, change->month); day++) {
+        uint32_t days = ClockDateToDays(&(clock_date_t){.year = year, .month = change->month, .day = day});
+        if (ClockDaysToWeekday(days) == change->weekday) {
+            found[count++] = days;
+        }
+    }
+    return (change->week > count) ? found[count - 1] : found[change->week - 1];
+}
+
+static void AdvanceAndCheckLocal(uint32_t * now, uint32_t target, uint32_t local, int16_t offset) {
+    ClockAdvance(clock, (target - *now) * CLOCK_TICKS_PER_SECOND);
+    *now = target;
+    TEST_ASSERT_EQUAL_UINT32(local, SecondsOfDay());
+    TEST_ASSERT_EQUAL_INT16(offset, ClockGetUtcOffset(clock));
+}
+
+static void SweepZone(const clock_zone_t * zone) {
+    const int32_t standard = zone->offset_minutes * 60;
+    const int32_t dst = zone->dst_minutes * 60;
+    uint32_t now = ClockDateToDays(&(clock_date_t){.year = ZONE_FIRST_YEAR, .month = 1, .day = 1}) * 86400UL;
+    clock_date_t date;
+
+    // El reloj se ajusta en UTC y la zona se aplica después, así se conoce el segundo UTC sin leerlo del reloj
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetDate(clock, &(clock_date_t){.year = ZONE_FIRST_YEAR, .month = 1, .day = 1});
+    TEST_ASSERT_TRUE(ClockSetZone(clock, zone));
+
+    for (uint16_t year = ZONE_FIRST_YEAR; year <= ZONE_LAST_YEAR; year++) {
+        for (uint8_t index = 0; index < 2; index++) {
+            // En el hemisferio sur el horario de verano termina antes de comenzar dentro del mismo año
+            bool south = zone->start.month > zone->end.month;
+            bool starting = (index == 1) == south;
+            const clock_dst_change_t * change = starting ? &zone->start : &zone->end;
+            uint32_t day = ReferenceChangeDay(year, change);
+            uint32_t change_local = change->minutes * 60UL;
+            uint32_t change_utc = day * 86400UL + change_local - standard;
+            int16_t before = (int16_t)((standard + (starting ? 0 : dst)) / 60);
+            int16_t after = (int16_t)((standard + (starting ? dst : 0)) / 60);
+
+            // Un segundo antes del cambio rige la diferencia anterior, en el instante del cambio la nueva
+            AdvanceAndCheckLocal(&now, change_utc - 1,
+                                 (change_local + (starting ? 0 : dst) + 86400UL - 1) % 86400UL, before);
+            AdvanceAndCheckLocal(&now, change_utc, change_local + (starting ? dst : 0), after);
+            ClockGetDate(clock, &date);
+            TEST_ASSERT_EQUAL_UINT16(year, date.year);
+            TEST_ASSERT_EQUAL_UINT8(change->month, date.month);
+            TEST_ASSERT_EQUAL_UINT8(change->weekday, ClockGetWeekday(clock));
+        }
+    }
+}
+
+static uint64_t OscillatorTicks(uint64_t ms, int32_t error_ppb) {
+    return (uint64_t)((int64_t)ms + ((int64_t)ms * error_ppb) / 1000000000LL);
+}
+
+static int32_t SimulateMonth(int32_t error_ppb) {
+    ClockSetTime(clock, &(clock_time_t){0});
+    for (uint64_t ms = 0; ms < MONTH_MS; ms += MONTH_STEP_MS) {
+        ClockAdvance(clock, (uint32_t)(OscillatorTicks(ms + MONTH_STEP_MS, error_ppb) - OscillatorTicks(ms, error_ppb)));
+    }
+
+    // El mes tiene días completos, así que la hora correcta es 00:00:00
+    int32_t error = (int32_t)SecondsOfDay();
+    return (error > 43200) ? error - 86400 : error;
+}
+
 /* === Public function implementation ========================================================= */
 
 void setUp(void) {
+    HostSourceFakeReset(0);
     clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
 }
 
@@ -124,7 +301,6 @@ void test_set_up_with_invalid_time(void) {
     clock_time_t current_time = {.bcd = {1, 2, 3, 4, 5, 6}};
 
     clock_t clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
-    TEST_ASSERT_FALSE(ClockTimeIsValid(clock));
     TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
     TEST_ASSERT_EACH_EQUAL_UINT8(0, current_time.bcd, 6);
 }
@@ -146,6 +322,27 @@ void test_set_up_with_valid_time(void) {
     TEST_ASSERT_TIME(1, 4, 0, 3, 5, 2, current_time);
 }
 
+// Una hora inválida se rechaza y el reloj conserva la hora anterior
+void test_set_invalid_time_keeps_previous(void) {
+    ClockSetTime(clock, &(clock_time_t){.bcd = {2, 5, 3, 0, 4, 1}});
+    TEST_ASSERT_FALSE(ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 4, 2}}));
+    TEST_ASSERT_TIME(1, 4, 0, 3, 5, 2, current_time);
+}
+
+// La verificación de un arreglo de tiempos indica el primero inválido
+void test_times_are_valid(void) {
+    static const clock_time_t times[] = {
+        {.bcd = {9, 5, 9, 5, 3, 2}},
+        {.bcd = {0, 0, 0, 0, 0, 0}},
+        {.bcd = {0, 6, 0, 0, 0, 0}},
+        {.bcd = {0, 0, 0, 0, 0, 0}},
+    };
+
+    TEST_ASSERT_EQUAL_UINT16(2, ClockTimesAreValid(times, 4));
+    TEST_ASSERT_EQUAL_UINT16(2, ClockTimesAreValid(times, 2));
+    TEST_ASSERT_EQUAL_UINT16(0, ClockTimesAreValid(times, 0));
+}
+
 // Después de n ciclos de reloj la hora avanza un segundo
 void test_clock_advance_one_second(void) {
     //clock_time_t current_time = {0};
@@ -234,18 +431,65 @@ void test_clock_alarm_postpone(void) {
             .hours = {0, 0},
         }
     };
+    clock_time_t current_alarm;
+
     ClockSetTime(clock, &(clock_time_t){0});
     ClockEnableAlarm(clock, true);
     ClockSetAlarm(clock, &alarm_time);
-    SimulateMinutes(clock, 5);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
     TEST_ASSERT_TRUE(ClockPostponeAlarm(clock, 5));
     // Verificar que la alarma se pospuso correctamente
-    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    SimulateMinutes(clock, 4);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
     // Verificar que la alarma suene después de posponerla
-    SimulateMinutes(clock, 5);
+    SimulateMinutes(clock, 1);
     TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
-    // Volver a la alarma original
+    // La hora de la alarma no cambia
+    ClockGetAlarm(clock, &current_alarm);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(alarm_time.bcd, current_alarm.bcd, 6);
+}
+
+// La demora de la alarma cuenta hasta su minuto, hasta el aplazamiento automático de la alarma que suena y hasta el
+// vencimiento del aplazamiento.
+void test_clock_alarm_delay(void) {
+    static const clock_time_t alarm_time = {
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {5, 0},
+            .hours = {2, 1},
+        }
+    };
+    static const clock_time_t new_time = {
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {3, 0},
+            .hours = {2, 1},
+        }
+    };
+    ClockSetTime(clock, &new_time);
     ClockSetAlarm(clock, &alarm_time);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_DEADLINE, ClockAlarmDelay(clock));
+    ClockEnableAlarm(clock, true);
+    TEST_ASSERT_EQUAL_UINT32(120 * CLOCK_TICKS_PER_SECOND, ClockAlarmDelay(clock));
+    ClockNewTick(clock);
+    TEST_ASSERT_EQUAL_UINT32(120 * CLOCK_TICKS_PER_SECOND - 1, ClockAlarmDelay(clock));
+
+    SimulateSeconds(clock, 120);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_NO_DEADLINE, ClockAlarmDelay(clock)); // Suena hasta que se atiende
+    ClockSetRingTimeout(clock, 60);
+    ClockStopAlarm(clock);
+    ClockPostponeAlarm(clock, 5);
+    TEST_ASSERT_EQUAL_UINT32(5 * 60 * CLOCK_TICKS_PER_SECOND - 1, ClockAlarmDelay(clock));
+
+    SimulateSeconds(clock, 5 * 60);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_EQUAL_UINT32(60 * CLOCK_TICKS_PER_SECOND - 1, ClockAlarmDelay(clock));
+
+    // Atendida, vuelve a sonar al día siguiente
+    ClockStopAlarm(clock);
+    TEST_ASSERT_EQUAL_UINT32((24 * 60 - 5) * 60 * CLOCK_TICKS_PER_SECOND - 1, ClockAlarmDelay(clock));
 }
 
 // Hacer sonar la alarma y cancelarla hasta el otro dia
@@ -260,7 +504,7 @@ void test_clock_cancel_alarm_until_next_day(void) {
     ClockSetTime(clock, &(clock_time_t){0});
     ClockEnableAlarm(clock, true);
     ClockSetAlarm(clock, &alarm_time);
-    SimulateMinutes(clock, 5);
+    SimulateSeconds(clock, 5); // La alarma se verifica dentro de su minuto, como en el firmware
     TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
     ClockEnableAlarm(clock, false);
     ClockEnableAlarm(clock, true);
@@ -269,6 +513,615 @@ void test_clock_cancel_alarm_until_next_day(void) {
     TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
 }
 
+// Avanzar en bloque da la misma hora que avanzar tick a tick, con y sin corrección del oscilador.
+void test_clock_bulk_advance_matches_single_ticks(void) {
+    static const int32_t trims[] = {0, 9999, -7777};
+
+    for (uint8_t index = 0; index < sizeof(trims) / sizeof(trims[0]); index++) {
+        clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+        ClockSetTime(clock, &(clock_time_t){0});
+        TEST_ASSERT_TRUE(ClockSetTrim(clock, trims[index]));
+        for (uint32_t tick = 0; tick < 43210; tick++) {
+            ClockNewTick(clock);
+        }
+        uint32_t single = SecondsOfDay();
+
+        clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+        ClockSetTime(clock, &(clock_time_t){0});
+        ClockSetTrim(clock, trims[index]);
+        ClockAdvance(clock, 43210 - 1234);
+        ClockAdvance(clock, 1234);
+        TEST_ASSERT_EQUAL_UINT32(single, SecondsOfDay());
+    }
+    TEST_ASSERT_EQUAL_UINT32((43210 - 336) / CLOCK_TICKS_PER_SECOND, SecondsOfDay());
+}
+
+// Una corrección fuera de rango se rechaza.
+void test_clock_trim_out_of_range(void) {
+    TEST_ASSERT_TRUE(ClockSetTrim(clock, -CLOCK_TRIM_LIMIT_PPM));
+    TEST_ASSERT_FALSE(ClockSetTrim(clock, CLOCK_TRIM_LIMIT_PPM + 1));
+    TEST_ASSERT_EQUAL_INT32(-CLOCK_TRIM_LIMIT_PPM, ClockGetTrim(clock));
+    TEST_ASSERT_FALSE(ClockCalibrate(clock, 0, 1000));
+    TEST_ASSERT_FALSE(ClockCalibrate(clock, 1000, 1100));
+}
+
+// La corrección transitoria se suma a la del oscilador dentro del límite y no cambia la del oscilador.
+void test_clock_slew_adds_to_trim(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    TEST_ASSERT_TRUE(ClockSetTrim(clock, 5000));
+    TEST_ASSERT_TRUE(ClockSetSlew(clock, 5000));
+    TEST_ASSERT_EQUAL_INT32(5000, ClockGetTrim(clock));
+    ClockAdvance(clock, 100 * CLOCK_TICKS_PER_SECOND); // Adelanta 1 %
+    TEST_ASSERT_EQUAL_UINT32(101, SecondsOfDay());
+
+    TEST_ASSERT_TRUE(ClockSetSlew(clock, CLOCK_TRIM_LIMIT_PPM));
+    ClockAdvance(clock, 100 * CLOCK_TICKS_PER_SECOND); // La suma se limita a CLOCK_TRIM_LIMIT_PPM
+    TEST_ASSERT_EQUAL_UINT32(202, SecondsOfDay());
+
+    TEST_ASSERT_FALSE(ClockSetSlew(clock, CLOCK_TRIM_LIMIT_PPM + 1));
+    TEST_ASSERT_TRUE(ClockSetSlew(clock, 0));
+    ClockAdvance(clock, 100 * CLOCK_TICKS_PER_SECOND); // Sólo la corrección del oscilador, 0,5 %
+    TEST_ASSERT_EQUAL_UINT32(302, SecondsOfDay());
+    TEST_ASSERT_EQUAL_INT32(5000, ClockGetTrim(clock));
+}
+
+// Calibrar con la medición de un día deja un error menor a un segundo en un mes, con cristal rápido.
+void test_clock_calibrated_fast_crystal_month(void) {
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    TEST_ASSERT_INT32_WITHIN(1, 97, SimulateMonth(37300));
+
+    TEST_ASSERT_TRUE(ClockCalibrate(clock, (uint32_t)OscillatorTicks(86400000, 37300), 86400000));
+    TEST_ASSERT_EQUAL_INT32(-37, ClockGetTrim(clock));
+    TEST_ASSERT_INT32_WITHIN(1, 0, SimulateMonth(37300));
+}
+
+// Calibrar con la medición de un día deja un error menor a un segundo en un mes, con cristal lento.
+void test_clock_calibrated_slow_crystal_month(void) {
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    TEST_ASSERT_INT32_WITHIN(1, -33, SimulateMonth(-12600));
+
+    TEST_ASSERT_TRUE(ClockCalibrate(clock, (uint32_t)OscillatorTicks(86400000, -12600), 86400000));
+    TEST_ASSERT_EQUAL_INT32(13, ClockGetTrim(clock));
+    TEST_ASSERT_INT32_WITHIN(1, 0, SimulateMonth(-12600));
+}
+
+// Sincronizar con un contador libre no pierde tiempo aunque haya demoras largas entre llamadas.
+void test_clock_sync_survives_stalls(void) {
+    static const uint32_t stalls[] = {1, 1, 1, 250, 1, 5000, 1, 61000, 100, 1000, 37};
+    uint32_t counter = 0;
+    uint32_t advanced = 0;
+    uint32_t seed = 12345;
+
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    while (counter < 2 * 60 * 60 * MONTH_TICKS_PER_SECOND) {
+        // Período pseudoaleatorio, con demoras largas intercaladas
+        seed = seed * 1103515245 + 12345;
+        counter += stalls[(seed >> 16) % (sizeof(stalls) / sizeof(stalls[0]))];
+        advanced += ClockSync(clock, counter);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(counter, advanced);
+    TEST_ASSERT_EQUAL_UINT32(counter / MONTH_TICKS_PER_SECOND, SecondsOfDay());
+    TEST_ASSERT_EQUAL_UINT32(0, ClockSync(clock, counter));
+}
+
+// Sincronizar tolera el desborde del contador libre.
+void test_clock_sync_counter_wrap(void) {
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockSync(clock, 0xFFFFFFFFu - 499);
+    ClockSetTime(clock, &(clock_time_t){0});
+
+    TEST_ASSERT_EQUAL_UINT32(3000, ClockSync(clock, 2500));
+    TEST_ASSERT_EQUAL_UINT32(3, SecondsOfDay());
+}
+
+// Ajustar la hora la cambia en una sección crítica y descarta los ticks que todavía no se contaron.
+void test_clock_set_time_inside_critical_section(void) {
+    ClockAttachSource(clock, HostSourceFakeCounter());
+    host_fake.ticks += CLOCK_TICKS_PER_SECOND - 1;
+    host_fake.critical_entries = 0;
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_EQUAL_UINT32(1, host_fake.critical_entries);
+    TEST_ASSERT_EQUAL_UINT8(0, host_fake.critical);
+
+    host_fake.ticks += CLOCK_TICKS_PER_SECOND - 1;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT32(0, SecondsOfDay());
+    host_fake.ticks += 1;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT32(1, SecondsOfDay());
+}
+
+// La actualización con la fuente y las lecturas de la hora se hacen en la sección crítica, así otra tarea no ve la hora
+// con el acarreo a medio propagar.
+void test_clock_refresh_and_read_inside_critical_section(void) {
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    host_fake.critical_entries = 0;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT32(1, host_fake.critical_entries);
+    ClockGetTime(clock, &(clock_time_t){0});
+    ClockGetDate(clock, &(clock_date_t){0});
+    TEST_ASSERT_EQUAL_UINT32(3, host_fake.critical_entries);
+    TEST_ASSERT_EQUAL_UINT8(0, host_fake.critical);
+}
+
+// Con una fuente con calendario el reloj toma la hora del hardware y no cuenta ticks.
+void test_clock_reads_hardware_calendar(void) {
+    host_fake.ticks = 12345;
+    host_fake.seconds = (13 * 60 + 45) * 60 + 7;
+    host_fake.valid = true;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    TEST_ASSERT_TIME(1, 3, 4, 5, 0, 7, current_time);
+
+    host_fake.ticks += 100000;
+    TEST_ASSERT_EQUAL_UINT32(100000, ClockRefresh(clock));
+    TEST_ASSERT_EQUAL_UINT32(host_fake.seconds, SecondsOfDay());
+    host_fake.seconds++;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT32(host_fake.seconds, SecondsOfDay());
+}
+
+// Si el calendario del hardware no tiene hora válida el reloj tampoco, y al ajustarla se escribe en el hardware.
+void test_clock_writes_hardware_calendar(void) {
+    static const clock_time_t new_time = {.time = {.seconds = {3, 2}, .minutes = {1, 0}, .hours = {0, 0}}};
+    clock_time_t current_time;
+
+    host_fake.ticks = 0;
+    host_fake.seconds = 0;
+    host_fake.valid = false;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &new_time));
+    TEST_ASSERT_TRUE(host_fake.valid);
+    TEST_ASSERT_EQUAL_UINT32(83, host_fake.seconds);
+    ClockRefresh(clock);
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+}
+
+// La fracción del segundo se interpola con el contador desde el último cambio de segundo del calendario.
+void test_clock_interpolates_subsecond(void) {
+    host_fake.ticks = 500;
+    host_fake.seconds = 10;
+    host_fake.valid = true;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    TEST_ASSERT_EQUAL_UINT16(0, ClockGetSubsecond(clock));
+
+    host_fake.ticks = 900;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT16(400, ClockGetSubsecond(clock));
+
+    host_fake.ticks = 1250;
+    host_fake.seconds = 11;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT16(0, ClockGetSubsecond(clock));
+
+    host_fake.ticks = 1600;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT16(350, ClockGetSubsecond(clock));
+
+    // Si el calendario se demora la fracción no llega al segundo siguiente
+    host_fake.ticks = 3000;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT16(MONTH_TICKS_PER_SECOND - 1, ClockGetSubsecond(clock));
+    TEST_ASSERT_EQUAL_UINT32(11, SecondsOfDay());
+}
+
+// Con una fuente sin calendario el reloj avanza con los ticks de su contador.
+void test_clock_counter_source(void) {
+    host_fake.ticks = 777;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCounter());
+    ClockSetTime(clock, &(clock_time_t){0});
+
+    host_fake.ticks += 90 * MONTH_TICKS_PER_SECOND + 250;
+    TEST_ASSERT_EQUAL_UINT32(90 * MONTH_TICKS_PER_SECOND + 250, ClockRefresh(clock));
+    TEST_ASSERT_EQUAL_UINT32(90, SecondsOfDay());
+    TEST_ASSERT_EQUAL_UINT16(250, ClockGetSubsecond(clock));
+}
+
+// El instante UTC en milisegundos incluye los ticks pendientes y al ajustarlo el calendario conserva la fracción.
+void test_clock_utc_millis(void) {
+    host_fake.ticks = 0;
+    host_fake.seconds = 0;
+    host_fake.valid = false;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+
+    TEST_ASSERT_TRUE(ClockSetUtcMillis(clock, 1741953600250ULL));
+    TEST_ASSERT_TRUE(host_fake.valid);
+    TEST_ASSERT_EQUAL_UINT32(1741953600, host_fake.seconds);
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_EQUAL_UINT64(1741953600250ULL, ClockGetUtcMillis(clock));
+
+    host_fake.ticks += MONTH_TICKS_PER_SECOND / 2;
+    TEST_ASSERT_EQUAL_UINT64(1741953600750ULL, ClockGetUtcMillis(clock));
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT64(1741953600750ULL, ClockGetUtcMillis(clock));
+
+    // Al comenzar el segundo siguiente se vuelve a escribir el calendario, que empieza a contarlo en ese momento
+    host_fake.ticks += MONTH_TICKS_PER_SECOND / 4;
+    ClockRefresh(clock);
+    TEST_ASSERT_EQUAL_UINT32(1741953601, host_fake.seconds);
+    TEST_ASSERT_EQUAL_UINT64(1741953601000ULL, ClockGetUtcMillis(clock));
+
+    TEST_ASSERT_FALSE(ClockSetUtcMillis(clock, (uint64_t)UINT32_MAX * 1000));
+    TEST_ASSERT_EQUAL_UINT32(1741953601, host_fake.seconds);
+}
+
+// Con la fuente del host el reloj avanza con el tiempo real.
+void test_clock_host_monotonic_source(void) {
+    clock = ClockCreate(HOST_SOURCE_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceMonotonic());
+    ClockSetTime(clock, &(clock_time_t){0});
+
+    HostSourceSleep(30);
+    uint32_t elapsed = ClockRefresh(clock);
+    TEST_ASSERT_GREATER_OR_EQUAL(30, elapsed);
+    TEST_ASSERT_LESS_THAN(1000, elapsed);
+}
+
+// Cada día entre 1970 y CLOCK_MAX_YEAR se convierte a fecha y de vuelta igual que contando día por día.
+void test_clock_date_round_trip(void) {
+    static const uint8_t month_days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    clock_date_t expected = {.year = CLOCK_EPOCH_YEAR, .month = 1, .day = 1};
+    clock_date_t date;
+    uint32_t days = 0;
+
+    while (expected.year <= CLOCK_MAX_YEAR) {
+        ClockDaysToDate(days, &date);
+        TEST_ASSERT_EQUAL_UINT16(expected.year, date.year);
+        TEST_ASSERT_EQUAL_UINT8(expected.month, date.month);
+        TEST_ASSERT_EQUAL_UINT8(expected.day, date.day);
+        TEST_ASSERT_TRUE(ClockDateIsValid(&expected));
+        TEST_ASSERT_EQUAL_UINT32(days, ClockDateToDays(&expected));
+        TEST_ASSERT_EQUAL_UINT8((days + 4) % 7, ClockDaysToWeekday(days));
+
+        bool leap = ((expected.year % 4) == 0) && (((expected.year % 100) != 0) || ((expected.year % 400) == 0));
+        uint8_t last = month_days[expected.month - 1] + ((expected.month == 2) && leap);
+        if (++expected.day > last) {
+            expected.day = 1;
+            if (++expected.month > 12) {
+                expected.month = 1;
+                expected.year++;
+            }
+        }
+        days++;
+    }
+}
+
+// Los años bisiestos y los días de la semana de fechas conocidas son correctos.
+void test_clock_known_dates(void) {
+    TEST_ASSERT_TRUE(ClockDateIsValid(&(clock_date_t){.year = 2000, .month = 2, .day = 29}));
+    TEST_ASSERT_TRUE(ClockDateIsValid(&(clock_date_t){.year = 2024, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(ClockDateIsValid(&(clock_date_t){.year = 2023, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(ClockDateIsValid(&(clock_date_t){.year = 2100, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(ClockDateIsValid(&(clock_date_t){.year = 2024, .month = 4, .day = 31}));
+    TEST_ASSERT_FALSE(ClockDateIsValid(&(clock_date_t){.year = 2024, .month = 13, .day = 1}));
+    TEST_ASSERT_FALSE(ClockDateIsValid(&(clock_date_t){.year = 1969, .month = 12, .day = 31}));
+
+    TEST_ASSERT_EQUAL_UINT8(4, ClockDaysToWeekday(0));
+    TEST_ASSERT_EQUAL_UINT32(19782, ClockDateToDays(&(clock_date_t){.year = 2024, .month = 2, .day = 29}));
+    TEST_ASSERT_EQUAL_UINT8(4, ClockDaysToWeekday(19782));
+    TEST_ASSERT_EQUAL_UINT8(6, ClockDaysToWeekday(ClockDateToDays(&(clock_date_t){.year = 2000, .month = 1, .day = 1})));
+}
+
+// Al pasar la medianoche avanza la fecha, incluso el cambio de año.
+void test_clock_date_rolls_over_at_midnight(void) {
+    clock_date_t date;
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &(clock_date_t){.year = 2023, .month = 12, .day = 31}));
+    TEST_ASSERT_EQUAL_UINT8(0, ClockGetWeekday(clock));
+
+    ClockAdvance(clock, (86400UL - 1) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_EQUAL_UINT8(0, ClockGetWeekday(clock));
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TIME(0, 0, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2024, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(1, ClockGetWeekday(clock));
+
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(clock_date_t){.year = 2023, .month = 2, .day = 29}));
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_UINT16(2024, date.year);
+}
+
+// Avanzar en bloque varios años da la fecha exacta.
+void test_clock_bulk_advance_years(void) {
+    clock_date_t date;
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 2, 1}});
+    ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 2, .day = 28});
+
+    // Diez años con tres 29 de febrero en el medio, más un segundo
+    ClockAdvance(clock, (3653UL * 86400 + 1) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 1, current_time);
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_UINT16(2034, date.year);
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(28, date.day);
+    TEST_ASSERT_EQUAL_UINT8(2, ClockGetWeekday(clock));
+}
+
+// La alarma suena sólo en los días de la semana habilitados.
+void test_clock_weekday_alarm(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetDate(clock, &(clock_date_t){.year = 2023, .month = 12, .day = 31});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 1, 0}});
+    ClockSetAlarmWeekdays(clock, 1u << 1); // Sólo los lunes
+    ClockEnableAlarm(clock, true);
+
+    ClockAdvance(clock, 3600UL * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+
+    ClockAdvance(clock, 86400UL * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+}
+
+// Con una fuente con calendario la fecha se lee y se escribe en el hardware.
+void test_clock_hardware_calendar_date(void) {
+    clock_date_t date;
+
+    host_fake.ticks = 0;
+    host_fake.seconds = 19782UL * 86400 + 3600;
+    host_fake.valid = true;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    TEST_ASSERT_TIME(0, 1, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2024, date.year);
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(29, date.day);
+
+    ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 3, .day = 1});
+    TEST_ASSERT_EQUAL_UINT32(19783UL * 86400 + 3600, host_fake.seconds);
+}
+
+// Un aplazamiento que cruza la medianoche suena a la hora exacta y al día siguiente la alarma suena a su hora.
+void test_clock_snooze_across_midnight(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 8, 5, 3, 2}});
+    ClockEnableAlarm(clock, true);
+    ClockAdvance(clock, (23UL * 3600 + 58 * 60) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+
+    TEST_ASSERT_TRUE(ClockPostponeAlarm(clock, 5));
+    ClockAdvance(clock, (5 * 60 - 1) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    ClockAdvance(clock, CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_TIME(0, 0, 0, 3, 0, 0, current_time);
+
+    ClockStopAlarm(clock);
+    ClockAdvance(clock, (23UL * 3600 + 55 * 60) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+}
+
+// Un aplazamiento largo vence exactamente a los minutos pedidos.
+void test_clock_long_postpone(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){0});
+    ClockEnableAlarm(clock, true);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+
+    TEST_ASSERT_TRUE(ClockPostponeAlarm(clock, 1000));
+    ClockAdvance(clock, (1000UL * 60 - 1) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    ClockAdvance(clock, CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_FALSE(ClockPostponeAlarm(clock, 0));
+}
+
+// Los aplazamientos se acortan hasta el mínimo y se rechazan al llegar al límite.
+void test_clock_snooze_escalation_and_limit(void) {
+    static const uint16_t expected[] = {5, 3, 2};
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){0});
+    ClockEnableAlarm(clock, true);
+    TEST_ASSERT_FALSE(ClockSetSnooze(clock, &(clock_snooze_t){.minutes = 0, .min_minutes = 1}));
+    TEST_ASSERT_TRUE(ClockSetSnooze(clock, &(clock_snooze_t){.minutes = 5, .step = 2, .min_minutes = 2, .limit = 3}));
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+
+    for (uint8_t index = 0; index < 3; index++) {
+        TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock));
+        TEST_ASSERT_EQUAL_UINT8(index + 1, ClockGetSnoozeCount(clock));
+        ClockAdvance(clock, (expected[index] * 60UL - 1) * CLOCK_TICKS_PER_SECOND);
+        TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+        ClockAdvance(clock, CLOCK_TICKS_PER_SECOND);
+        TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    }
+    TEST_ASSERT_FALSE(ClockSnoozeAlarm(clock));
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+}
+
+// La alarma detenida no vuelve a sonar dentro del mismo minuto.
+void test_clock_stopped_alarm_stays_quiet(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){0});
+    ClockEnableAlarm(clock, true);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    ClockSnoozeAlarm(clock);
+
+    ClockStopAlarm(clock);
+    TEST_ASSERT_EQUAL_UINT8(0, ClockGetSnoozeCount(clock));
+    ClockAdvance(clock, 30 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    ClockAdvance(clock, 10 * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+}
+
+// La alarma desatendida se aplaza sola al vencer el tiempo de sonido y se detiene al agotar los aplazamientos.
+void test_clock_unattended_alarm_stops(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){0});
+    ClockEnableAlarm(clock, true);
+    ClockSetSnooze(clock, &(clock_snooze_t){.minutes = 5, .min_minutes = 5, .limit = 2});
+    ClockSetRingTimeout(clock, 60);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+
+    for (uint8_t snooze = 1; snooze <= 2; snooze++) {
+        ClockAdvance(clock, 59 * CLOCK_TICKS_PER_SECOND);
+        TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+        ClockAdvance(clock, CLOCK_TICKS_PER_SECOND);
+        TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+        TEST_ASSERT_EQUAL_UINT8(snooze, ClockGetSnoozeCount(clock));
+        ClockAdvance(clock, 5 * 60 * CLOCK_TICKS_PER_SECOND);
+        TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    }
+    ClockAdvance(clock, 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    ClockAdvance(clock, 3600UL * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+
+    // Al día siguiente vuelve a sonar a la hora ajustada
+    ClockAdvance(clock, (86400UL - 3600 - 3 * 60 - 10 * 60) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+}
+
+// Sin tiempo de sonido la alarma suena hasta que se atiende.
+void test_clock_alarm_without_timeout_keeps_ringing(void) {
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){0});
+    ClockEnableAlarm(clock, true);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    ClockAdvance(clock, 10 * 3600UL * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_EQUAL_UINT8(0, ClockGetSnoozeCount(clock));
+}
+
+// Con una zona horaria la hora, la fecha y el ajuste son locales y el calendario del hardware guarda UTC.
+void test_clock_zone_applied_on_read(void) {
+    clock_date_t date;
+
+    host_fake.ticks = 0;
+    host_fake.seconds = 19783UL * 86400 + 3600; // 2024-03-01 01:00:00 UTC
+    host_fake.valid = true;
+    clock = ClockCreate(MONTH_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    TEST_ASSERT_TRUE(ClockSetZone(clock, &(clock_zone_t){.offset_minutes = -180}));
+    TEST_ASSERT_EQUAL_INT16(-180, ClockGetUtcOffset(clock));
+
+    TEST_ASSERT_TIME(2, 2, 0, 0, 0, 0, current_time);
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(29, date.day);
+    TEST_ASSERT_EQUAL_UINT8(4, ClockGetWeekday(clock));
+
+    // La hora ajustada es local y mantiene la fecha local
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 0, 3, 3, 2}});
+    TEST_ASSERT_EQUAL_UINT32(19783UL * 86400 + 2 * 3600 + 30 * 60, host_fake.seconds);
+    ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 3, .day = 2});
+    TEST_ASSERT_EQUAL_UINT32(19785UL * 86400 + 2 * 3600 + 30 * 60, host_fake.seconds);
+
+    // Al volver a UTC la hora local cambia y la hora del hardware no
+    TEST_ASSERT_TRUE(ClockSetZone(clock, NULL));
+    TEST_ASSERT_EQUAL_INT16(0, ClockGetUtcOffset(clock));
+    ClockRefresh(clock);
+    TEST_ASSERT_TIME(0, 2, 3, 0, 0, 0, utc_time);
+}
+
+// Una zona con la diferencia o las reglas fuera de rango se rechaza y se conserva la anterior.
+void test_clock_invalid_zone_is_rejected(void) {
+    const clock_dst_change_t change = {.month = 3, .week = CLOCK_DST_LAST_WEEK, .weekday = 0, .minutes = 120};
+
+    TEST_ASSERT_TRUE(ClockSetZone(clock, &(clock_zone_t){.offset_minutes = 330}));
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 2, 1}});
+    TEST_ASSERT_FALSE(ClockSetZone(clock, &(clock_zone_t){.offset_minutes = CLOCK_ZONE_LIMIT_MINUTES + 1}));
+    TEST_ASSERT_FALSE(
+        ClockSetZone(clock, &(clock_zone_t){.dst_minutes = CLOCK_DST_LIMIT_MINUTES + 1, .start = change, .end = change}));
+    TEST_ASSERT_FALSE(ClockSetZone(clock, &(clock_zone_t){.dst_minutes = 60, .start = change,
+                                                          .end = {.month = 13, .week = 1, .minutes = 120}}));
+    TEST_ASSERT_FALSE(ClockSetZone(clock, &(clock_zone_t){.dst_minutes = 60, .start = change,
+                                                          .end = {.month = 10, .week = 6, .minutes = 120}}));
+    TEST_ASSERT_FALSE(ClockSetZone(clock, &(clock_zone_t){.dst_minutes = 60, .start = change,
+                                                          .end = {.month = 10, .week = 1, .minutes = 24 * 60}}));
+    TEST_ASSERT_EQUAL_INT16(330, ClockGetUtcOffset(clock));
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 0, current_time);
+}
+
+// Avanzando en bloque durante años la hora local cambia en el instante exacto de cada cambio de horario, en ambos
+// hemisferios.
+void test_clock_dst_transitions_sweep(void) {
+    // Europa central: último domingo de marzo y de octubre, a las 02:00 de la hora estándar
+    SweepZone(&(clock_zone_t){
+        .offset_minutes = 60,
+        .dst_minutes = 60,
+        .start = {.month = 3, .week = CLOCK_DST_LAST_WEEK, .weekday = 0, .minutes = 120},
+        .end = {.month = 10, .week = CLOCK_DST_LAST_WEEK, .weekday = 0, .minutes = 120},
+    });
+
+    // Este de Estados Unidos: segundo domingo de marzo a las 02:00, primer domingo de noviembre a las 02:00 de verano
+    SweepZone(&(clock_zone_t){
+        .offset_minutes = -300,
+        .dst_minutes = 60,
+        .start = {.month = 3, .week = 2, .weekday = 0, .minutes = 120},
+        .end = {.month = 11, .week = 1, .weekday = 0, .minutes = 60},
+    });
+
+    // Hemisferio sur: primer domingo de septiembre a primer domingo de abril, a la medianoche
+    SweepZone(&(clock_zone_t){
+        .offset_minutes = -240,
+        .dst_minutes = 60,
+        .start = {.month = 9, .week = 1, .weekday = 0, .minutes = 0},
+        .end = {.month = 4, .week = 1, .weekday = 0, .minutes = 0},
+    });
+}
+
+// La alarma suena a la hora local después del cambio de horario y una sola vez en la hora que se repite.
+void test_clock_alarm_across_dst(void) {
+    const clock_zone_t zone = {
+        .offset_minutes = 60,
+        .dst_minutes = 60,
+        .start = {.month = 3, .week = CLOCK_DST_LAST_WEEK, .weekday = 0, .minutes = 120},
+        .end = {.month = 10, .week = CLOCK_DST_LAST_WEEK, .weekday = 0, .minutes = 120},
+    };
+
+    // El 2024-03-31 comienza el horario de verano, la alarma de las 07:00 suena a las 05:00 UTC
+    ClockSetZone(clock, &zone);
+    ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 3, .day = 30});
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 8, 0}});
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 7, 0}});
+    ClockEnableAlarm(clock, true);
+    ClockAdvance(clock, (22UL * 3600 - 1) * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+    ClockAdvance(clock, CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    TEST_ASSERT_TIME(0, 7, 0, 0, 0, 0, current_time);
+    ClockStopAlarm(clock);
+
+    // El 2024-10-27 la hora entre las 02:00 y las 03:00 se repite, la alarma de las 02:30 suena una sola vez
+    ClockSetAlarm(clock, &(clock_time_t){.bcd = {0, 0, 0, 3, 2, 0}});
+    ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 10, .day = 27});
+    ClockSetTime(clock, &(clock_time_t){.bcd = {0, 0, 0, 0, 2, 0}});
+    TEST_ASSERT_EQUAL_INT16(120, ClockGetUtcOffset(clock));
+    ClockAdvance(clock, 30UL * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+    ClockStopAlarm(clock);
+    ClockAdvance(clock, 3600UL * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_EQUAL_INT16(60, ClockGetUtcOffset(clock));
+    TEST_ASSERT_TIME(0, 2, 3, 0, 0, 0, repeated_time);
+    TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
@@ -0,0 +1,234 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_clock_properties.c
+ ** @brief Código fuente de las pruebas exhaustivas de la aritmética del reloj contra un modelo entero
+ **
+ ** Cada prueba recorre todo el espacio de entrada y compara con un modelo que cuenta segundos o minutos como un
+ ** número entero. Los ticks se avanzan en bloque con ClockAdvance y sólo el último tick de cada segundo pasa por
+ ** ClockNewTick, por lo que el conjunto completo termina en menos de un segundo y se ejecuta en cada compilación.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "config.h"
+#include "app.h"
+#include "clock.h"
+#include "buzzer.h"
+#include "chrono.h"
+#include "screen.h"
+#include "persist.h"
+#include "mock_digital.h"
+
+/**
+ - Para cada velocidad de ticks, cada uno de los 86400 segundos del día avanza al siguiente con el último tick del
+   segundo, y la medianoche avanza la fecha.
+ - ClockTimeIsValid acepta exactamente las horas válidas entre todas las combinaciones de seis dígitos decimales, y
+   rechaza cualquier dígito mayor a nueve.
+ - Posponer la alarma desde cada minuto del día la hace sonar exactamente a los minutos pedidos.
+ - IncreaseBCD y DecreaseBCD recorren en forma circular todos los valores de horas y de minutos.
+ - Cada segundo del día se empaqueta y se desempaqueta sin cambios, y el incremento empaquetado da el segundo
+   siguiente, indicando el cambio de día sólo a la medianoche.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define SECONDS_PER_DAY 86400UL
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief           Convierte segundos desde el comienzo del día a un tiempo en BCD, modelo de referencia.
+ * @param seconds   Segundos desde las 00:00:00.
+ * @return          El tiempo en BCD.
+ */
+static clock_time_t ModelTime(uint32_t seconds);
+
+/**
+ * @brief           Convierte un valor de dos dígitos BCD a entero.
+ * @param digits    Unidades en [0] y decenas en [1].
+ * @return          El valor entero.
+ */
+static uint8_t ModelValue(const uint8_t digits[2]);
+
+/* === Private variable declarations =========================================================== */
+
+//! Velocidades de ticks representativas, desde un tick por segundo hasta el máximo del contador
+static const uint16_t TICK_RATES[] = {1, 2, 5, 10, 100, 1000, 1024, 65535};
+
+//! Duraciones de los aplazamientos, alrededor de los cambios de hora y de día
+static const uint16_t POSTPONES[] = {1, 5, 59, 60, 61, 719, 1439, 1440, 1441, 65535};
+
+static const uint8_t MINUTES_LIMIT[] = {5, 9};
+
+static const uint8_t HOURS_LIMIT[] = {2, 3};
+
+/* === Private function declarations =========================================================== */
+
+static clock_time_t ModelTime(uint32_t seconds) {
+    clock_time_t time = {0};
+
+    time.time.seconds[0] = seconds % 10;
+    time.time.seconds[1] = (seconds / 10) % 6;
+    time.time.minutes[0] = (seconds / 60) % 10;
+    time.time.minutes[1] = (seconds / 600) % 6;
+    time.time.hours[0] = (seconds / 3600) % 10;
+    time.time.hours[1] = (seconds / 36000);
+    return time;
+}
+
+static uint8_t ModelValue(const uint8_t digits[2]) {
+    return (uint8_t)(digits[1] * 10 + digits[0]);
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+clock_t clock;
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    DigitalOutputGroupWrite_Ignore();
+}
+
+// Para cada velocidad de ticks, cada segundo del día avanza al siguiente con el último tick y la medianoche avanza la fecha.
+void test_properties_new_tick_rollover(void) {
+    clock_time_t current;
+    clock_date_t date;
+
+    for (uint8_t rate = 0; rate < sizeof(TICK_RATES) / sizeof(TICK_RATES[0]); rate++) {
+        clock = ClockCreate(TICK_RATES[rate]);
+        ClockSetTime(clock, &(clock_time_t){0});
+
+        for (uint32_t second = 0; second < SECONDS_PER_DAY; second++) {
+            clock_time_t expected = ModelTime(second);
+            ClockAdvance(clock, TICK_RATES[rate] - 1);
+            ClockGetTime(clock, &current);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.bcd, current.bcd, 6);
+
+            expected = ModelTime((second + 1) % SECONDS_PER_DAY);
+            ClockNewTick(clock);
+            ClockGetTime(clock, &current);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.bcd, current.bcd, 6);
+        }
+        ClockGetDate(clock, &date);
+        TEST_ASSERT_EQUAL_UINT8(2, date.day);
+    }
+}
+
+// ClockTimeIsValid acepta exactamente las horas válidas entre todas las combinaciones de seis dígitos decimales.
+void test_properties_time_is_valid(void) {
+    clock_time_t time;
+    uint32_t accepted = 0;
+
+    clock = ClockCreate(1);
+    for (uint32_t number = 0; number < 1000000; number++) {
+        uint32_t rest = number;
+        for (uint8_t digit = 0; digit < 6; digit++) {
+            time.bcd[digit] = rest % 10;
+            rest /= 10;
+        }
+        bool expected = (time.time.seconds[1] < 6) && (time.time.minutes[1] < 6) && (ModelValue(time.time.hours) < 24);
+        TEST_ASSERT_EQUAL(expected, ClockTimeIsValid(&time));
+        TEST_ASSERT_EQUAL(expected, ClockSetTime(clock, &time));
+        accepted += expected;
+    }
+    TEST_ASSERT_EQUAL_UINT32(SECONDS_PER_DAY, accepted);
+
+    // Cualquier dígito fuera del rango decimal se rechaza, aunque el resto de la hora sea válido
+    for (uint8_t digit = 0; digit < 6; digit++) {
+        for (uint16_t value = 10; value < 256; value++) {
+            time = (clock_time_t){0};
+            time.bcd[digit] = (uint8_t)value;
+            TEST_ASSERT_FALSE(ClockTimeIsValid(&time));
+        }
+    }
+}
+
+// Posponer la alarma desde cada minuto del día la hace sonar exactamente a los minutos pedidos.
+void test_properties_postpone_alarm(void) {
+    for (uint32_t minute = 0; minute < 1440; minute++) {
+        for (uint8_t index = 0; index < sizeof(POSTPONES) / sizeof(POSTPONES[0]); index++) {
+            clock_time_t start = ModelTime(minute * 60);
+
+            clock = ClockCreate(1);
+            ClockSetTime(clock, &start);
+            ClockSetAlarmWeekdays(clock, 0); // Sólo suena por el aplazamiento
+            ClockEnableAlarm(clock, true);
+
+            TEST_ASSERT_TRUE(ClockPostponeAlarm(clock, POSTPONES[index]));
+            ClockAdvance(clock, POSTPONES[index] * 60UL - 1);
+            TEST_ASSERT_FALSE(ClockCheckAlarm(clock));
+            ClockAdvance(clock, 1);
+            TEST_ASSERT_TRUE(ClockCheckAlarm(clock));
+
+            clock_time_t expected = ModelTime((minute + POSTPONES[index]) % 1440 * 60);
+            clock_time_t current;
+            ClockGetTime(clock, &current);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.bcd, current.bcd, 6);
+        }
+    }
+}
+
+// IncreaseBCD y DecreaseBCD recorren en forma circular todos los valores de horas y de minutos.
+void test_properties_increase_decrease_bcd(void) {
+    static const uint8_t * const limits[] = {HOURS_LIMIT, MINUTES_LIMIT};
+    static const uint8_t modules[] = {24, 60};
+
+    for (uint8_t field = 0; field < 2; field++) {
+        for (uint8_t value = 0; value < modules[field]; value++) {
+            uint8_t digits[2] = {value % 10, value / 10};
+            IncreaseBCD(digits, limits[field]);
+            TEST_ASSERT_EQUAL_UINT8((value + 1) % modules[field], ModelValue(digits));
+
+            digits[0] = value % 10;
+            digits[1] = value / 10;
+            DecreaseBCD(digits, limits[field]);
+            TEST_ASSERT_EQUAL_UINT8((value + modules[field] - 1) % modules[field], ModelValue(digits));
+        }
+    }
+}
+
+// Cada segundo del día se empaqueta y se desempaqueta sin cambios, y el incremento empaquetado da el segundo siguiente.
+void test_properties_packed_increment(void) {
+    clock_time_t current;
+    bool next_day;
+
+    for (uint32_t second = 0; second < SECONDS_PER_DAY; second++) {
+        clock_time_t time = ModelTime(second);
+        clock_packed_t packed = ClockTimePack(&time);
+        ClockTimeUnpack(packed, &current);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(time.bcd, current.bcd, 6);
+
+        clock_time_t expected = ModelTime((second + 1) % SECONDS_PER_DAY);
+        ClockTimeUnpack(ClockPackedIncrement(packed, &next_day), &current);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.bcd, current.bcd, 6);
+        TEST_ASSERT_EQUAL(second == SECONDS_PER_DAY - 1, next_day);
+    }
+    TEST_ASSERT_EQUAL_HEX32(0x123456, ClockTimePack(&(clock_time_t){.bcd = {6, 5, 4, 3, 2, 1}}));
+    TEST_ASSERT_EQUAL_HEX32(0x000000, ClockPackedIncrement(0x235959, NULL));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
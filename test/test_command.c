@@ -0,0 +1,365 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_command.c
+ ** @brief Código fuente de las pruebas de los comandos del reloj por el enlace serie
+ **
+ ** Los pedidos se envían desde el lado de la PC de una pseudoterminal y las respuestas se leen de ella, por lo que se
+ ** prueban juntos el enlace serie, el intérprete de comandos y la aplicación, como con la placa conectada.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "config.h"
+#include "command.h"
+#include "serial.h"
+#include "timesync.h"
+#include "idle.h"
+#include "app.h"
+#include "clock.h"
+#include "buzzer.h"
+#include "chrono.h"
+#include "screen.h"
+#include "persist.h"
+#include "record.h"
+#include "trace.h"
+#include "host_uart.h"
+#include "host_screen.h"
+#include "mock_digital.h"
+#include <string.h>
+
+/**
+ - Un ping responde la versión del protocolo.
+ - Ajustar la hora con el reloj sin hora válida la ajusta, pasa a mostrarla y se lee igual.
+ - Una hora fuera de rango se rechaza con COMMAND_ERROR_VALUE y el reloj no cambia.
+ - La alarma ajustada por el enlace se lee igual y queda habilitada en el reloj.
+ - Un comando desconocido o con la longitud incorrecta se rechaza con el motivo.
+ - Los contadores cuentan los bytes, las tramas y las tramas con error recibidas.
+ - Varios pedidos enviados juntos se responden en orden.
+ - Con una función de traslado los ajustes se ejecutan en CommandApply y las lecturas no se trasladan.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define CLOCK_TICKS_PER_SECOND 1000
+
+//! Tiempo límite para recibir los bytes por la pseudoterminal
+#define UART_TIMEOUT_MS 200
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief           Envía un pedido desde la PC, armando la trama sin usar el módulo del enlace.
+ * @param command   Comando del pedido.
+ * @param payload   Datos del pedido.
+ * @param length    Cantidad de bytes de datos.
+ */
+static void SendRequest(uint8_t command, const uint8_t * payload, uint8_t length);
+
+/**
+ * @brief           Entrega al reloj los bytes recibidos y ejecuta los pedidos completos.
+ * @param expected  Cantidad de pedidos que se deben ejecutar.
+ */
+static void ProcessRequests(uint16_t expected);
+
+/**
+ * @brief           Recibe en la PC una respuesta y verifica su marca de comienzo, su comando y su suma.
+ * @param command   Comando esperado.
+ * @param payload   Datos recibidos.
+ * @return          Cantidad de bytes de datos recibidos.
+ */
+static uint8_t ReadReply(uint8_t command, uint8_t payload[SERIAL_PAYLOAD_MAX]);
+
+/**
+ * @brief           Recibe una respuesta de error y verifica el comando rechazado y el motivo.
+ * @param command   Comando rechazado.
+ * @param error     Motivo esperado.
+ */
+static void AssertError(uint8_t command, command_error_t error);
+
+/**
+ * @brief           Traslado falso a la tarea de la aplicación: ejecuta el ajuste pendiente en el momento.
+ */
+static void FakeDefer(void);
+
+/**
+ * @brief           Lee un número de 32 bits con el byte bajo primero.
+ * @param data      Bytes del número.
+ * @return          El número.
+ */
+static uint32_t GetWord(const uint8_t * data);
+
+/* === Private variable declarations =========================================================== */
+
+//! Pedido para ajustar el 14 de marzo de 2025 a las 12:34:56
+static const uint8_t SET_TIME[] = {0xE9, 0x07, 3, 14, 12, 34, 56};
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+//!< Variables globales para la aplicación bajo prueba
+clock_t clock;
+struct board_s board;
+app_t app;
+serial_t serial;
+command_t command;
+
+/* === Private variable definitions ============================================================ */
+
+//! Cantidad de ajustes trasladados a la tarea de la aplicación
+static uint8_t deferred;
+
+/* === Private function implementation ========================================================= */
+
+static void SendRequest(uint8_t command, const uint8_t * payload, uint8_t length) {
+    uint8_t frame[SERIAL_PAYLOAD_MAX + SERIAL_FRAME_OVERHEAD] = {SERIAL_SYNC, command, length};
+    uint16_t sum = 0;
+    uint16_t sum_of_sums = 0;
+
+    memcpy(&frame[3], payload, length);
+    for (uint8_t index = 1; index < length + 3; index++) {
+        sum = (sum + frame[index]) % 255;
+        sum_of_sums = (sum_of_sums + sum) % 255;
+    }
+    frame[length + 3] = (uint8_t)sum;
+    frame[length + 4] = (uint8_t)sum_of_sums;
+    HostUartPeerWrite(frame, length + SERIAL_FRAME_OVERHEAD);
+}
+
+static void ProcessRequests(uint16_t expected) {
+    uint16_t executed = 0;
+
+    for (uint8_t attempt = 0; (attempt < 10) && (executed < expected); attempt++) {
+        HostUartPoll(serial, UART_TIMEOUT_MS / 10);
+        executed += CommandProcess(command);
+    }
+    TEST_ASSERT_EQUAL_UINT16(expected, executed);
+}
+
+static uint8_t ReadReply(uint8_t command, uint8_t payload[SERIAL_PAYLOAD_MAX]) {
+    uint8_t header[3];
+    uint8_t check[2];
+    uint16_t sum = 0;
+    uint16_t sum_of_sums = 0;
+
+    TEST_ASSERT_EQUAL_UINT16(sizeof(header), HostUartPeerRead(header, sizeof(header), UART_TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_HEX8(SERIAL_SYNC, header[0]);
+    TEST_ASSERT_EQUAL_HEX8(command, header[1]);
+    TEST_ASSERT_TRUE(header[2] <= SERIAL_PAYLOAD_MAX);
+    TEST_ASSERT_EQUAL_UINT16(header[2], HostUartPeerRead(payload, header[2], UART_TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(check), HostUartPeerRead(check, sizeof(check), UART_TIMEOUT_MS));
+
+    for (uint8_t index = 1; index < 3 + header[2]; index++) {
+        sum = (sum + (index < 3 ? header[index] : payload[index - 3])) % 255;
+        sum_of_sums = (sum_of_sums + sum) % 255;
+    }
+    TEST_ASSERT_EQUAL_HEX8(sum, check[0]);
+    TEST_ASSERT_EQUAL_HEX8(sum_of_sums, check[1]);
+    return header[2];
+}
+
+static void AssertError(uint8_t command, command_error_t error) {
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+
+    TEST_ASSERT_EQUAL_UINT8(2, ReadReply(COMMAND_ERROR, payload));
+    TEST_ASSERT_EQUAL_HEX8(command, payload[0]);
+    TEST_ASSERT_EQUAL_UINT8(error, payload[1]);
+}
+
+static void FakeDefer(void) {
+    deferred++;
+    CommandApply(command);
+}
+
+static uint32_t GetWord(const uint8_t * data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    DigitalOutputGroupWrite_Ignore();
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    if (board.screen == NULL) {
+        board.screen = HostScreenCreate(4);
+    }
+    app = AppCreate(clock, &board);
+    TEST_ASSERT_TRUE(HostUartOpen());
+    serial = SerialCreate(HostUartWrite);
+    command = CommandCreate(serial, app, clock);
+}
+
+void tearDown(void) {
+    HostUartClose();
+}
+
+// Un ping responde la versión del protocolo.
+void test_ping_replies_version(void) {
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+
+    SendRequest(COMMAND_PING, NULL, 0);
+    ProcessRequests(1);
+    TEST_ASSERT_EQUAL_UINT8(1, ReadReply(COMMAND_PING | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8(COMMAND_VERSION, payload[0]);
+}
+
+// Ajustar la hora con el reloj sin hora válida la ajusta, pasa a mostrarla y se lee igual.
+void test_set_time_from_unset_mode(void) {
+    const uint8_t expected[] = {0xE9, 0x07, 3, 14, 12, 34, 56, 5, 1};
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+    clock_time_t time;
+
+    TEST_ASSERT_EQUAL(CLOCK_MODE_UNSET_TIME, AppGetMode(app));
+    SendRequest(COMMAND_SET_TIME, SET_TIME, sizeof(SET_TIME));
+    ProcessRequests(1);
+    TEST_ASSERT_EQUAL_UINT8(0, ReadReply(COMMAND_SET_TIME | COMMAND_REPLY, payload));
+
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){6, 5, 4, 3, 2, 1}), time.bcd, 6);
+
+    SendRequest(COMMAND_GET_TIME, NULL, 0);
+    ProcessRequests(1);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(expected), ReadReply(COMMAND_GET_TIME | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, payload, sizeof(expected));
+}
+
+// Una hora fuera de rango se rechaza con COMMAND_ERROR_VALUE y el reloj no cambia.
+void test_set_time_out_of_range(void) {
+    const uint8_t hours[] = {0xE9, 0x07, 3, 14, 24, 0, 0};
+    const uint8_t seconds[] = {0xE9, 0x07, 3, 14, 12, 0, 200};
+    const uint8_t month[] = {0xE9, 0x07, 13, 14, 12, 0, 0};
+
+    SendRequest(COMMAND_SET_TIME, hours, sizeof(hours));
+    SendRequest(COMMAND_SET_TIME, seconds, sizeof(seconds));
+    SendRequest(COMMAND_SET_TIME, month, sizeof(month));
+    ProcessRequests(3);
+    AssertError(COMMAND_SET_TIME, COMMAND_ERROR_VALUE);
+    AssertError(COMMAND_SET_TIME, COMMAND_ERROR_VALUE);
+    AssertError(COMMAND_SET_TIME, COMMAND_ERROR_VALUE);
+
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_EQUAL(CLOCK_MODE_UNSET_TIME, AppGetMode(app));
+}
+
+// La alarma ajustada por el enlace se lee igual y queda habilitada en el reloj.
+void test_set_and_get_alarm(void) {
+    const uint8_t alarm[] = {7, 30, 0x3E, 1};
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+    clock_time_t time;
+
+    SendRequest(COMMAND_SET_ALARM, alarm, sizeof(alarm));
+    SendRequest(COMMAND_GET_ALARM, NULL, 0);
+    ProcessRequests(2);
+    TEST_ASSERT_EQUAL_UINT8(0, ReadReply(COMMAND_SET_ALARM | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(alarm), ReadReply(COMMAND_GET_ALARM | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(alarm, payload, sizeof(alarm));
+
+    TEST_ASSERT_TRUE(ClockAlarmIsEnabled(clock));
+    TEST_ASSERT_EQUAL_HEX8(0x3E, ClockGetAlarmWeekdays(clock));
+    ClockGetAlarm(clock, &time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 0, 3, 7, 0}), time.bcd, 6);
+
+    SendRequest(COMMAND_SET_ALARM, (const uint8_t[]){7, 30, 0x80, 1}, 4);
+    ProcessRequests(1);
+    AssertError(COMMAND_SET_ALARM, COMMAND_ERROR_VALUE);
+    TEST_ASSERT_EQUAL_HEX8(0x3E, ClockGetAlarmWeekdays(clock));
+}
+
+// Un comando desconocido o con la longitud incorrecta se rechaza con el motivo.
+void test_unknown_command_and_wrong_length(void) {
+    SendRequest(0x00, NULL, 0);
+    SendRequest(COMMAND_COUNT, NULL, 0);
+    SendRequest(COMMAND_PING, (const uint8_t[]){1}, 1);
+    SendRequest(COMMAND_SET_TIME, SET_TIME, sizeof(SET_TIME) - 1);
+    ProcessRequests(4);
+    AssertError(0x00, COMMAND_ERROR_UNKNOWN);
+    AssertError(COMMAND_COUNT, COMMAND_ERROR_UNKNOWN);
+    AssertError(COMMAND_PING, COMMAND_ERROR_LENGTH);
+    AssertError(COMMAND_SET_TIME, COMMAND_ERROR_LENGTH);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_UNSET_TIME, AppGetMode(app));
+}
+
+// Los contadores cuentan los bytes, las tramas y las tramas con error recibidas.
+void test_stats_count_frames_and_errors(void) {
+    const uint8_t corrupted[] = {SERIAL_SYNC, COMMAND_PING, 0, 0x00, 0x00};
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+
+    SendRequest(COMMAND_PING, NULL, 0);
+    HostUartPeerWrite(corrupted, sizeof(corrupted));
+    SendRequest(COMMAND_GET_STATS, NULL, 0);
+    ProcessRequests(2);
+    ReadReply(COMMAND_PING | COMMAND_REPLY, payload);
+
+    TEST_ASSERT_EQUAL_UINT8(32, ReadReply(COMMAND_GET_STATS | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT32(3 * SERIAL_FRAME_OVERHEAD, GetWord(&payload[0]));
+    TEST_ASSERT_EQUAL_UINT32(0, GetWord(&payload[4]));
+    TEST_ASSERT_EQUAL_UINT32(2, GetWord(&payload[8]));
+    TEST_ASSERT_EQUAL_UINT32(1, GetWord(&payload[12]));
+    TEST_ASSERT_EQUAL_UINT32(TraceDropped(), GetWord(&payload[16]));
+    TEST_ASSERT_EQUAL_INT32(ClockGetTrim(clock), (int32_t)GetWord(&payload[20]));
+    TEST_ASSERT_EQUAL_UINT32(IDLE_UNKNOWN, GetWord(&payload[24])); // Sin tarea inactiva asociada
+    TEST_ASSERT_EQUAL_UINT32(IDLE_UNKNOWN, GetWord(&payload[28]));
+}
+
+// Varios pedidos enviados juntos se responden en orden.
+void test_pipelined_requests_reply_in_order(void) {
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+
+    SendRequest(COMMAND_SET_TIME, SET_TIME, sizeof(SET_TIME));
+    SendRequest(COMMAND_GET_TIME, NULL, 0);
+    SendRequest(COMMAND_PING, NULL, 0);
+    SendRequest(COMMAND_GET_ALARM, NULL, 0);
+    ProcessRequests(4);
+    TEST_ASSERT_EQUAL_UINT8(0, ReadReply(COMMAND_SET_TIME | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8(9, ReadReply(COMMAND_GET_TIME | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8(12, payload[4]);
+    TEST_ASSERT_EQUAL_UINT8(1, payload[8]);
+    TEST_ASSERT_EQUAL_UINT8(1, ReadReply(COMMAND_PING | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8(4, ReadReply(COMMAND_GET_ALARM | COMMAND_REPLY, payload));
+}
+
+// Con una función de traslado los ajustes se ejecutan en CommandApply y las lecturas no se trasladan.
+void test_app_requests_are_deferred(void) {
+    const uint8_t bad_alarm[] = {100, 0, 0, 1};
+    uint8_t payload[SERIAL_PAYLOAD_MAX];
+
+    CommandAttachDefer(command, FakeDefer);
+    deferred = 0;
+    CommandApply(command); // Sin un ajuste pendiente no hace nada
+    TEST_ASSERT_EQUAL(CLOCK_MODE_UNSET_TIME, AppGetMode(app));
+
+    SendRequest(COMMAND_SET_TIME, SET_TIME, sizeof(SET_TIME));
+    SendRequest(COMMAND_GET_TIME, NULL, 0);
+    SendRequest(COMMAND_SET_ALARM, bad_alarm, sizeof(bad_alarm));
+    ProcessRequests(3);
+    TEST_ASSERT_EQUAL_UINT8(2, deferred);
+    TEST_ASSERT_EQUAL(CLOCK_MODE_DISPLAY, AppGetMode(app));
+    TEST_ASSERT_EQUAL_UINT8(0, ReadReply(COMMAND_SET_TIME | COMMAND_REPLY, payload));
+    TEST_ASSERT_EQUAL_UINT8(9, ReadReply(COMMAND_GET_TIME | COMMAND_REPLY, payload));
+    AssertError(COMMAND_SET_ALARM, COMMAND_ERROR_VALUE);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,140 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_digital.c
+ ** @brief Código fuente de las pruebas de las entradas y salidas digitales, sobre el GPIO simulado en el host
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "digital.h"
+#include "host_gpio.h"
+
+/**
+ - Al crear una salida el pin queda configurado como salida y en el nivel inactivo.
+ - Activar o desactivar una salida que ya tiene ese estado no escribe el registro.
+ - La escritura en grupo hace una escritura por puerto y nivel con las salidas que cambian.
+ - La escritura en grupo no toca las salidas fuera de la máscara ni escribe si nada cambia.
+ - La escritura en grupo mantiene el estado de cada salida para las escrituras individuales.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+//! Cantidad de salidas de las pruebas, todas las que se pueden crear
+#define OUTPUTS 3
+
+//! Puerto de las dos salidas activas en alto
+#define PORT_HIGH 5
+
+//! Puerto de la salida activa en bajo
+#define PORT_LOW 1
+
+//! Pin de la salida activa en bajo
+#define PIN_LOW 11
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/* === Private variable declarations =========================================================== */
+
+//! Salidas de las pruebas: dos activas en alto en un puerto y una activa en bajo en otro
+static digital_output_t outputs[OUTPUTS];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Public function definitions ============================================================= */
+
+void setUp(void) {
+    // Las salidas se reservan en memoria estática y no se liberan, se crean en la primera prueba
+    if (!outputs[0]) {
+        HostGpioReset();
+        outputs[0] = DigitalOutputCreate(PORT_HIGH, 0, true);
+        outputs[1] = DigitalOutputCreate(PORT_HIGH, 1, true);
+        outputs[2] = DigitalOutputCreate(PORT_LOW, PIN_LOW, false);
+    }
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x7, 0);
+    HostGpioClearWrites();
+}
+
+// Al crear una salida el pin queda configurado como salida y en el nivel inactivo.
+void test_create_configures_inactive_output(void) {
+    TEST_ASSERT_EQUAL_HEX32(0x3, HostGpioOutputs(PORT_HIGH));
+    TEST_ASSERT_EQUAL_HEX32(1UL << PIN_LOW, HostGpioOutputs(PORT_LOW));
+    TEST_ASSERT_EQUAL_HEX32(0, HostGpioLevels(PORT_HIGH));
+    TEST_ASSERT_EQUAL_HEX32(1UL << PIN_LOW, HostGpioLevels(PORT_LOW));
+    TEST_ASSERT_FALSE(DigitalOutputGetState(outputs[0]));
+}
+
+// Activar o desactivar una salida que ya tiene ese estado no escribe el registro.
+void test_unchanged_output_is_not_written(void) {
+    DigitalOutputActivate(outputs[0]);
+    DigitalOutputActivate(outputs[0]);
+    TEST_ASSERT_EQUAL(1, HostGpioWrites());
+    TEST_ASSERT_EQUAL_HEX32(0x1, HostGpioLevels(PORT_HIGH));
+
+    DigitalOutputDeactivate(outputs[0]);
+    DigitalOutputDeactivate(outputs[0]);
+    TEST_ASSERT_EQUAL(2, HostGpioWrites());
+    TEST_ASSERT_EQUAL_HEX32(0, HostGpioLevels(PORT_HIGH));
+}
+
+// La escritura en grupo hace una escritura por puerto y nivel con las salidas que cambian.
+void test_group_write_once_per_port_and_level(void) {
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x7, 0x7);
+    TEST_ASSERT_EQUAL(2, HostGpioWrites());
+    TEST_ASSERT_EQUAL_HEX32(0x3, HostGpioLevels(PORT_HIGH));
+    TEST_ASSERT_EQUAL_HEX32(0, HostGpioLevels(PORT_LOW));
+
+    // Una salida se enciende y otra se apaga en el mismo puerto: una escritura para cada nivel
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x3, 0x1);
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x3, 0x2);
+    TEST_ASSERT_EQUAL(5, HostGpioWrites());
+    TEST_ASSERT_EQUAL_HEX32(0x2, HostGpioLevels(PORT_HIGH));
+}
+
+// La escritura en grupo no toca las salidas fuera de la máscara ni escribe si nada cambia.
+void test_group_write_skips_masked_and_unchanged(void) {
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x1, 0x7);
+    TEST_ASSERT_EQUAL(1, HostGpioWrites());
+    TEST_ASSERT_EQUAL_HEX32(0x1, HostGpioLevels(PORT_HIGH));
+    TEST_ASSERT_EQUAL_HEX32(1UL << PIN_LOW, HostGpioLevels(PORT_LOW));
+
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x7, 0x1);
+    TEST_ASSERT_EQUAL(1, HostGpioWrites());
+}
+
+// La escritura en grupo mantiene el estado de cada salida para las escrituras individuales.
+void test_group_write_updates_cached_state(void) {
+    DigitalOutputGroupWrite(outputs, OUTPUTS, 0x4, 0x4);
+    TEST_ASSERT_TRUE(DigitalOutputGetState(outputs[2]));
+
+    DigitalOutputActivate(outputs[2]);
+    TEST_ASSERT_EQUAL(1, HostGpioWrites());
+    DigitalOutputDeactivate(outputs[2]);
+    TEST_ASSERT_EQUAL(2, HostGpioWrites());
+    TEST_ASSERT_EQUAL_HEX32(1UL << PIN_LOW, HostGpioLevels(PORT_LOW));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
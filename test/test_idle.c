@@ -0,0 +1,213 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_idle.c
+ ** @brief Código fuente de las pruebas de la tarea inactiva
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "idle.h"
+#include <string.h>
+
+/**
+ - Antes de completar el primer segundo la fracción de tiempo inactivo es desconocida.
+ - Cada segundo se calcula la fracción del tiempo que durmió el procesador y se guarda la menor.
+ - Si el procesador no durmió durante más de un segundo la fracción se calcula sobre toda la ventana.
+ - Los trabajos diferidos se ejecutan de a uno por vez y por turno, antes de dormir.
+ - Se registran hasta IDLE_JOBS_MAX trabajos y los parámetros inválidos se rechazan sin fallar.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define CYCLES_PER_SECOND 1000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief   Contador de ciclos falso.
+ * @return  Valor actual del contador.
+ */
+static uint32_t FakeNow(void);
+
+/**
+ * @brief   Duerme el procesador falso durante sleep_cycles ciclos.
+ * @return  Ciclos que durmió.
+ */
+static uint32_t FakeSleep(void);
+
+/**
+ * @brief   Trabajo diferido que guarda el orden de ejecución.
+ */
+static void FirstJob(void);
+
+/**
+ * @brief   Trabajo diferido que guarda el orden de ejecución.
+ */
+static void SecondJob(void);
+
+/**
+ * @brief           Simula ciclos de la aplicación ocupada seguidos de una llamada al gancho de la tarea inactiva.
+ * @param busy      Ciclos ocupados antes de llegar a la tarea inactiva.
+ * @param slept     Ciclos que duerme el procesador.
+ * @param times     Cantidad de repeticiones.
+ */
+static void Run(uint32_t busy, uint32_t slept, uint16_t times);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const struct idle_driver_s fake_driver = {
+    .Now = FakeNow,
+    .Sleep = FakeSleep,
+    .cycles_per_second = CYCLES_PER_SECOND,
+};
+
+static uint32_t now;
+
+static uint32_t sleep_cycles;
+
+static char order[8];
+
+static uint8_t jobs_run;
+
+idle_t idle;
+
+/* === Private function implementation ========================================================= */
+
+static uint32_t FakeNow(void) {
+    return now;
+}
+
+static uint32_t FakeSleep(void) {
+    order[jobs_run++ % sizeof(order)] = 's';
+    now += sleep_cycles;
+    return sleep_cycles;
+}
+
+static void FirstJob(void) {
+    order[jobs_run++ % sizeof(order)] = '1';
+}
+
+static void SecondJob(void) {
+    order[jobs_run++ % sizeof(order)] = '2';
+}
+
+static void Run(uint32_t busy, uint32_t slept, uint16_t times) {
+    sleep_cycles = slept;
+    for (uint16_t index = 0; index < times; index++) {
+        now += busy;
+        IdleHook(idle);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    now = 0xFFFFFE00; // El contador desborda durante las pruebas
+    jobs_run = 0;
+    memset(order, 0, sizeof(order));
+    idle = IdleCreate(&fake_driver);
+    TEST_ASSERT_NOT_NULL(idle);
+}
+
+// Antes de completar el primer segundo la fracción de tiempo inactivo es desconocida.
+void test_unknown_before_first_second(void) {
+    idle_stats_t stats;
+
+    Run(3, 7, 99);
+    IdleGetStats(idle, &stats);
+    TEST_ASSERT_EQUAL_UINT16(IDLE_UNKNOWN, stats.idle_permille);
+    TEST_ASSERT_EQUAL_UINT16(IDLE_UNKNOWN, stats.min_idle_permille);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.seconds);
+    TEST_ASSERT_EQUAL_UINT32(99, stats.sleeps);
+}
+
+// Cada segundo se calcula la fracción del tiempo que durmió el procesador y se guarda la menor.
+void test_idle_fraction_per_second(void) {
+    idle_stats_t stats;
+
+    Run(3, 7, 100);
+    IdleGetStats(idle, &stats);
+    TEST_ASSERT_EQUAL_UINT16(700, stats.idle_permille);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.seconds);
+
+    Run(9, 1, 100);
+    IdleGetStats(idle, &stats);
+    TEST_ASSERT_EQUAL_UINT16(100, stats.idle_permille);
+
+    Run(0, 10, 100);
+    IdleGetStats(idle, &stats);
+    TEST_ASSERT_EQUAL_UINT16(1000, stats.idle_permille);
+    TEST_ASSERT_EQUAL_UINT16(100, stats.min_idle_permille);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.seconds);
+}
+
+// Si el procesador no durmió durante más de un segundo la fracción se calcula sobre toda la ventana.
+void test_long_busy_window(void) {
+    idle_stats_t stats;
+
+    Run(3000, 1000, 1);
+    IdleGetStats(idle, &stats);
+    TEST_ASSERT_EQUAL_UINT16(250, stats.idle_permille);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.seconds);
+
+    Run(5, 5, 100);
+    IdleGetStats(idle, &stats);
+    TEST_ASSERT_EQUAL_UINT16(500, stats.idle_permille);
+    TEST_ASSERT_EQUAL_UINT16(250, stats.min_idle_permille);
+}
+
+// Los trabajos diferidos se ejecutan de a uno por vez y por turno, antes de dormir.
+void test_jobs_run_in_turn_before_sleeping(void) {
+    TEST_ASSERT_TRUE(IdleAttachJob(idle, FirstJob));
+    TEST_ASSERT_TRUE(IdleAttachJob(idle, SecondJob));
+    Run(1, 1, 3);
+    TEST_ASSERT_EQUAL_STRING("1s2s1s", order);
+}
+
+// Se registran hasta IDLE_JOBS_MAX trabajos y los parámetros inválidos se rechazan sin fallar.
+void test_invalid_parameters(void) {
+    idle_stats_t stats;
+
+    for (uint8_t index = 0; index < IDLE_JOBS_MAX; index++) {
+        TEST_ASSERT_TRUE(IdleAttachJob(idle, FirstJob));
+    }
+    TEST_ASSERT_FALSE(IdleAttachJob(idle, SecondJob));
+    TEST_ASSERT_FALSE(IdleAttachJob(NULL, FirstJob));
+    TEST_ASSERT_NULL(IdleCreate(NULL));
+    TEST_ASSERT_NULL(IdleCreate(&(const struct idle_driver_s){.Now = FakeNow, .cycles_per_second = 1}));
+    TEST_ASSERT_NULL(IdleCreate(&(const struct idle_driver_s){.Now = FakeNow, .Sleep = FakeSleep}));
+
+    IdleHook(NULL);
+    IdleGetStats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT16(IDLE_UNKNOWN, stats.idle_permille);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sleeps);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,217 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_persist.c
+ ** @brief Código fuente de las pruebas del almacenamiento persistente del estado del reloj
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "persist.h"
+#include "host_storage.h"
+#include <stdio.h>
+
+/**
+ - Una memoria sin registros no tiene estado guardado.
+ - El estado guardado se recupera al volver a abrir la memoria.
+ - Después de muchas escrituras se recupera el último estado y los sectores se borran en forma pareja.
+ - La recuperación lee una cantidad acotada de registros, sin importar cuántos se guardaron.
+ - Guardar el mismo estado no gasta registros.
+ - Un corte de alimentación durante una escritura recupera el estado anterior y el log sigue funcionando.
+ - Un corte al escribir el primer registro de un sector recupera el estado del sector anterior.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+//! Archivo de la memoria emulada, dentro del directorio de compilación de las pruebas
+#define STORAGE_PATH "build/test_persist.bin"
+
+#define STORAGE_SECTOR_SIZE 256
+
+#define STORAGE_SECTORS 4
+
+//! Cantidad de registros de 16 bytes por sector
+#define STORAGE_SLOTS (STORAGE_SECTOR_SIZE / 16)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief       Genera un estado distinto para cada número.
+ * @param n     Número del estado.
+ * @return      El estado generado.
+ */
+static persist_state_t StateNumber(uint32_t n);
+
+/**
+ * @brief       Simula un reinicio: vuelve a abrir la memoria y a crear el almacenamiento.
+ * @return      El almacenamiento creado.
+ */
+static persist_t Reboot(void);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static persist_state_t StateNumber(uint32_t n) {
+    persist_state_t state = {
+        .trim_ppm = -(int32_t)n,
+        .alarm_minutes = (uint16_t)(n % 1440),
+        .alarm_weekdays = (uint8_t)(n & 0x7F),
+        .flags = PERSIST_ALARM_ENABLED,
+    };
+    return state;
+}
+
+static persist_t Reboot(void) {
+    HostStorageClose();
+    return PersistCreate(HostStorageOpen(STORAGE_PATH, STORAGE_SECTOR_SIZE, STORAGE_SECTORS));
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+persist_t persist;
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    remove(STORAGE_PATH);
+    persist = PersistCreate(HostStorageOpen(STORAGE_PATH, STORAGE_SECTOR_SIZE, STORAGE_SECTORS));
+    TEST_ASSERT_NOT_NULL(persist);
+}
+
+void tearDown(void) {
+    HostStorageClose();
+    remove(STORAGE_PATH);
+}
+
+// Una memoria sin registros no tiene estado guardado.
+void test_persist_empty_memory(void) {
+    persist_state_t state;
+    TEST_ASSERT_FALSE(PersistRestore(persist, &state));
+    TEST_ASSERT_FALSE(PersistRestore(Reboot(), &state));
+}
+
+// El estado guardado se recupera al volver a abrir la memoria.
+void test_persist_restore_after_reboot(void) {
+    persist_state_t saved = StateNumber(7);
+    persist_state_t state;
+
+    TEST_ASSERT_TRUE(PersistSave(persist, &saved));
+    persist = Reboot();
+    TEST_ASSERT_TRUE(PersistRestore(persist, &state));
+    TEST_ASSERT_EQUAL_MEMORY(&saved, &state, sizeof(persist_state_t));
+}
+
+// Después de muchas escrituras se recupera el último estado y los sectores se borran en forma pareja.
+void test_persist_wear_levelling(void) {
+    const uint32_t count = 5 * STORAGE_SECTORS * STORAGE_SLOTS + 3;
+    persist_state_t expected = StateNumber(count);
+    persist_state_t state;
+
+    for (uint32_t n = 1; n <= count; n++) {
+        persist_state_t saved = StateNumber(n);
+        TEST_ASSERT_TRUE(PersistSave(persist, &saved));
+    }
+    for (uint8_t sector = 0; sector < STORAGE_SECTORS; sector++) {
+        TEST_ASSERT_UINT32_WITHIN(1, 5, HostStorageErases(sector));
+    }
+
+    persist = Reboot();
+    TEST_ASSERT_TRUE(PersistRestore(persist, &state));
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &state, sizeof(persist_state_t));
+}
+
+// La recuperación lee una cantidad acotada de registros, sin importar cuántos se guardaron.
+void test_persist_bounded_restore(void) {
+    for (uint32_t saved = 1; saved <= 3 * STORAGE_SECTORS * STORAGE_SLOTS; saved += 7) {
+        persist_state_t state = StateNumber(saved);
+        for (uint32_t n = 0; n < 7; n++) {
+            PersistSave(persist, &state);
+            state.trim_ppm++;
+        }
+        persist = Reboot();
+        // Primer registro de cada sector, búsqueda binaria en el sector en uso y el último registro
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(STORAGE_SECTORS + 4 + 2, HostStorageReads());
+    }
+}
+
+// Guardar el mismo estado no gasta registros.
+void test_persist_unchanged_state(void) {
+    persist_state_t saved = StateNumber(3);
+
+    for (uint32_t n = 0; n <= STORAGE_SECTORS * STORAGE_SLOTS; n++) {
+        TEST_ASSERT_TRUE(PersistSave(persist, &saved));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, HostStorageErases(0));
+    TEST_ASSERT_EQUAL_UINT32(0, HostStorageErases(1));
+}
+
+// Un corte de alimentación durante una escritura recupera el estado anterior y el log sigue funcionando.
+void test_persist_power_fail_during_write(void) {
+    persist_state_t first = StateNumber(1);
+    persist_state_t second = StateNumber(2);
+    persist_state_t third = StateNumber(3);
+    persist_state_t state;
+
+    PersistSave(persist, &first);
+    HostStoragePowerFail(10);
+    TEST_ASSERT_FALSE(PersistSave(persist, &second));
+
+    persist = Reboot();
+    TEST_ASSERT_TRUE(PersistRestore(persist, &state));
+    TEST_ASSERT_EQUAL_MEMORY(&first, &state, sizeof(persist_state_t));
+
+    TEST_ASSERT_TRUE(PersistSave(persist, &third));
+    persist = Reboot();
+    TEST_ASSERT_TRUE(PersistRestore(persist, &state));
+    TEST_ASSERT_EQUAL_MEMORY(&third, &state, sizeof(persist_state_t));
+}
+
+// Un corte al escribir el primer registro de un sector recupera el estado del sector anterior.
+void test_persist_power_fail_on_new_sector(void) {
+    persist_state_t last = StateNumber(STORAGE_SLOTS);
+    persist_state_t next = StateNumber(STORAGE_SLOTS + 1);
+    persist_state_t state;
+
+    for (uint32_t n = 1; n <= STORAGE_SLOTS; n++) {
+        persist_state_t saved = StateNumber(n);
+        PersistSave(persist, &saved);
+    }
+    HostStoragePowerFail(4);
+    TEST_ASSERT_FALSE(PersistSave(persist, &next));
+    TEST_ASSERT_EQUAL_UINT32(1, HostStorageErases(1));
+
+    persist = Reboot();
+    TEST_ASSERT_TRUE(PersistRestore(persist, &state));
+    TEST_ASSERT_EQUAL_MEMORY(&last, &state, sizeof(persist_state_t));
+
+    TEST_ASSERT_TRUE(PersistSave(persist, &next));
+    persist = Reboot();
+    TEST_ASSERT_TRUE(PersistRestore(persist, &state));
+    TEST_ASSERT_EQUAL_MEMORY(&next, &state, sizeof(persist_state_t));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,245 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_record.c
+ ** @brief Código fuente de las pruebas del registrador de eventos y de su reproducción en el host
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "config.h"
+#include "record.h"
+#include "replay.h"
+#include "app.h"
+#include "clock.h"
+#include "buzzer.h"
+#include "chrono.h"
+#include "persist.h"
+#include "screen.h"
+#include "host_screen.h"
+#include "mock_digital.h"
+
+/**
+ - El registrador devuelve los eventos en el orden en que se registraron.
+ - Al llenarse el registrador descarta los eventos más antiguos y los cuenta.
+ - Registrar en un registrador nulo no tiene efecto.
+ - Una sesión grabada se reproduce con las mismas salidas.
+ - Si se altera un mensaje de la traza la reproducción detecta la diferencia.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+//! Período de verificación de la alarma de la sesión grabada, distinto al del reproductor
+#define LIVE_POLL_PERIOD 10
+
+//! Demora entre el flanco de un botón y el procesamiento del mensaje en la sesión grabada
+#define LIVE_QUEUE_LATENCY 3
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief Devuelve el instante simulado de la sesión grabada.
+ * @return Ticks simulados.
+ */
+static uint32_t LiveNow(void);
+
+/**
+ * @brief       Avanza la sesión grabada tick a tick, verificando la alarma periódicamente.
+ * @param ticks Ticks a avanzar.
+ */
+static void LiveRun(uint32_t ticks);
+
+/**
+ * @brief       Simula la pulsación de un botón en la sesión grabada.
+ * @param event Mensaje que genera el botón.
+ */
+static void LivePress(message_type_t event);
+
+/**
+ * @brief       Graba una sesión que ajusta la hora y la alarma y deja sonar la alarma.
+ * @param trace Arreglo donde se guarda la traza grabada.
+ * @return      Cantidad de eventos grabados.
+ */
+static uint16_t RecordSession(record_event_t * trace);
+
+/* === Private variable declarations =========================================================== */
+
+static uint32_t live_now;
+
+static clock_t clock;
+
+static app_t app;
+
+static recorder_t recorder;
+
+static struct board_s board;
+
+static record_event_t trace[RECORD_BUFFER_SIZE];
+
+/* === Private function declarations =========================================================== */
+
+static uint32_t LiveNow(void) {
+    return live_now;
+}
+
+static void LiveRun(uint32_t ticks) {
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        live_now++;
+        ClockNewTick(clock);
+        if ((live_now % LIVE_POLL_PERIOD) == 0) {
+            AppPoll(app);
+        }
+    }
+}
+
+static void LivePress(message_type_t event) {
+    uint32_t edge = live_now;
+
+    LiveRun(LIVE_QUEUE_LATENCY);
+    RecorderLogAt(recorder, edge, RECORD_BUTTON, event, 0);
+    AppDispatch(app, event);
+    AppPoll(app);
+    LiveRun(200);
+}
+
+static uint16_t RecordSession(record_event_t * trace) {
+    live_now = 0;
+    clock = ClockCreate(TICKS_PER_SECOND);
+    app = AppCreate(clock, &board);
+    recorder = RecorderCreate(LiveNow);
+    AppAttachRecorder(app, recorder);
+
+    LiveRun(100);
+    // Ajustar la hora a 00:01
+    LivePress(MSG_BUTTON_SET_TIME_LONG);
+    LivePress(MSG_BUTTON_INCREASE);
+    LivePress(MSG_BUTTON_ACCEPT);
+    LivePress(MSG_BUTTON_ACCEPT);
+    // Ajustar la alarma a 00:02
+    LivePress(MSG_BUTTON_SET_ALARM_LONG);
+    LivePress(MSG_BUTTON_INCREASE);
+    LivePress(MSG_BUTTON_INCREASE);
+    LivePress(MSG_BUTTON_ACCEPT);
+    LivePress(MSG_BUTTON_ACCEPT);
+    // Esperar a que suene la alarma y cancelarla
+    LiveRun(65000);
+    LivePress(MSG_BUTTON_CANCEL);
+
+    TEST_ASSERT_EQUAL(0, RecorderDropped(recorder));
+    return RecorderRead(recorder, trace, RECORD_BUFFER_SIZE);
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    DigitalOutputGroupWrite_Ignore();
+
+    if (board.screen == NULL) {
+        board.screen = HostScreenCreate(4);
+    }
+    live_now = 0;
+    recorder = RecorderCreate(LiveNow);
+}
+
+// El registrador devuelve los eventos en el orden en que se registraron.
+void test_recorder_keeps_events_in_order(void) {
+    record_event_t events[4];
+
+    live_now = 10;
+    RecorderLog(recorder, RECORD_MESSAGE, MSG_BUTTON_ACCEPT, 0);
+    RecorderLogAt(recorder, 12, RECORD_MODE, CLOCK_MODE_DISPLAY, 0);
+    RecorderLogAt(recorder, 15, RECORD_OUTPUT, RECORD_OUTPUT_ALARM, 1);
+
+    TEST_ASSERT_EQUAL(3, RecorderRead(recorder, events, 4));
+    TEST_ASSERT_EQUAL(10, events[0].timestamp);
+    TEST_ASSERT_EQUAL(RECORD_MESSAGE, events[0].kind);
+    TEST_ASSERT_EQUAL(MSG_BUTTON_ACCEPT, events[0].id);
+    TEST_ASSERT_EQUAL(12, events[1].timestamp);
+    TEST_ASSERT_EQUAL(RECORD_MODE, events[1].kind);
+    TEST_ASSERT_EQUAL(15, events[2].timestamp);
+    TEST_ASSERT_EQUAL(1, events[2].value);
+    TEST_ASSERT_EQUAL(0, RecorderRead(recorder, events, 4));
+}
+
+// Al llenarse el registrador descarta los eventos más antiguos y los cuenta.
+void test_recorder_drops_oldest_when_full(void) {
+    for (uint16_t index = 0; index < RECORD_BUFFER_SIZE + 5; index++) {
+        RecorderLogAt(recorder, index, RECORD_MESSAGE, 0, index);
+    }
+
+    TEST_ASSERT_EQUAL(5, RecorderDropped(recorder));
+    TEST_ASSERT_EQUAL(RECORD_BUFFER_SIZE, RecorderRead(recorder, trace, RECORD_BUFFER_SIZE));
+    TEST_ASSERT_EQUAL(5, trace[0].value);
+    TEST_ASSERT_EQUAL(RECORD_BUFFER_SIZE + 4, trace[RECORD_BUFFER_SIZE - 1].value);
+}
+
+// Registrar en un registrador nulo no tiene efecto.
+void test_null_recorder_is_ignored(void) {
+    RecorderLog(NULL, RECORD_MESSAGE, 0, 0);
+    RecorderLogAt(NULL, 0, RECORD_MESSAGE, 0, 0);
+    TEST_ASSERT_EQUAL(0, RecorderRead(recorder, trace, RECORD_BUFFER_SIZE));
+}
+
+// Una sesión grabada se reproduce con las mismas salidas.
+void test_replay_reproduces_recorded_session(void) {
+    replay_result_t result;
+    uint16_t count = RecordSession(trace);
+
+    TEST_ASSERT_TRUE(ReplayRun(trace, count, &result));
+    TEST_ASSERT_EQUAL(10, result.messages);
+    TEST_ASSERT_EQUAL(8, result.outputs);
+    TEST_ASSERT_EQUAL(0, result.mismatches);
+    TEST_ASSERT_EQUAL(count, result.first_mismatch);
+    TEST_ASSERT_LESS_OR_EQUAL(REPLAY_POLL_PERIOD, result.max_skew);
+}
+
+// Si se altera un mensaje de la traza la reproducción detecta la diferencia.
+void test_replay_detects_changed_message(void) {
+    replay_result_t result;
+    uint16_t count = RecordSession(trace);
+    uint16_t changed = count;
+
+    // Cambiar el primer incremento de la alarma por un decremento
+    for (uint16_t index = 0; index < count; index++) {
+        if ((trace[index].kind == RECORD_MESSAGE) && (trace[index].id == MSG_BUTTON_SET_ALARM_LONG)) {
+            changed = index;
+        }
+        if ((changed < index) && (trace[index].kind == RECORD_MESSAGE)) {
+            trace[index].id = MSG_BUTTON_DECREASE;
+            break;
+        }
+    }
+
+    TEST_ASSERT_FALSE(ReplayRun(trace, count, &result));
+    TEST_ASSERT_GREATER_THAN(0, result.mismatches);
+    TEST_ASSERT_GREATER_THAN(changed, result.first_mismatch);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
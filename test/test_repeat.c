@@ -0,0 +1,150 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_repeat.c
+ ** @brief Código fuente de las pruebas de la repetición acelerada de las teclas
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "repeat.h"
+
+/**
+ - Al presionar la tecla no hay repeticiones hasta que pasa REPEAT_DELAY_MS.
+ - Las repeticiones valen 1 paso cada REPEAT_PERIOD_MS y después de cada REPEAT_STAGE_MS pasan a 5 y a 10 pasos.
+ - Al soltar la tecla se vuelve a esperar REPEAT_DELAY_MS en la siguiente pulsación.
+ - Una consulta demorada devuelve sumados los pasos de todas las repeticiones vencidas.
+ - La repetición tolera el desborde del contador de ticks.
+ - Las dos teclas se repiten en forma independiente.
+ - Los parámetros inválidos y una instancia nula se rechazan sin fallar.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define TICKS_PER_SECOND 1000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief           Mantiene la tecla presionada consultando la repetición en cada tick, como la tarea de botones.
+ * @param self      La repetición.
+ * @param ticks     Cantidad de ticks que se mantiene la tecla.
+ * @return          Suma de los pasos devueltos en todas las consultas.
+ */
+static uint32_t Hold(repeat_t self, uint32_t ticks);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static uint32_t now;
+
+repeat_t repeat;
+
+/* === Private function implementation ========================================================= */
+
+static uint32_t Hold(repeat_t self, uint32_t ticks) {
+    uint32_t steps = 0;
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        steps += RepeatUpdate(self, true, now);
+        now++;
+    }
+    return steps;
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    now = 12345;
+    repeat = RepeatCreate(REPEAT_INCREASE, TICKS_PER_SECOND);
+    TEST_ASSERT_NOT_NULL(repeat);
+}
+
+// Al presionar la tecla no hay repeticiones hasta que pasa REPEAT_DELAY_MS.
+void test_no_repeat_before_delay(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, Hold(repeat, REPEAT_DELAY_MS));
+    TEST_ASSERT_EQUAL_UINT16(1, RepeatUpdate(repeat, true, now));
+}
+
+// Las repeticiones valen 1 paso cada REPEAT_PERIOD_MS y después de cada REPEAT_STAGE_MS pasan a 5 y a 10 pasos.
+void test_repeat_accelerates(void) {
+    const uint32_t per_stage = REPEAT_STAGE_MS / REPEAT_PERIOD_MS;
+
+    TEST_ASSERT_EQUAL_UINT32(per_stage * 1, Hold(repeat, REPEAT_DELAY_MS + REPEAT_STAGE_MS));
+    TEST_ASSERT_EQUAL_UINT32(per_stage * 5, Hold(repeat, REPEAT_STAGE_MS));
+    TEST_ASSERT_EQUAL_UINT32(per_stage * 10, Hold(repeat, REPEAT_STAGE_MS));
+    TEST_ASSERT_EQUAL_UINT32(per_stage * 10, Hold(repeat, REPEAT_STAGE_MS));
+}
+
+// Al soltar la tecla se vuelve a esperar REPEAT_DELAY_MS en la siguiente pulsación.
+void test_release_restarts_delay(void) {
+    TEST_ASSERT_EQUAL_UINT32(1, Hold(repeat, REPEAT_DELAY_MS + 1));
+    TEST_ASSERT_EQUAL_UINT16(0, RepeatUpdate(repeat, false, now));
+    now += 1000;
+    TEST_ASSERT_EQUAL_UINT32(0, Hold(repeat, REPEAT_DELAY_MS));
+    TEST_ASSERT_EQUAL_UINT16(1, RepeatUpdate(repeat, true, now));
+}
+
+// Una consulta demorada devuelve sumados los pasos de todas las repeticiones vencidas.
+void test_late_update_batches_steps(void) {
+    TEST_ASSERT_EQUAL_UINT16(0, RepeatUpdate(repeat, true, now));
+    now += REPEAT_DELAY_MS + 3 * REPEAT_PERIOD_MS;
+    TEST_ASSERT_EQUAL_UINT16(4, RepeatUpdate(repeat, true, now));
+    TEST_ASSERT_EQUAL_UINT16(0, RepeatUpdate(repeat, true, now));
+
+    // Las repeticiones vencidas en distintas etapas suman cada una su tamaño de paso
+    now += REPEAT_STAGE_MS;
+    TEST_ASSERT_EQUAL_UINT16(REPEAT_STAGE_MS / REPEAT_PERIOD_MS - 4 + 4 * 5, RepeatUpdate(repeat, true, now));
+}
+
+// La repetición tolera el desborde del contador de ticks.
+void test_repeat_tolerates_counter_overflow(void) {
+    now = 0xFFFFFFFF - REPEAT_DELAY_MS / 2;
+    TEST_ASSERT_EQUAL_UINT32(0, Hold(repeat, REPEAT_DELAY_MS));
+    TEST_ASSERT_EQUAL_UINT32(REPEAT_STAGE_MS / REPEAT_PERIOD_MS, Hold(repeat, REPEAT_STAGE_MS));
+}
+
+// Las dos teclas se repiten en forma independiente.
+void test_keys_are_independent(void) {
+    repeat_t decrease = RepeatCreate(REPEAT_DECREASE, TICKS_PER_SECOND);
+
+    TEST_ASSERT_NOT_NULL(decrease);
+    TEST_ASSERT_NOT_EQUAL(repeat, decrease);
+    Hold(repeat, REPEAT_DELAY_MS);
+    TEST_ASSERT_EQUAL_UINT16(0, RepeatUpdate(decrease, true, now));
+    TEST_ASSERT_EQUAL_UINT16(1, RepeatUpdate(repeat, true, now));
+    TEST_ASSERT_EQUAL_UINT16(0, RepeatUpdate(decrease, true, now));
+}
+
+// Los parámetros inválidos y una instancia nula se rechazan sin fallar.
+void test_invalid_parameters(void) {
+    TEST_ASSERT_NULL(RepeatCreate(REPEAT_COUNT, TICKS_PER_SECOND));
+    TEST_ASSERT_NULL(RepeatCreate(REPEAT_INCREASE, 0));
+    TEST_ASSERT_EQUAL_UINT16(0, RepeatUpdate(NULL, true, now));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,138 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_screen.c
+ ** @brief Código fuente de las pruebas de la pantalla multiplexada de 7 segmentos
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "screen.h"
+#include "host_screen.h"
+
+/**
+ - Al crear la pantalla todos los dígitos están apagados.
+ - Los dígitos escritos a mitad de un barrido se muestran desde el barrido siguiente, todos juntos.
+ - De varias escrituras entre dos barridos sólo se muestra la última.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define DIGITS 4
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief       Refresca la pantalla hasta encender el último dígito, completando el barrido en curso.
+ */
+static void FinishScan(void);
+
+/**
+ * @brief       Verifica los segmentos que se encendieron en cada dígito desde la última verificación, sin el punto.
+ * @param value Dígitos esperados, de izquierda a derecha.
+ */
+static void AssertShown(const uint8_t value[DIGITS]);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const uint8_t IMAGES[10] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,
+    SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+};
+
+screen_t screen;
+
+/* === Private function implementation ========================================================= */
+
+static void FinishScan(void) {
+    do {
+        ScreenRefresh(screen);
+    } while (HostScreenLastDigit() != DIGITS - 1);
+}
+
+static void AssertShown(const uint8_t value[DIGITS]) {
+    for (uint8_t i = 0; i < DIGITS; i++) {
+        TEST_ASSERT_EQUAL_HEX8(IMAGES[value[i]], HostScreenShown()[i]);
+    }
+    HostScreenClear();
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    screen = HostScreenCreate(DIGITS);
+    TEST_ASSERT_NOT_NULL(screen);
+    FinishScan();
+}
+
+void tearDown(void) {
+    free(screen);
+}
+
+// Al crear la pantalla todos los dígitos están apagados.
+void test_screen_starts_blank(void) {
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, HostScreenShown(), DIGITS);
+}
+
+// Los dígitos escritos a mitad de un barrido se muestran desde el barrido siguiente, todos juntos.
+void test_write_is_latched_at_next_scan(void) {
+    ScreenWriteBCD(screen, (uint8_t[]){1, 2, 3, 4}, DIGITS);
+    FinishScan();
+    AssertShown((const uint8_t[]){1, 2, 3, 4});
+
+    ScreenRefresh(screen);
+    ScreenRefresh(screen);
+    ScreenWriteBCD(screen, (uint8_t[]){5, 6, 7, 8}, DIGITS);
+    FinishScan();
+    AssertShown((const uint8_t[]){1, 2, 3, 4}); // El barrido en curso termina con el cuadro anterior
+    FinishScan();
+    AssertShown((const uint8_t[]){5, 6, 7, 8});
+}
+
+// De varias escrituras entre dos barridos sólo se muestra la última.
+void test_only_last_write_is_shown(void) {
+    ScreenWriteBCD(screen, (uint8_t[]){1, 1, 1, 1}, DIGITS);
+    ScreenWriteBCD(screen, (uint8_t[]){2, 2, 2, 2}, DIGITS);
+    ScreenWriteBCD(screen, (uint8_t[]){0, 9, 3, 0}, DIGITS);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL(0, HostScreenLastDigit());
+    TEST_ASSERT_EQUAL_HEX8(IMAGES[0], HostScreenShown()[0]);
+    FinishScan();
+    AssertShown((const uint8_t[]){0, 9, 3, 0});
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
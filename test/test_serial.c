@@ -0,0 +1,223 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_serial.c
+ ** @brief Código fuente de las pruebas del enlace serie con tramas binarias
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "serial.h"
+#include <string.h>
+
+/**
+ - Una trama enviada se recibe igual, con y sin datos, y se cuenta.
+ - Una trama que llega de a un byte se completa recién con el último.
+ - Los bytes anteriores a la marca de comienzo se ignoran y varias tramas seguidas se separan.
+ - Una trama con la suma incorrecta se descarta, se cuenta y se recibe la siguiente.
+ - Una trama con la longitud mayor a SERIAL_PAYLOAD_MAX se descarta y se cuenta.
+ - Con el buffer lleno los bytes nuevos se descartan y se cuentan, y al leer vuelve a haber lugar.
+ - No se envían datos más largos que SERIAL_PAYLOAD_MAX y sin función de transmisión no se crea el enlace.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+//! Tamaño del buffer donde se guardan los bytes transmitidos
+#define SENT_SIZE 256
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief       Transmisión falsa, guarda los bytes transmitidos.
+ * @param data  Bytes a transmitir.
+ * @param size  Cantidad de bytes.
+ */
+static void FakeWrite(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief           Envía una trama y la guarda en el buffer de bytes transmitidos.
+ * @param command   Comando de la trama.
+ * @param payload   Datos de la trama.
+ * @param length    Cantidad de bytes de datos.
+ */
+static void SendFrame(uint8_t command, const uint8_t * payload, uint8_t length);
+
+/**
+ * @brief           Verifica que la próxima trama recibida tenga el comando y los datos esperados.
+ * @param command   Comando esperado.
+ * @param payload   Datos esperados.
+ * @param length    Cantidad de bytes de datos esperados.
+ */
+static void AssertFrame(uint8_t command, const uint8_t * payload, uint8_t length);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static uint8_t sent[SENT_SIZE];
+
+static uint16_t sent_size;
+
+static serial_t serial;
+
+/* === Private function implementation ========================================================= */
+
+static void FakeWrite(const uint8_t * data, uint16_t size) {
+    TEST_ASSERT_TRUE(sent_size + size <= SENT_SIZE);
+    memcpy(&sent[sent_size], data, size);
+    sent_size += size;
+}
+
+static void SendFrame(uint8_t command, const uint8_t * payload, uint8_t length) {
+    TEST_ASSERT_TRUE(SerialSendFrame(serial, command, payload, length));
+}
+
+static void AssertFrame(uint8_t command, const uint8_t * payload, uint8_t length) {
+    serial_frame_t frame;
+
+    TEST_ASSERT_TRUE(SerialReadFrame(serial, &frame));
+    TEST_ASSERT_EQUAL_HEX8(command, frame.command);
+    TEST_ASSERT_EQUAL_UINT8(length, frame.length);
+    if (length) {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, frame.payload, length);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    sent_size = 0;
+    serial = SerialCreate(FakeWrite);
+    TEST_ASSERT_NOT_NULL(serial);
+}
+
+// Una trama enviada se recibe igual, con y sin datos, y se cuenta.
+void test_frame_round_trip(void) {
+    const uint8_t payload[] = {0x00, 0xA5, 0xFF, 0x12};
+    serial_stats_t stats;
+
+    SendFrame(0x03, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(payload) + SERIAL_FRAME_OVERHEAD, sent_size);
+    TEST_ASSERT_EQUAL_HEX8(SERIAL_SYNC, sent[0]);
+    SendFrame(0x81, NULL, 0);
+
+    TEST_ASSERT_EQUAL_UINT16(sent_size, SerialReceive(serial, sent, sent_size));
+    AssertFrame(0x03, payload, sizeof(payload));
+    AssertFrame(0x81, NULL, 0);
+    TEST_ASSERT_FALSE(SerialReadFrame(serial, &(serial_frame_t){0}));
+
+    SerialGetStats(serial, &stats);
+    TEST_ASSERT_EQUAL_UINT32(sent_size, stats.received);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.errors);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.overruns);
+}
+
+// Una trama que llega de a un byte se completa recién con el último.
+void test_frame_arrives_in_pieces(void) {
+    const uint8_t payload[] = {1, 2, 3};
+    serial_frame_t frame;
+
+    SendFrame(0x05, payload, sizeof(payload));
+    for (uint16_t index = 0; index < sent_size - 1; index++) {
+        SerialReceive(serial, &sent[index], 1);
+        TEST_ASSERT_FALSE(SerialReadFrame(serial, &frame));
+    }
+    SerialReceive(serial, &sent[sent_size - 1], 1);
+    AssertFrame(0x05, payload, sizeof(payload));
+}
+
+// Los bytes anteriores a la marca de comienzo se ignoran y varias tramas seguidas se separan.
+void test_noise_before_frames_is_skipped(void) {
+    const uint8_t noise[] = {0x00, 0x13, 0xFF, 0x5A};
+
+    FakeWrite(noise, sizeof(noise));
+    SendFrame(0x01, NULL, 0);
+    SendFrame(0x02, (const uint8_t[]){7}, 1);
+    SerialReceive(serial, sent, sent_size);
+    AssertFrame(0x01, NULL, 0);
+    AssertFrame(0x02, (const uint8_t[]){7}, 1);
+}
+
+// Una trama con la suma incorrecta se descarta, se cuenta y se recibe la siguiente.
+void test_bad_checksum_is_dropped(void) {
+    serial_stats_t stats;
+
+    SendFrame(0x02, (const uint8_t[]){1, 2}, 2);
+    sent[4]++; // Se altera un byte de datos
+    SendFrame(0x03, (const uint8_t[]){9}, 1);
+    SerialReceive(serial, sent, sent_size);
+    AssertFrame(0x03, (const uint8_t[]){9}, 1);
+
+    SerialGetStats(serial, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.errors);
+}
+
+// Una trama con la longitud mayor a SERIAL_PAYLOAD_MAX se descarta y se cuenta.
+void test_long_frame_is_dropped(void) {
+    const uint8_t header[] = {SERIAL_SYNC, 0x02, SERIAL_PAYLOAD_MAX + 1};
+    serial_stats_t stats;
+
+    FakeWrite(header, sizeof(header));
+    SendFrame(0x04, NULL, 0);
+    SerialReceive(serial, sent, sent_size);
+    AssertFrame(0x04, NULL, 0);
+
+    SerialGetStats(serial, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.errors);
+}
+
+// Con el buffer lleno los bytes nuevos se descartan y se cuentan, y al leer vuelve a haber lugar.
+void test_full_buffer_counts_overruns(void) {
+    uint8_t noise[SERIAL_BUFFER_SIZE + 10] = {0};
+    serial_stats_t stats;
+
+    TEST_ASSERT_EQUAL_UINT16(SERIAL_BUFFER_SIZE, SerialReceive(serial, noise, sizeof(noise)));
+    SendFrame(0x06, NULL, 0);
+    TEST_ASSERT_EQUAL_UINT16(0, SerialReceive(serial, sent, sent_size));
+
+    SerialGetStats(serial, &stats);
+    TEST_ASSERT_EQUAL_UINT32(SERIAL_BUFFER_SIZE, stats.received);
+    TEST_ASSERT_EQUAL_UINT32(10 + SERIAL_FRAME_OVERHEAD, stats.overruns);
+
+    TEST_ASSERT_FALSE(SerialReadFrame(serial, &(serial_frame_t){0}));
+    TEST_ASSERT_EQUAL_UINT16(sent_size, SerialReceive(serial, sent, sent_size));
+    AssertFrame(0x06, NULL, 0);
+}
+
+// No se envían datos más largos que SERIAL_PAYLOAD_MAX y sin función de transmisión no se crea el enlace.
+void test_invalid_parameters(void) {
+    uint8_t payload[SERIAL_PAYLOAD_MAX + 1] = {0};
+
+    TEST_ASSERT_FALSE(SerialSendFrame(serial, 0x01, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_UINT16(0, sent_size);
+    TEST_ASSERT_TRUE(SerialSendFrame(serial, 0x01, payload, SERIAL_PAYLOAD_MAX));
+    TEST_ASSERT_NULL(SerialCreate(NULL));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,403 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_timesync.c
+ ** @brief Código fuente de las pruebas del cliente de sincronización de la hora
+ **
+ ** La PC es un servidor de hora en otro proceso, conectado por una pseudoterminal. La hora del servidor y la del
+ ** oscilador del reloj las avanza la prueba, con el error de frecuencia y las demoras del enlace que elige cada prueba.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "timesync.h"
+#include "clock.h"
+#include "serial.h"
+#include "host_uart.h"
+#include "host_timeserver.h"
+#include "host_source.h"
+
+/**
+ - La primera muestra ajusta el reloj sin hora válida a la hora del servidor.
+ - Una diferencia chica se recupera de a poco con la corrección del oscilador, sin saltos, y la corrección vuelve a
+   la base al terminar.
+ - Con el oscilador fuera de frecuencia las muestras periódicas estiman la corrección y mantienen la diferencia chica.
+ - Una diferencia mayor a TIMESYNC_STEP_MS salta a la hora del servidor.
+ - Una muestra con demora excesiva se descarta sin modificar el reloj.
+ - Una respuesta repetida o de otro pedido se descarta.
+ - Los pedidos se envían periódicamente según el intervalo.
+ - Con el calendario del RTC no se corrige de a poco ni se estima la frecuencia, sólo se salta conservando la fracción.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+#define CLOCK_TICKS_PER_SECOND 1000
+
+//! Hora inicial del servidor, 2025-03-14 12:00:00 UTC
+#define SERVER_START_MS 1741953600000ULL
+
+//! Intervalo entre muestras de las pruebas de frecuencia, en segundos
+#define SYNC_INTERVAL 64
+
+//! Período de las lecturas del reloj de ClockTask en el firmware
+#define REFRESH_MS 100
+
+//! Tiempo límite para recibir la respuesta del servidor
+#define UART_TIMEOUT_MS 500
+
+//! Demora de la tarea que aplica las correcciones trasladadas
+#define DEFER_MS 20
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief       Avanza la hora real, la del servidor y la del oscilador del reloj con su error de frecuencia.
+ * @param ms    Milisegundos reales a avanzar.
+ */
+static void Advance(uint32_t ms);
+
+/**
+ * @brief           Avanza la hora real de a un segundo, atendiendo al cliente en cada uno como la tarea del firmware.
+ * @param seconds   Segundos reales a avanzar.
+ */
+static void Run(uint32_t seconds);
+
+/**
+ * @brief           Avanza la hora real leyendo el reloj cada REFRESH_MS, como ClockTask en el firmware.
+ * @param seconds   Segundos reales a avanzar.
+ */
+static void RunRefreshed(uint32_t seconds);
+
+/**
+ * @brief           Envía un pedido, espera la respuesta del servidor y se la entrega al cliente.
+ * @param uplink    Demora del pedido hasta el servidor.
+ * @param downlink  Demora de la respuesta hasta el reloj.
+ * @return          Resultado de TimeSyncReceive.
+ */
+static void RunRefreshed(uint32_t seconds) {
+    for (uint32_t refresh = 0; refresh < seconds * (1000 / REFRESH_MS); refresh++) {
+        Advance(REFRESH_MS);
+    }
+}
+
+static bool Exchange(uint32_t uplink, uint32_t downlink);
+
+/**
+ * @brief   Calcula la diferencia entre el reloj y el servidor.
+ * @return  Milisegundos que el reloj adelanta al servidor, negativo si atrasa.
+ */
+static int64_t ClockError(void);
+
+/**
+ * @brief   Simula la tarea que ajusta el reloj: registra el estado previo y aplica las correcciones con demora.
+ */
+static void FakeDefer(void);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Error de frecuencia del oscilador del reloj en ppm, positivo si adelanta
+static int32_t drift_ppm;
+
+//! Fracción de tick acumulada por el error de frecuencia, en millonésimas de tick
+static int64_t drift_accumulator;
+
+static clock_t clock;
+
+static serial_t serial;
+
+static timesync_t sync;
+
+static host_time_t * server;
+
+//! Veces que se trasladaron las correcciones
+static uint32_t deferred;
+
+//! Validez de la hora y corrección transitoria del reloj al trasladar las correcciones
+static bool deferred_valid;
+
+static int32_t deferred_slew;
+
+/* === Private function implementation ========================================================= */
+
+static void Advance(uint32_t ms) {
+    drift_accumulator += (int64_t)ms * drift_ppm;
+    host_fake.ticks += (uint32_t)((int64_t)ms + drift_accumulator / 1000000);
+    drift_accumulator %= 1000000;
+    server->now_ms += ms;
+    ClockRefresh(clock);
+}
+
+static void Run(uint32_t seconds) {
+    for (uint32_t second = 0; second < seconds; second++) {
+        Advance(1000);
+        TimeSyncPoll(sync);
+    }
+}
+
+static bool Exchange(uint32_t uplink, uint32_t downlink) {
+    serial_frame_t frame;
+    uint32_t served = server->served;
+
+    server->uplink_ms = uplink;
+    server->turnaround_ms = 1;
+    TEST_ASSERT_TRUE(TimeSyncRequest(sync));
+
+    // El servidor marca la respuesta con la hora actual, recién cuando responde se avanzan las demoras
+    TEST_ASSERT_TRUE(HostUartPoll(serial, UART_TIMEOUT_MS) > 0);
+    TEST_ASSERT_EQUAL_UINT32(served + 1, server->served);
+    Advance(uplink + server->turnaround_ms + downlink);
+    while (!SerialReadFrame(serial, &frame)) {
+        TEST_ASSERT_TRUE(HostUartPoll(serial, UART_TIMEOUT_MS) > 0);
+    }
+    return TimeSyncReceive(sync, &frame);
+}
+
+static int64_t ClockError(void) {
+    return (int64_t)(ClockGetUtcMillis(clock) - server->now_ms);
+}
+
+static void FakeDefer(void) {
+    deferred++;
+    deferred_valid = ClockGetTime(clock, &(clock_time_t){0});
+    deferred_slew = ClockGetSlew(clock);
+    Advance(DEFER_MS);
+    TimeSyncApply(sync);
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+    HostSourceFakeReset(CLOCK_TICKS_PER_SECOND); // El calendario cuenta con el mismo oscilador que el contador
+    drift_ppm = 0;
+    drift_accumulator = 0;
+    deferred = 0;
+    TEST_ASSERT_TRUE(HostUartOpen());
+    server = HostTimeServerStart(SERVER_START_MS);
+    TEST_ASSERT_NOT_NULL(server);
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ClockAttachSource(clock, HostSourceFakeCounter()); // Sólo el contador del oscilador, sin calendario
+    serial = SerialCreate(HostUartWrite);
+    sync = TimeSyncCreate(serial, clock, 0);
+}
+
+void tearDown(void) {
+    HostTimeServerStop();
+    HostUartClose();
+}
+
+// La primera muestra ajusta el reloj sin hora válida a la hora del servidor.
+void test_first_sample_steps_unset_clock(void) {
+    timesync_status_t status;
+
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_INT64_WITHIN(1, 0, ClockError());
+
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(1, status.requests);
+    TEST_ASSERT_EQUAL_UINT32(1, status.samples);
+    TEST_ASSERT_EQUAL_UINT32(1, status.steps);
+    TEST_ASSERT_EQUAL_UINT32(10, status.delay_ms);
+}
+
+// Una diferencia chica se recupera de a poco con la corrección del oscilador, sin saltos, y la corrección vuelve a la
+// base al terminar.
+void test_small_offset_is_slewed(void) {
+    timesync_status_t status;
+    uint64_t previous;
+
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    server->now_ms += 200; // El reloj queda 200 ms atrasado
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_EQUAL_INT32(TIMESYNC_SLEW_PPM, ClockGetSlew(clock));
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetTrim(clock)); // La corrección transitoria no cambia la base
+    TEST_ASSERT_INT64_WITHIN(1, -200, ClockError());
+
+    // A 500 ppm se recuperan 200 ms en 400 s, sin que la hora salte ni retroceda
+    for (uint16_t second = 0; second < 410; second++) {
+        previous = ClockGetUtcMillis(clock);
+        Run(1);
+        TEST_ASSERT_INT64_WITHIN(1, 1000, (int64_t)(ClockGetUtcMillis(clock) - previous));
+    }
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetSlew(clock));
+    TEST_ASSERT_INT64_WITHIN(1, 0, ClockError());
+
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(1, status.steps);
+    TEST_ASSERT_INT32_WITHIN(1, 200, status.offset_ms);
+}
+
+// Con el oscilador fuera de frecuencia las muestras periódicas estiman la corrección y mantienen la diferencia chica.
+void test_frequency_error_is_learned(void) {
+    timesync_status_t status;
+
+    drift_ppm = -150; // El oscilador atrasa 150 ppm, 9.6 ms por intervalo
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    for (uint8_t sample = 0; sample < 20; sample++) {
+        Run(SYNC_INTERVAL);
+        TEST_ASSERT_TRUE(Exchange(5, 5));
+    }
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_INT32_WITHIN(20, 150, status.base_ppm);
+    TEST_ASSERT_INT32_WITHIN(2, 0, status.offset_ms);
+    TEST_ASSERT_EQUAL_UINT32(1, status.steps);
+
+    Run(SYNC_INTERVAL);
+    TEST_ASSERT_INT64_WITHIN(3, 0, ClockError());
+}
+
+// Una diferencia mayor a TIMESYNC_STEP_MS salta a la hora del servidor.
+void test_large_offset_steps(void) {
+    timesync_status_t status;
+
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    server->now_ms += 5000;
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_INT64_WITHIN(1, 0, ClockError());
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetSlew(clock));
+
+    server->now_ms -= TIMESYNC_STEP_MS + 100; // También hacia atrás
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_INT64_WITHIN(1, 0, ClockError());
+
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(3, status.steps);
+}
+
+// Una muestra con demora excesiva se descarta sin modificar el reloj.
+void test_high_delay_sample_is_rejected(void) {
+    timesync_status_t status;
+
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    server->now_ms += 200;
+    TEST_ASSERT_FALSE(Exchange(TIMESYNC_MAX_DELAY_MS / 2, TIMESYNC_MAX_DELAY_MS / 2 + 1));
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetSlew(clock));
+    TEST_ASSERT_INT64_WITHIN(1, -200, ClockError());
+
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(1, status.samples);
+    TEST_ASSERT_EQUAL_UINT32(1, status.rejected);
+}
+
+// Una respuesta repetida o de otro pedido se descarta.
+void test_stale_reply_is_rejected(void) {
+    serial_frame_t frame = {.length = 24};
+    timesync_status_t status;
+
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_FALSE(TimeSyncReceive(sync, &frame)); // Sin pedido pendiente
+
+    TEST_ASSERT_TRUE(TimeSyncRequest(sync));
+    TEST_ASSERT_FALSE(TimeSyncReceive(sync, &frame)); // t1 no es el del pedido
+    frame.length = 8;
+    TEST_ASSERT_FALSE(TimeSyncReceive(sync, &frame));
+
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(1, status.samples);
+    TEST_ASSERT_EQUAL_UINT32(3, status.rejected);
+}
+
+// Los pedidos se envían periódicamente según el intervalo.
+void test_requests_are_periodic(void) {
+    timesync_status_t status;
+
+    sync = TimeSyncCreate(serial, clock, 10);
+    TimeSyncPoll(sync);
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(1, status.requests);
+
+    Run(9);
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(1, status.requests);
+    Run(1);
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(2, status.requests);
+}
+
+// Con el calendario del RTC no se corrige de a poco ni se estima la frecuencia, sólo se salta conservando la fracción.
+void test_calendar_source_only_steps(void) {
+    timesync_status_t status;
+
+    ClockAttachSource(clock, HostSourceFakeCalendar());
+    sync = TimeSyncCreate(serial, clock, 0);
+    drift_ppm = 200; // El cristal del RTC adelanta 200 ppm, 12.8 ms por intervalo
+
+    // El calendario comienza el segundo siguiente al ajuste con la fracción de la hora del servidor
+    server->now_ms += 500;
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    RunRefreshed(1);
+    TEST_ASSERT_TRUE(host_fake.valid);
+    TEST_ASSERT_INT64_WITHIN(REFRESH_MS, 0, ClockError());
+    TEST_ASSERT_INT64_WITHIN(REFRESH_MS, 0, (int64_t)host_fake.seconds * 1000 + (host_fake.ticks - host_fake.edge) -
+                                                (int64_t)server->now_ms);
+
+    // Las diferencias chicas se aceptan sin cambiar la corrección del oscilador, que no se aplica
+    for (uint8_t sample = 0; sample < 5; sample++) {
+        RunRefreshed(SYNC_INTERVAL);
+        TEST_ASSERT_TRUE(Exchange(5, 5));
+    }
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(6, status.samples);
+    TEST_ASSERT_EQUAL_UINT32(1, status.steps);
+    TEST_ASSERT_EQUAL_INT32(0, status.base_ppm);
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetTrim(clock));
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetSlew(clock));
+    TEST_ASSERT_INT32_WITHIN(REFRESH_MS, -64, status.offset_ms);
+
+    // Al superar TIMESYNC_CALENDAR_STEP_MS se salta, aunque la diferencia sea menor a TIMESYNC_STEP_MS
+    RunRefreshed(2000);
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TimeSyncGetStatus(sync, &status);
+    TEST_ASSERT_EQUAL_UINT32(2, status.steps);
+    TEST_ASSERT_LESS_THAN_INT32(-TIMESYNC_CALENDAR_STEP_MS, status.offset_ms);
+    TEST_ASSERT_GREATER_THAN_INT32(-TIMESYNC_STEP_MS, status.offset_ms);
+    TEST_ASSERT_EQUAL_INT32(0, status.base_ppm);
+    RunRefreshed(1);
+    TEST_ASSERT_INT64_WITHIN(REFRESH_MS, 0, ClockError());
+}
+
+// Con una función asociada las correcciones se aplican recién cuando la otra tarea llama a TimeSyncApply, y el salto
+// incluye la demora de esa tarea.
+void test_corrections_wait_for_defer(void) {
+    TimeSyncAttachDefer(sync, FakeDefer);
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_EQUAL_UINT32(1, deferred);
+    TEST_ASSERT_FALSE(deferred_valid);
+    TEST_ASSERT_INT64_WITHIN(1, 0, ClockError());
+
+    server->now_ms += 200;
+    TEST_ASSERT_TRUE(Exchange(5, 5));
+    TEST_ASSERT_EQUAL_UINT32(2, deferred);
+    TEST_ASSERT_EQUAL_INT32(0, deferred_slew);
+    TEST_ASSERT_EQUAL_INT32(TIMESYNC_SLEW_PPM, ClockGetSlew(clock));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,256 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_trace.c
+ ** @brief Código fuente de las pruebas del buffer de trazas y de su decodificación en el host
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "trace.h"
+#include "trace_json.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ - Cada traza ocupa 8 bytes.
+ - Las trazas se leen en el orden en que se escribieron, con el instante de la fuente de tiempo.
+ - Al dar la vuelta las trazas nuevas sobrescriben a las más antiguas, que se cuentan como perdidas.
+ - El decodificador nombra las tareas y anida ScreenRefresh dentro de la tarea que lo ejecuta.
+ - El decodificador ignora los cierres sin apertura y corrige el desborde del contador.
+ - El decodificador lee las trazas pendientes de un volcado del buffer que dio la vuelta.
+ - El decodificador lee las últimas trazas de un volcado sobrescrito y omite las incompletas.
+ - El decodificador rechaza un volcado sin la marca de comienzo.
+ **/
+
+/* === Macros definitions ====================================================================== */
+
+//! Ciclos por microsegundo de la fuente de tiempo simulada (204 MHz, como el LPC4337)
+#define TICKS_PER_US 204
+
+/* === Private data type declarations ========================================================== */
+
+/* === Privat function definitions ============================================================= */
+
+/**
+ * @brief Devuelve el instante simulado y lo avanza un microsegundo.
+ * @return Ciclos simulados.
+ */
+static uint32_t FakeNow(void);
+
+/**
+ * @brief         Decodifica trazas y deja el resultado en json.
+ * @param records Trazas a decodificar.
+ * @param count   Cantidad de trazas.
+ * @return        Cantidad de eventos JSON escritos.
+ */
+static uint32_t Decode(const trace_record_t * records, uint32_t count);
+
+/**
+ * @brief         Decodifica un volcado y deja el resultado en json.
+ * @param dump    Volcado del buffer.
+ * @param length  Cantidad de bytes del volcado.
+ * @return        Cantidad de eventos JSON escritos, o -1 si el volcado no es válido.
+ */
+static int32_t DecodeDump(const uint8_t * dump, size_t length);
+
+/**
+ * @brief Copia el contenido de un archivo temporal en json.
+ * @param file Archivo a copiar, se cierra.
+ */
+static void ReadJson(FILE * file);
+
+/* === Private variable declarations =========================================================== */
+
+static uint32_t fake_now;
+
+static trace_record_t records[TRACE_BUFFER_SIZE];
+
+static char json[8192];
+
+/* === Private function declarations =========================================================== */
+
+static uint32_t FakeNow(void) {
+    fake_now += TICKS_PER_US;
+    return fake_now;
+}
+
+static void ReadJson(FILE * file) {
+    size_t length;
+
+    rewind(file);
+    length = fread(json, 1, sizeof(json) - 1, file);
+    json[length] = 0;
+    fclose(file);
+}
+
+static uint32_t Decode(const trace_record_t * records, uint32_t count) {
+    FILE * file = tmpfile();
+    uint32_t written;
+
+    TEST_ASSERT_NOT_NULL(file);
+    written = TraceJsonWrite(file, records, count, TICKS_PER_US);
+    ReadJson(file);
+    return written;
+}
+
+static int32_t DecodeDump(const uint8_t * dump, size_t length) {
+    FILE * file = tmpfile();
+    int32_t written;
+
+    TEST_ASSERT_NOT_NULL(file);
+    written = TraceJsonWriteDump(file, dump, length);
+    ReadJson(file);
+    return written;
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Public function definitions ============================================================= */
+
+void setUp(void) {
+    fake_now = 0;
+    TraceInit(FakeNow, TICKS_PER_US);
+}
+
+// Cada traza ocupa 8 bytes.
+void test_record_is_eight_bytes(void) {
+    TEST_ASSERT_EQUAL(8, sizeof(trace_record_t));
+}
+
+// Las trazas se leen en el orden en que se escribieron, con el instante de la fuente de tiempo.
+void test_records_are_read_in_order(void) {
+    TraceWrite(TRACE_CLOCK_TICK_BEGIN, 0);
+    TraceWrite(TRACE_QUEUE_SEND, TRACE_QUEUE_MAIN);
+    TraceWrite(TRACE_CLOCK_TICK_END, 0);
+
+    TEST_ASSERT_EQUAL(3, TraceRead(records, TRACE_BUFFER_SIZE));
+    TEST_ASSERT_EQUAL(TRACE_CLOCK_TICK_BEGIN, records[0].event);
+    TEST_ASSERT_EQUAL(TRACE_QUEUE_SEND, records[1].event);
+    TEST_ASSERT_EQUAL(TRACE_QUEUE_MAIN, records[1].arg);
+    TEST_ASSERT_EQUAL(TRACE_CLOCK_TICK_END, records[2].event);
+    TEST_ASSERT_EQUAL(1 * TICKS_PER_US, records[0].timestamp);
+    TEST_ASSERT_EQUAL(3 * TICKS_PER_US, records[2].timestamp);
+    TEST_ASSERT_EQUAL(0, TraceRead(records, TRACE_BUFFER_SIZE));
+}
+
+// Al dar la vuelta las trazas nuevas sobrescriben a las más antiguas, que se cuentan como perdidas.
+void test_full_buffer_overwrites_oldest(void) {
+    for (uint16_t index = 0; index < TRACE_BUFFER_SIZE + 3; index++) {
+        TraceWrite(TRACE_ALARM, index);
+    }
+    TEST_ASSERT_EQUAL(3, TraceDropped());
+
+    TEST_ASSERT_EQUAL(2, TraceRead(records, 2));
+    TEST_ASSERT_EQUAL(3, records[0].arg);
+    TEST_ASSERT_EQUAL(4, records[1].arg);
+    TraceWrite(TRACE_ALARM, 1000);
+    TEST_ASSERT_EQUAL(3, TraceDropped());
+
+    TEST_ASSERT_EQUAL(TRACE_BUFFER_SIZE - 1, TraceRead(records, TRACE_BUFFER_SIZE));
+    TEST_ASSERT_EQUAL(5, records[0].arg);
+    TEST_ASSERT_EQUAL(1000, records[TRACE_BUFFER_SIZE - 2].arg);
+}
+
+// El decodificador nombra las tareas y anida ScreenRefresh dentro de la tarea que lo ejecuta.
+void test_decoder_nests_refresh_in_task(void) {
+    TraceWrite(TRACE_TASK_SWITCHED_IN, TRACE_TASK_DISPLAY);
+    TraceWrite(TRACE_SCREEN_REFRESH_BEGIN, 0);
+    TraceWrite(TRACE_SCREEN_REFRESH_END, 1);
+    TraceWrite(TRACE_QUEUE_SEND, TRACE_QUEUE_MAIN);
+    TraceWrite(TRACE_TASK_SWITCHED_OUT, TRACE_TASK_DISPLAY);
+    TraceWrite(TRACE_TASK_SWITCHED_IN, TRACE_TASK_MAIN);
+    TraceWrite(TRACE_ALARM, 1);
+
+    TEST_ASSERT_EQUAL(7, Decode(records, TraceRead(records, TRACE_BUFFER_SIZE)));
+    TEST_ASSERT_NOT_NULL(strstr(json, "\"args\":{\"name\":\"Display\"}"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"Display\",\"ph\":\"B\",\"ts\":0.000,\"pid\":1,\"tid\":2}"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"ScreenRefresh\",\"ph\":\"B\",\"ts\":1.000,\"pid\":1,\"tid\":2}"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"ScreenRefresh\",\"ph\":\"E\",\"ts\":2.000,\"pid\":1,\"tid\":2}"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "\"tid\":2,\"s\":\"t\",\"args\":{\"queue\":\"main\"}"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"AlarmOn\",\"ph\":\"i\",\"ts\":6.000,\"pid\":1,\"tid\":1"));
+}
+
+// El decodificador ignora los cierres sin apertura y corrige el desborde del contador.
+void test_decoder_skips_unmatched_end_and_unwraps(void) {
+    const trace_record_t wrapped[] = {
+        {.timestamp = 0xFFFFFF00u, .event = TRACE_CLOCK_TICK_END},
+        {.timestamp = 0xFFFFFF66u, .event = TRACE_CLOCK_TICK_BEGIN},
+        {.timestamp = 0x00000032u, .event = TRACE_CLOCK_TICK_END},
+    };
+
+    TEST_ASSERT_EQUAL(2, Decode(wrapped, 3));
+    TEST_ASSERT_NOT_NULL(strstr(json, "\"ph\":\"B\",\"ts\":0.500"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "\"ph\":\"E\",\"ts\":1.500"));
+}
+
+// El decodificador lee las trazas pendientes de un volcado del buffer que dio la vuelta.
+void test_decoder_reads_wrapped_dump(void) {
+    struct {
+        trace_header_t header;
+        trace_record_t records[4];
+    } dump = {
+        .header = {.magic = TRACE_MAGIC, .ticks_per_us = 1, .size = 4, .head = 6, .tail = 3},
+        .records = {
+            {.timestamp = 30, .event = TRACE_TASK_SWITCHED_OUT, .arg = TRACE_TASK_CLOCK},
+            {.timestamp = 0, .event = TRACE_NONE},
+            {.timestamp = 0, .event = TRACE_NONE},
+            {.timestamp = 10, .event = TRACE_TASK_SWITCHED_IN, .arg = TRACE_TASK_CLOCK},
+        },
+    };
+
+    // El lugar 1 está reservado pero sin completar, se omite
+    TEST_ASSERT_EQUAL(2, DecodeDump((const uint8_t *)&dump, sizeof(dump)));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"Clock\",\"ph\":\"B\",\"ts\":0.000"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"Clock\",\"ph\":\"E\",\"ts\":20.000"));
+}
+
+// El decodificador lee las últimas trazas de un volcado sobrescrito y omite las incompletas.
+void test_decoder_reads_overwritten_dump(void) {
+    struct {
+        trace_header_t header;
+        trace_record_t records[4];
+    } dump = {
+        .header = {.magic = TRACE_MAGIC, .ticks_per_us = 1, .size = 4, .head = 9, .tail = 2},
+        .records = {
+            {.timestamp = 40, .event = TRACE_ALARM, .arg = 1},
+            {.timestamp = 10, .event = TRACE_TASK_SWITCHED_IN, .arg = TRACE_TASK_CLOCK},
+            {.timestamp = 0, .event = TRACE_NONE},
+            {.timestamp = 30, .event = TRACE_TASK_SWITCHED_OUT, .arg = TRACE_TASK_CLOCK},
+        },
+    };
+
+    // Las trazas 2 a 4 se sobrescribieron y la 6 quedó sin completar al detener el programa
+    TEST_ASSERT_EQUAL(3, DecodeDump((const uint8_t *)&dump, sizeof(dump)));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"Clock\",\"ph\":\"B\",\"ts\":0.000"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"Clock\",\"ph\":\"E\",\"ts\":20.000"));
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"AlarmOn\",\"ph\":\"i\",\"ts\":30.000"));
+}
+
+// El decodificador rechaza un volcado sin la marca de comienzo.
+void test_decoder_rejects_invalid_dump(void) {
+    trace_header_t header = {.magic = 0, .size = 4};
+
+    TEST_ASSERT_EQUAL(-1, DecodeDump((const uint8_t *)&header, sizeof(header)));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
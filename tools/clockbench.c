@@ -0,0 +1,342 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clockbench.c
+ ** @brief Programa del host que mide el tiempo de las operaciones de la aritmética del reloj
+ **
+ ** Compara cada operación con la versión anterior, que se conserva en este archivo como referencia, verificando
+ ** primero que den el mismo resultado. Compilación y uso en el host:
+ **     gcc -std=c99 -O2 -DTEST -Iinc tools/clockbench.c src/clock.c src/screen.c src/buzzer.c -o clockbench
+ **     ./clockbench
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 199309L
+
+// time.h declara su propio clock_t, se renombra para que no choque con el del reloj
+#define clock_t host_clock_t
+#include <time.h>
+#undef clock_t
+
+#include "clock.h"
+#include "digital.h"
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de combinaciones de seis dígitos decimales
+#define BENCH_COMBINATIONS 1000000UL
+
+//! Veces que se recorren todas las combinaciones en cada medición
+#define BENCH_ROUNDS 20
+
+//! Segundos que se incrementan en cada medición, diez días
+#define BENCH_INCREMENTS 864000UL
+
+/* === Private data type declarations ============================================================================== */
+
+//! Operación que se mide sobre un arreglo de tiempos, devuelve un resultado para que no se descarte el cálculo.
+//! Las operaciones de incremento parten del primer tiempo del arreglo y avanzan count segundos
+typedef uint32_t (*bench_operation_t)(const clock_time_t * times, uint32_t count);
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief       Versión anterior de ClockTimeIsValid, con una comparación y un salto por cada límite.
+ * @param self  Tiempo a verificar.
+ * @return      true si el tiempo es válido, false en caso contrario.
+ */
+static bool BranchesTimeIsValid(const clock_time_t * self);
+
+/**
+ * @brief       Cuenta los tiempos válidos con la versión anterior.
+ * @param times Arreglo de tiempos.
+ * @param count Cantidad de tiempos.
+ * @return      Cantidad de tiempos válidos.
+ */
+static uint32_t BenchBranches(const clock_time_t * times, uint32_t count);
+
+/**
+ * @brief       Cuenta los tiempos válidos con ClockTimeIsValid.
+ * @param times Arreglo de tiempos.
+ * @param count Cantidad de tiempos.
+ * @return      Cantidad de tiempos válidos.
+ */
+static uint32_t BenchPacked(const clock_time_t * times, uint32_t count);
+
+/**
+ * @brief       Cuenta los tiempos válidos con ClockTimesAreValid, que se detiene en cada tiempo inválido.
+ * @param times Arreglo de tiempos.
+ * @param count Cantidad de tiempos.
+ * @return      Cantidad de tiempos válidos.
+ */
+static uint32_t BenchBatch(const clock_time_t * times, uint32_t count);
+
+/**
+ * @brief       Versión anterior del avance de un segundo del reloj, dígito por dígito.
+ * @param time  Tiempo a incrementar.
+ * @return      true si el tiempo pasó de 23:59:59 a 00:00:00.
+ */
+static bool CascadeIncrement(clock_time_t * time);
+
+/**
+ * @brief       Avanza segundos con la versión anterior.
+ * @param times Arreglo con el tiempo inicial.
+ * @param count Cantidad de segundos a avanzar.
+ * @return      Tiempo final empaquetado más la cantidad de días.
+ */
+static uint32_t BenchCascade(const clock_time_t * times, uint32_t count);
+
+/**
+ * @brief       Avanza segundos con ClockPackedIncrement.
+ * @param times Arreglo con el tiempo inicial.
+ * @param count Cantidad de segundos a avanzar.
+ * @return      Tiempo final empaquetado más la cantidad de días.
+ */
+static uint32_t BenchPackedIncrement(const clock_time_t * times, uint32_t count);
+
+/**
+ * @brief       Avanza segundos con ClockPackedIncrement, convirtiendo desde y hacia un dígito por byte en cada uno,
+ *              como haría el reloj si guardara la hora sin empaquetar.
+ * @param times Arreglo con el tiempo inicial.
+ * @param count Cantidad de segundos a avanzar.
+ * @return      Tiempo final empaquetado más la cantidad de días.
+ */
+static uint32_t BenchPackedConverted(const clock_time_t * times, uint32_t count);
+
+/**
+ * @brief       Mide una operación y muestra los nanosegundos por tiempo procesado.
+ * @param name  Nombre de la operación.
+ * @param run   Operación a medir.
+ * @param times Arreglo de tiempos.
+ * @param count Cantidad de tiempos.
+ * @return      Resultado de la operación.
+ */
+static uint32_t BenchMeasure(const char * name, bench_operation_t run, const clock_time_t * times, uint32_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Todas las combinaciones de seis dígitos decimales, en el orden de un contador
+static clock_time_t combinations[BENCH_COMBINATIONS];
+
+//! Las mismas combinaciones en un orden pseudoaleatorio, donde los saltos no se pueden predecir
+static clock_time_t shuffled[BENCH_COMBINATIONS];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool BranchesTimeIsValid(const clock_time_t * self) {
+    if (self->time.hours[1] > 2) {
+        return false;
+    }
+    if ((self->time.hours[1] == 2) && (self->time.hours[0] > 3)) {
+        return false;
+    }
+    if (self->time.hours[0] > 9) {
+        return false;
+    }
+    if (self->time.minutes[1] > 5) {
+        return false;
+    }
+    if (self->time.minutes[0] > 9) {
+        return false;
+    }
+    if (self->time.seconds[1] > 5) {
+        return false;
+    }
+    if (self->time.seconds[0] > 9) {
+        return false;
+    }
+    return true;
+}
+
+static uint32_t BenchBranches(const clock_time_t * times, uint32_t count) {
+    uint32_t valid = 0;
+    for (uint32_t index = 0; index < count; index++) {
+        valid += BranchesTimeIsValid(&times[index]);
+    }
+    return valid;
+}
+
+static uint32_t BenchPacked(const clock_time_t * times, uint32_t count) {
+    uint32_t valid = 0;
+    for (uint32_t index = 0; index < count; index++) {
+        valid += ClockTimeIsValid(&times[index]);
+    }
+    return valid;
+}
+
+static uint32_t BenchBatch(const clock_time_t * times, uint32_t count) {
+    uint32_t valid = 0;
+    while (count > 0) {
+        uint16_t block = (count > UINT16_MAX) ? UINT16_MAX : (uint16_t)count;
+        uint16_t first = ClockTimesAreValid(times, block);
+        valid += first;
+        if (first < block) {
+            first++; // Se saltea el tiempo inválido
+        }
+        times += first;
+        count -= first;
+    }
+    return valid;
+}
+
+static bool CascadeIncrement(clock_time_t * time) {
+    time->time.seconds[0]++;
+    if (time->time.seconds[0] > 9) {
+        time->time.seconds[0] = 0;
+        time->time.seconds[1]++;
+        if (time->time.seconds[1] > 5) {
+            time->time.seconds[1] = 0;
+            time->time.minutes[0]++;
+            if (time->time.minutes[0] > 9) {
+                time->time.minutes[0] = 0;
+                time->time.minutes[1]++;
+                if (time->time.minutes[1] > 5) {
+                    time->time.minutes[1] = 0;
+                    time->time.hours[0]++;
+                    if (time->time.hours[0] > 9) {
+                        time->time.hours[0] = 0;
+                        time->time.hours[1]++;
+                    }
+                    if ((time->time.hours[1] == 2) && (time->time.hours[0] == 4)) {
+                        time->time.hours[0] = 0;
+                        time->time.hours[1] = 0;
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+static uint32_t BenchCascade(const clock_time_t * times, uint32_t count) {
+    clock_time_t time = times[0];
+    uint32_t days = 0;
+    for (uint32_t index = 0; index < count; index++) {
+        days += CascadeIncrement(&time);
+    }
+    return ClockTimePack(&time) + days;
+}
+
+static uint32_t BenchPackedIncrement(const clock_time_t * times, uint32_t count) {
+    clock_packed_t packed = ClockTimePack(&times[0]);
+    uint32_t days = 0;
+    bool next_day;
+    for (uint32_t index = 0; index < count; index++) {
+        packed = ClockPackedIncrement(packed, &next_day);
+        days += next_day;
+    }
+    return packed + days;
+}
+
+static uint32_t BenchPackedConverted(const clock_time_t * times, uint32_t count) {
+    clock_time_t time = times[0];
+    uint32_t days = 0;
+    bool next_day;
+    for (uint32_t index = 0; index < count; index++) {
+        ClockTimeUnpack(ClockPackedIncrement(ClockTimePack(&time), &next_day), &time);
+        days += next_day;
+    }
+    return ClockTimePack(&time) + days;
+}
+
+static uint32_t BenchMeasure(const char * name, bench_operation_t run, const clock_time_t * times, uint32_t count) {
+    uint32_t result = 0;
+    struct timespec start;
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint8_t round = 0; round < BENCH_ROUNDS; round++) {
+        result = run(times, count);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("%-28s %8.3f ns/operación (%lu)\n", name, seconds * 1e9 / ((double)count * BENCH_ROUNDS),
+           (unsigned long)result);
+    return result;
+}
+
+/* === Public function definitions ============================================================================== */
+
+// El reloj no maneja salidas en las mediciones, las de la alarma no hacen nada
+void DigitalOutputActivate(digital_output_t self) {
+    (void)self;
+}
+
+void DigitalOutputDeactivate(digital_output_t self) {
+    (void)self;
+}
+
+int main(void) {
+    int result = 0;
+
+    for (uint32_t number = 0; number < BENCH_COMBINATIONS; number++) {
+        uint32_t rest = number;
+        for (uint8_t digit = 0; digit < 6; digit++) {
+            combinations[number].bcd[digit] = rest % 10;
+            rest /= 10;
+        }
+    }
+
+    // Mezcla de Fisher-Yates con un generador congruencial, la secuencia es la misma en cada ejecución
+    uint32_t seed = 1;
+    for (uint32_t index = 0; index < BENCH_COMBINATIONS; index++) {
+        shuffled[index] = combinations[index];
+    }
+    for (uint32_t index = BENCH_COMBINATIONS - 1; index > 0; index--) {
+        seed = seed * 1664525UL + 1013904223UL;
+        uint32_t other = seed % (index + 1);
+        clock_time_t swap = shuffled[index];
+        shuffled[index] = shuffled[other];
+        shuffled[other] = swap;
+    }
+
+    for (uint8_t order = 0; order < 2; order++) {
+        const clock_time_t * times = order ? shuffled : combinations;
+        printf("ClockTimeIsValid, %lu combinaciones de dígitos %s\n", BENCH_COMBINATIONS,
+               order ? "mezcladas" : "en orden");
+        uint32_t reference = BenchMeasure("con saltos (anterior)", BenchBranches, times, BENCH_COMBINATIONS);
+        if (BenchMeasure("palabra de 64 bits", BenchPacked, times, BENCH_COMBINATIONS) != reference) {
+            result = 1;
+        }
+        if (BenchMeasure("ClockTimesAreValid", BenchBatch, times, BENCH_COMBINATIONS) != reference) {
+            result = 1;
+        }
+    }
+
+    printf("Avance de un segundo, %lu segundos desde 00:00:00\n", BENCH_INCREMENTS);
+    uint32_t reference = BenchMeasure("dígito por dígito (anterior)", BenchCascade, combinations, BENCH_INCREMENTS);
+    if (BenchMeasure("BCD empaquetado", BenchPackedIncrement, combinations, BENCH_INCREMENTS) != reference) {
+        result = 1;
+    }
+    if (BenchMeasure("empaquetado con conversiones", BenchPackedConverted, combinations, BENCH_INCREMENTS) !=
+        reference) {
+        result = 1;
+    }
+    if (result) {
+        fprintf(stderr, "las versiones no coinciden\n");
+    }
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
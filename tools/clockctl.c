@@ -0,0 +1,305 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clockctl.c
+ ** @brief Programa del host que ajusta y consulta el reloj por el enlace serie
+ **
+ ** Compilación y uso en el host, con la placa conectada al puerto USB de depuración:
+ **     gcc -std=c99 -Iinc tools/clockctl.c src/serial.c -o clockctl
+ **     ./clockctl /dev/ttyUSB1 ping
+ **     ./clockctl /dev/ttyUSB1 sync               (ajusta la fecha y la hora locales de la PC)
+ **     ./clockctl /dev/ttyUSB1 time
+ **     ./clockctl /dev/ttyUSB1 alarm 07:30 0x3E   (días de la semana opcionales, el bit 0 es el domingo)
+ **     ./clockctl /dev/ttyUSB1 alarm off
+ **     ./clockctl /dev/ttyUSB1 stats
+ **     ./clockctl /dev/ttyUSB1 serve              (responde los pedidos de sincronización con la hora UTC de la PC)
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _DEFAULT_SOURCE
+
+// time.h declara su propio clock_t, se renombra para que no choque con el del reloj
+#define clock_t host_clock_t
+#include <time.h>
+#undef clock_t
+
+#include "command.h"
+#include "serial.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Tiempo límite para recibir la respuesta del reloj
+#define CLOCKCTL_TIMEOUT_MS 1000
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief        Abre el puerto serie en modo crudo a 115200 bps, la velocidad de SERIAL_BAUD_RATE.
+ *
+ * @param name   Ruta del puerto.
+ * @return       Descriptor del puerto, -1 si no se pudo abrir.
+ */
+static int PortOpen(const char * name);
+
+/**
+ * @brief        Transmite bytes por el puerto, tiene la forma de serial_write_t.
+ *
+ * @param data   Bytes a transmitir.
+ * @param size   Cantidad de bytes.
+ */
+static void PortWrite(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief         Envía un pedido y espera su respuesta.
+ *
+ * @param command Comando del pedido.
+ * @param payload Datos del pedido.
+ * @param length  Cantidad de bytes de datos.
+ * @param reply   Respuesta recibida.
+ * @return        true si llegó la respuesta al pedido, false si llegó un error o no llegó a tiempo.
+ */
+static bool Request(uint8_t command, const uint8_t * payload, uint8_t length, serial_frame_t * reply);
+
+/**
+ * @brief         Responde los pedidos de sincronización del reloj hasta que se cierra el puerto.
+ *
+ * @return        false, sólo termina si falla la lectura del puerto.
+ */
+static bool Serve(void);
+
+/**
+ * @brief         Obtiene la hora UTC de la PC.
+ *
+ * @return        Milisegundos desde el 1 de enero de 1970.
+ */
+static uint64_t NowMillis(void);
+
+/**
+ * @brief         Escribe un número de 64 bits con el byte bajo primero.
+ *
+ * @param data    Lugar donde se escriben los bytes del número.
+ * @param value   El número.
+ */
+static void SetStamp(uint8_t * data, uint64_t value);
+
+/**
+ * @brief         Lee un número de 32 bits con el byte bajo primero.
+ *
+ * @param data    Bytes del número.
+ * @return        El número.
+ */
+static uint32_t GetWord(const uint8_t * data);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Descriptor del puerto serie abierto
+static int port = -1;
+
+//! Enlace serie con el reloj
+static serial_t serial;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static int PortOpen(const char * name) {
+    struct termios settings;
+    int fd = open(name, O_RDWR | O_NOCTTY);
+
+    if (fd < 0) {
+        return -1;
+    }
+    if (tcgetattr(fd, &settings) != 0) {
+        close(fd);
+        return -1;
+    }
+    cfmakeraw(&settings);
+    cfsetspeed(&settings, B115200);
+    tcsetattr(fd, TCSANOW, &settings);
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
+
+static void PortWrite(const uint8_t * data, uint16_t size) {
+    while (size) {
+        ssize_t written = write(port, data, size);
+        if (written <= 0) {
+            return;
+        }
+        data += written;
+        size -= (uint16_t)written;
+    }
+}
+
+static bool Request(uint8_t command, const uint8_t * payload, uint8_t length, serial_frame_t * reply) {
+    struct pollfd fds = {.fd = port, .events = POLLIN};
+    uint8_t data[16];
+
+    if (!SerialSendFrame(serial, command, payload, length)) {
+        return false;
+    }
+    while (!SerialReadFrame(serial, reply)) {
+        ssize_t size;
+        if (poll(&fds, 1, CLOCKCTL_TIMEOUT_MS) <= 0) {
+            fprintf(stderr, "el reloj no responde\n");
+            return false;
+        }
+        size = read(port, data, sizeof(data));
+        if (size <= 0) {
+            return false;
+        }
+        SerialReceive(serial, data, (uint16_t)size);
+    }
+    if ((reply->command == COMMAND_ERROR) && (reply->length == 2)) {
+        fprintf(stderr, "el reloj rechazó el comando %u, motivo %u\n", reply->payload[0], reply->payload[1]);
+        return false;
+    }
+    return reply->command == (command | COMMAND_REPLY);
+}
+
+static bool Serve(void) {
+    serial_frame_t request;
+    uint8_t data[16];
+
+    while (true) {
+        ssize_t size = read(port, data, sizeof(data));
+        uint64_t received = NowMillis(); // Instante de llegada del último byte leído, lo más cerca posible de read
+        if (size <= 0) {
+            fprintf(stderr, "no se pudo leer el puerto\n");
+            return false;
+        }
+        SerialReceive(serial, data, (uint16_t)size);
+        while (SerialReadFrame(serial, &request)) {
+            if ((request.command != COMMAND_SYNC) || (request.length != 8)) {
+                continue;
+            }
+            uint8_t reply[24];
+            memcpy(reply, request.payload, 8);
+            SetStamp(&reply[8], received);
+            SetStamp(&reply[16], NowMillis());
+            SerialSendFrame(serial, COMMAND_SYNC | COMMAND_REPLY, reply, sizeof(reply));
+        }
+    }
+}
+
+static uint64_t NowMillis(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
+static void SetStamp(uint8_t * data, uint64_t value) {
+    for (uint8_t index = 0; index < 8; index++) {
+        data[index] = (uint8_t)(value >> (8 * index));
+    }
+}
+
+static uint32_t GetWord(const uint8_t * data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/* === Public function definitions ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    serial_frame_t reply;
+    bool done = false;
+
+    if (argc < 3) {
+        fprintf(stderr, "uso: %s puerto ping|time|sync|stats|serve|alarm HH:MM [días]|alarm off\n", argv[0]);
+        return 2;
+    }
+    port = PortOpen(argv[1]);
+    if (port < 0) {
+        fprintf(stderr, "no se pudo abrir %s\n", argv[1]);
+        return 1;
+    }
+    serial = SerialCreate(PortWrite);
+
+    if (strcmp(argv[2], "ping") == 0) {
+        done = Request(COMMAND_PING, NULL, 0, &reply);
+        if (done) {
+            printf("protocolo versión %u\n", reply.payload[0]);
+        }
+    } else if (strcmp(argv[2], "time") == 0) {
+        done = Request(COMMAND_GET_TIME, NULL, 0, &reply);
+        if (done) {
+            const uint8_t * data = reply.payload;
+            printf("%04u-%02u-%02u %02u:%02u:%02u día %u%s\n", data[0] | (data[1] << 8), data[2], data[3], data[4],
+                   data[5], data[6], data[7], data[8] ? "" : " (sin ajustar)");
+        }
+    } else if (strcmp(argv[2], "sync") == 0) {
+        time_t now = time(NULL);
+        struct tm local;
+        localtime_r(&now, &local);
+        uint16_t year = (uint16_t)(local.tm_year + 1900);
+        const uint8_t payload[] = {(uint8_t)year,          (uint8_t)(year >> 8),   (uint8_t)(local.tm_mon + 1),
+                                   (uint8_t)local.tm_mday, (uint8_t)local.tm_hour, (uint8_t)local.tm_min,
+                                   (uint8_t)local.tm_sec};
+        done = Request(COMMAND_SET_TIME, payload, sizeof(payload), &reply);
+    } else if ((strcmp(argv[2], "alarm") == 0) && (argc >= 4)) {
+        unsigned hours = 0;
+        unsigned minutes = 0;
+        uint8_t payload[4] = {0, 0, CLOCK_ALARM_EVERY_DAY, 0};
+
+        if (strcmp(argv[3], "off") == 0) {
+            done = Request(COMMAND_GET_ALARM, NULL, 0, &reply);
+            if (done) {
+                memcpy(payload, reply.payload, 3);
+            }
+        } else if (sscanf(argv[3], "%u:%u", &hours, &minutes) == 2) {
+            payload[0] = (uint8_t)hours;
+            payload[1] = (uint8_t)minutes;
+            payload[2] = (argc >= 5) ? (uint8_t)strtoul(argv[4], NULL, 0) : CLOCK_ALARM_EVERY_DAY;
+            payload[3] = 1;
+            done = true;
+        }
+        done = done && Request(COMMAND_SET_ALARM, payload, sizeof(payload), &reply);
+    } else if (strcmp(argv[2], "stats") == 0) {
+        done = Request(COMMAND_GET_STATS, NULL, 0, &reply);
+        if (done) {
+            printf("bytes recibidos %u, descartados %u\n", GetWord(&reply.payload[0]), GetWord(&reply.payload[4]));
+            printf("tramas %u, con error %u\n", GetWord(&reply.payload[8]), GetWord(&reply.payload[12]));
+            printf("trazas sobrescritas %u\n", GetWord(&reply.payload[16]));
+            printf("corrección %d ppm\n", (int32_t)GetWord(&reply.payload[20]));
+            if ((reply.length >= 32) && (GetWord(&reply.payload[24]) != IDLE_UNKNOWN)) {
+                printf("procesador inactivo %.1f %% (mínimo %.1f %%)\n", GetWord(&reply.payload[24]) / 10.0,
+                       GetWord(&reply.payload[28]) / 10.0);
+            }
+        }
+    } else if (strcmp(argv[2], "serve") == 0) {
+        done = Serve();
+    } else {
+        fprintf(stderr, "comando desconocido: %s\n", argv[2]);
+    }
+
+    close(port);
+    return done ? 0 : 1;
+}
+
+/* === End of documentation ======================================================================================== */
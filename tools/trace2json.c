@@ -0,0 +1,119 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Matías Milenkovitch <matiasmilenko02@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace2json.c
+ ** @brief Programa del host que convierte un volcado del buffer de trazas al formato JSON de Chrome
+ **
+ ** Volcado desde el depurador, con el programa detenido:
+ **     (gdb) dump binary value trace.bin trace
+ ** Compilación y uso en el host:
+ **     gcc -std=c99 -Iinc -Itest/support tools/trace2json.c test/support/trace_json.c -o trace2json
+ **     ./trace2json trace.bin > trace.json
+ ** También acepta una secuencia de trazas de 8 bytes, como las que devuelve TraceRead, indicando los ciclos por
+ ** microsegundo de la fuente de tiempo:
+ **     ./trace2json -r 204 trazas.bin > trace.json
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include "trace_json.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief        Lee un archivo completo en memoria.
+ *
+ * @param name   Nombre del archivo.
+ * @param length Cantidad de bytes leídos.
+ * @return       Contenido del archivo, o NULL si no se pudo leer.
+ */
+static uint8_t * ReadFile(const char * name, size_t * length);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t * ReadFile(const char * name, size_t * length) {
+    FILE * file = fopen(name, "rb");
+    uint8_t * data = NULL;
+    long size;
+
+    if (!file) {
+        return NULL;
+    }
+    if ((fseek(file, 0, SEEK_END) == 0) && ((size = ftell(file)) > 0) && (fseek(file, 0, SEEK_SET) == 0)) {
+        data = malloc((size_t)size);
+        if (data && (fread(data, 1, (size_t)size, file) != (size_t)size)) {
+            free(data);
+            data = NULL;
+        }
+        *length = (size_t)size;
+    }
+    fclose(file);
+    return data;
+}
+
+/* === Public function definitions ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    unsigned long ticks_per_us = 0;
+    const char * name;
+    uint8_t * data;
+    size_t length = 0;
+    int result = 0;
+
+    if ((argc == 4) && (strcmp(argv[1], "-r") == 0)) {
+        ticks_per_us = strtoul(argv[2], NULL, 10);
+        name = argv[3];
+    } else if (argc == 2) {
+        name = argv[1];
+    } else {
+        fprintf(stderr, "uso: %s [-r ciclos_por_us] archivo\n", argv[0]);
+        return 2;
+    }
+
+    data = ReadFile(name, &length);
+    if (!data) {
+        fprintf(stderr, "no se pudo leer %s\n", name);
+        return 1;
+    }
+
+    if (ticks_per_us) {
+        TraceJsonWrite(stdout, (const trace_record_t *)data, (uint32_t)(length / sizeof(trace_record_t)),
+                       (uint16_t)ticks_per_us);
+    } else if (TraceJsonWriteDump(stdout, data, length) < 0) {
+        fprintf(stderr, "%s no es un volcado del buffer de trazas\n", name);
+        result = 1;
+    }
+
+    free(data);
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */